@@ -0,0 +1,43 @@
+# benchmark: cache file formats (JSON indented, JSON compact, CBOR)
+# compares size, save and load time
+# QJsonArray content and Session* as DataManager reads / writes them (CBOR streamed)
+# run: ./cachebenchmark -platform offscreen
+# production caches: set CACHE_BENCHMARK_DATA to a copy of the app data directory (cache*.json)
+# otherwise the session cache is created from data-assets/conference schedules
+TEMPLATE = app
+TARGET = cachebenchmark
+
+QT += qml core testlib
+QT -= gui
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+APP_DIR = $$PWD/../..
+INCLUDEPATH += $$APP_DIR/cpp
+
+DEFINES += CACHE_BENCHMARK_FIXTURES=\\\"$$APP_DIR/data-assets/conference/\\\"
+
+HEADERS += \
+    $$APP_DIR/cpp/cacheformat.hpp \
+    $$APP_DIR/cpp/cachekeys.hpp \
+    $$APP_DIR/cpp/scheduleimporter.hpp \
+    $$APP_DIR/cpp/gen/Session.hpp \
+    $$APP_DIR/cpp/gen/Speaker.hpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.hpp \
+    $$APP_DIR/cpp/gen/SessionTrack.hpp \
+    $$APP_DIR/cpp/gen/Day.hpp \
+    $$APP_DIR/cpp/gen/Conference.hpp \
+    $$APP_DIR/cpp/gen/Room.hpp
+
+SOURCES += tst_cachebenchmark.cpp \
+    $$APP_DIR/cpp/cacheformat.cpp \
+    $$APP_DIR/cpp/cachejson.cpp \
+    $$APP_DIR/cpp/cachecbor.cpp \
+    $$APP_DIR/cpp/scheduleimporter.cpp \
+    $$APP_DIR/cpp/gen/Session.cpp \
+    $$APP_DIR/cpp/gen/Speaker.cpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.cpp \
+    $$APP_DIR/cpp/gen/SessionTrack.cpp \
+    $$APP_DIR/cpp/gen/Day.cpp \
+    $$APP_DIR/cpp/gen/Conference.cpp \
+    $$APP_DIR/cpp/gen/Room.cpp
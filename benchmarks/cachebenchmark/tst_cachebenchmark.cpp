@@ -0,0 +1,258 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QSaveFile>
+
+#include "cacheformat.hpp"
+#include "scheduleimporter.hpp"
+#include "gen/Session.hpp"
+
+Q_DECLARE_METATYPE(CacheFormat::Format)
+
+class CacheBenchmark : public QObject
+{
+    Q_OBJECT
+
+private:
+    // cache file name -> content
+    QMap<QString, QJsonArray> mCaches;
+    QTemporaryDir mTempDir;
+
+    static QString formatName(const CacheFormat::Format format) {
+        switch (format) {
+        case CacheFormat::JsonIndented:
+            return "json";
+        case CacheFormat::JsonCompact:
+            return "compact";
+        case CacheFormat::Cbor:
+            return "cbor";
+        }
+        return QString();
+    }
+
+    // creates cacheSession.json content from schedules in data-assets
+    QJsonArray sessionCacheFromSchedules() {
+        QList<ScheduleSource> sources;
+        ScheduleSource source;
+        source.conferenceId = 201801;
+        source.city = "BOSTON";
+        source.location = "Boston";
+        source.dayDates << "2018-10-29" << "2018-10-30";
+        sources.append(source);
+        source.conferenceId = 201802;
+        source.city = "BERLIN";
+        source.location = "Berlin";
+        source.dayDates.clear();
+        source.dayDates << "2018-12-05" << "2018-12-06";
+        sources.append(source);
+        ScheduleImporter importer;
+        ScheduleImport result = importer.importAll(CACHE_BENCHMARK_FIXTURES, sources);
+        QJsonArray cacheArray;
+        for (int s = 0; s < result.schedules.size(); ++s) {
+            const ImportedSchedule& schedule = result.schedules.at(s);
+            for (int d = 0; d < schedule.days.size(); ++d) {
+                for (int r = 0; r < schedule.days.at(d).rooms.size(); ++r) {
+                    const ImportedRoom& room = schedule.days.at(d).rooms.at(r);
+                    for (int i = 0; i < room.sessions.size(); ++i) {
+                        Session session;
+                        ScheduleImporter::fillSession(&session, room.sessions.at(i));
+                        cacheArray.append(session.toCacheJson());
+                    }
+                }
+            }
+        }
+        return cacheArray;
+    }
+
+    void addRows() {
+        QTest::addColumn<QString>("cacheName");
+        QTest::addColumn<CacheFormat::Format>("format");
+        QMapIterator<QString, QJsonArray> cacheIterator(mCaches);
+        while (cacheIterator.hasNext()) {
+            cacheIterator.next();
+            for (int f = CacheFormat::JsonIndented; f <= CacheFormat::Cbor; ++f) {
+                CacheFormat::Format format = static_cast<CacheFormat::Format>(f);
+                QTest::newRow(qPrintable(cacheIterator.key()+" "+formatName(format))) << cacheIterator.key() << format;
+            }
+        }
+    }
+
+    QString filePath(const QString& cacheName, const CacheFormat::Format format) {
+        return mTempDir.filePath(formatName(format)+"_"+cacheName);
+    }
+
+    // typed rows: only Session caches
+    void addSessionRows() {
+        QTest::addColumn<QString>("cacheName");
+        QTest::addColumn<CacheFormat::Format>("format");
+        QMapIterator<QString, QJsonArray> cacheIterator(mCaches);
+        while (cacheIterator.hasNext()) {
+            cacheIterator.next();
+            if (!cacheIterator.key().startsWith("cacheSession")) {
+                continue;
+            }
+            for (int f = CacheFormat::JsonIndented; f <= CacheFormat::Cbor; ++f) {
+                CacheFormat::Format format = static_cast<CacheFormat::Format>(f);
+                QTest::newRow(qPrintable(cacheIterator.key()+" "+formatName(format))) << cacheIterator.key() << format;
+            }
+        }
+    }
+
+    // Session* as created by DataManager from the cache
+    QList<QObject*> sessionsOf(const QString& cacheName, QObject* parent) {
+        QList<QObject*> sessions;
+        const QByteArray bytes = CacheFormat::encode(mCaches.value(cacheName), CacheFormat::JsonCompact);
+        CacheFormat::decodeObjects<Session>(bytes, parent, sessions);
+        return sessions;
+    }
+
+    static QJsonArray toCacheArray(const QList<QObject*>& sessions) {
+        QJsonArray cacheArray;
+        for (int i = 0; i < sessions.size(); ++i) {
+            cacheArray.append(static_cast<Session*>(sessions.at(i))->toCacheJson());
+        }
+        return cacheArray;
+    }
+
+private slots:
+    void initTestCase() {
+        QVERIFY(mTempDir.isValid());
+        const QString dataPath = qEnvironmentVariable("CACHE_BENCHMARK_DATA");
+        if (!dataPath.isEmpty()) {
+            QDir dataDir(dataPath);
+            const QStringList cacheFiles = dataDir.entryList(QStringList() << "cache*.json", QDir::Files);
+            for (int i = 0; i < cacheFiles.size(); ++i) {
+                QFile cacheFile(dataDir.filePath(cacheFiles.at(i)));
+                QVERIFY(cacheFile.open(QIODevice::ReadOnly));
+                bool ok = false;
+                QJsonArray cacheArray = CacheFormat::decode(cacheFile.readAll(), &ok);
+                QVERIFY2(ok, qPrintable(cacheFiles.at(i)));
+                mCaches.insert(cacheFiles.at(i), cacheArray);
+            }
+        } else {
+            mCaches.insert("cacheSession.json", sessionCacheFromSchedules());
+        }
+        QVERIFY(!mCaches.isEmpty());
+    }
+
+    // file sizes and round trip: decode(encode(x)) == x
+    void size_data() {
+        addRows();
+    }
+    void size() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        const QJsonArray cacheArray = mCaches.value(cacheName);
+        const QByteArray bytes = CacheFormat::encode(cacheArray, format);
+        QCOMPARE(CacheFormat::isCbor(bytes), format == CacheFormat::Cbor);
+        bool ok = false;
+        QCOMPARE(CacheFormat::decode(bytes, &ok), cacheArray);
+        QVERIFY(ok);
+        qInfo() << cacheName << formatName(format) << "records:" << cacheArray.size() << "bytes:" << bytes.size();
+    }
+
+    void save_data() {
+        addRows();
+    }
+    void save() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        const QJsonArray cacheArray = mCaches.value(cacheName);
+        const QString path = filePath(cacheName, format);
+        QBENCHMARK {
+            QSaveFile saveFile(path);
+            QVERIFY(saveFile.open(QIODevice::WriteOnly));
+            saveFile.write(CacheFormat::encode(cacheArray, format));
+            QVERIFY(saveFile.commit());
+        }
+    }
+
+    void load_data() {
+        addRows();
+    }
+    void load() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        const QString path = filePath(cacheName, format);
+        QSaveFile saveFile(path);
+        QVERIFY(saveFile.open(QIODevice::WriteOnly));
+        saveFile.write(CacheFormat::encode(mCaches.value(cacheName), format));
+        QVERIFY(saveFile.commit());
+        QJsonArray cacheArray;
+        QBENCHMARK {
+            QFile cacheFile(path);
+            QVERIFY(cacheFile.open(QIODevice::ReadOnly));
+            cacheArray = CacheFormat::decode(cacheFile.readAll());
+        }
+        QCOMPARE(cacheArray.size(), mCaches.value(cacheName).size());
+    }
+
+    // typed path used by DataManager: Session* <-> file content
+    // JSON goes through QJsonArray, CBOR is streamed (toCacheCbor / fillFromCacheCbor)
+    void sessionRoundTrip_data() {
+        addSessionRows();
+    }
+    void sessionRoundTrip() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        QObject parent;
+        const QList<QObject*> sessions = sessionsOf(cacheName, &parent);
+        QCOMPARE(sessions.size(), mCaches.value(cacheName).size());
+        const QByteArray bytes = CacheFormat::encodeObjects<Session>(sessions, format);
+        QCOMPARE(CacheFormat::isCbor(bytes), format == CacheFormat::Cbor);
+        QList<QObject*> loaded;
+        QVERIFY(CacheFormat::decodeObjects<Session>(bytes, &parent, loaded));
+        QCOMPARE(toCacheArray(loaded), toCacheArray(sessions));
+        // CBOR written by the stream is readable as QJsonArray too
+        bool ok = false;
+        QCOMPARE(CacheFormat::decode(bytes, &ok), toCacheArray(sessions));
+        QVERIFY(ok);
+    }
+
+    void saveSessions_data() {
+        addSessionRows();
+    }
+    void saveSessions() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        QObject parent;
+        const QList<QObject*> sessions = sessionsOf(cacheName, &parent);
+        const QString path = filePath("typed_"+cacheName, format);
+        QBENCHMARK {
+            QSaveFile saveFile(path);
+            QVERIFY(saveFile.open(QIODevice::WriteOnly));
+            saveFile.write(CacheFormat::encodeObjects<Session>(sessions, format));
+            QVERIFY(saveFile.commit());
+        }
+    }
+
+    // includes deleting the Session* again
+    void loadSessions_data() {
+        addSessionRows();
+    }
+    void loadSessions() {
+        QFETCH(QString, cacheName);
+        QFETCH(CacheFormat::Format, format);
+        const QString path = filePath("typed_"+cacheName, format);
+        {
+            QObject parent;
+            QSaveFile saveFile(path);
+            QVERIFY(saveFile.open(QIODevice::WriteOnly));
+            saveFile.write(CacheFormat::encodeObjects<Session>(sessionsOf(cacheName, &parent), format));
+            QVERIFY(saveFile.commit());
+        }
+        int loadedCount = 0;
+        QBENCHMARK {
+            QObject parent;
+            QList<QObject*> sessions;
+            QFile cacheFile(path);
+            QVERIFY(cacheFile.open(QIODevice::ReadOnly));
+            QVERIFY(CacheFormat::decodeObjects<Session>(cacheFile.readAll(), &parent, sessions));
+            loadedCount = sessions.size();
+        }
+        QCOMPARE(loadedCount, mCaches.value(cacheName).size());
+    }
+};
+
+QTEST_GUILESS_MAIN(CacheBenchmark)
+
+#include "tst_cachebenchmark.moc"
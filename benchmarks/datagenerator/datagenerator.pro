@@ -0,0 +1,13 @@
+# generator: synthetic conference data in server format for scale testing
+# writes schedule_<conferenceId>.json, speaker.json
+# and placeholder avatars (avatars/speaker_<id>.jpg)
+# run: ./datagenerator --output /tmp/bigconference --rooms 20 --sessions 12 --speakers 1500
+# use the output as IMPORT_BENCHMARK_DATA or DATALAYER_BENCHMARK_DATA
+TEMPLATE = app
+TARGET = datagenerator
+
+QT += core gui
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+SOURCES += main.cpp
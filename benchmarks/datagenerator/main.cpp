@@ -0,0 +1,330 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QRandomGenerator>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QSaveFile>
+#include <QDir>
+#include <QDate>
+#include <QTime>
+#include <QUrl>
+#include <QImage>
+#include <QPainter>
+#include <QColor>
+#include <QDebug>
+
+#include <cstdlib>
+#include <algorithm>
+
+/*
+ * synthetic conference data in the format of the server API
+ * (same as data-assets/conference: speaker.json, schedule_<conferenceId>.json)
+ * read by ScheduleImporter and applied by DataUtil::updateSessionsOfDay()
+ *
+ * days x rooms x sessions per room and day, speakers are shared by all conferences
+ * ids are deterministic, content is random (--seed)
+ *
+ * the app only imports the days of prepared conferences
+ * (DataUtil::prepareBoston201801(), prepareBerlin201802()):
+ * keep the default start dates and --days 2 to run a complete update,
+ * more days are imported by ScheduleImporter benchmarks with matching ScheduleSource
+ */
+
+// same tracks as used by QtWS
+static const QStringList trackNames = QStringList() << "Automotive" << "Medical" << "Embedded" << "Tooling"
+                                                    << "UI/UX" << "QML" << "3D" << "Mobile" << "Industrial" << "Technical";
+static const QStringList trackColors = QStringList() << "#c55f05" << "#0e9cd1" << "#41cd52" << "#ff3333"
+                                                     << "#8f5fd1" << "#d1b30e" << "#2b7a78" << "#e64a19" << "#5d4037" << "#455a64";
+static const QStringList firstNames = QStringList() << "Anna" << "Ben" << "Clara" << "David" << "Eva" << "Frank"
+                                                    << "Greta" << "Hugo" << "Ida" << "Jonas" << "Katrin" << "Lars"
+                                                    << "Mia" << "Noah" << "Olga" << "Paul" << "Rosa" << "Sven";
+static const QStringList lastNames = QStringList() << "Adler" << "Berg" << "Castro" << "Dietrich" << "Engel" << "Fischer"
+                                                   << "Garcia" << "Hansen" << "Ivanova" << "Jensen" << "Kowalski" << "Lindqvist"
+                                                   << "Moreau" << "Nakamura" << "Olsen" << "Peters" << "Rossi" << "Schmidt";
+static const QStringList words = QStringList() << "Qt" << "QML" << "performance" << "embedded" << "devices"
+                                               << "rendering" << "architecture" << "testing" << "automotive"
+                                               << "cross-platform" << "mobile" << "shaders" << "models" << "threads"
+                                               << "memory" << "startup" << "Wayland" << "sensors" << "cloud" << "design";
+// duration of sessions in minutes
+static const QList<int> durations = QList<int>() << 30 << 45 << 60;
+static const int breakMinutes = 15;
+// first session of a room starts at 09:00, the last one must end before midnight
+static const int firstStartMinutes = 9 * 60;
+
+struct ConferenceSpec
+{
+    int id;
+    QDate startDate;
+};
+
+class ConferenceDataGenerator
+{
+public:
+    int days;
+    int rooms;
+    int sessionsPerRoom;
+    int speakers;
+    int maxSpeakersPerSession;
+    int firstSessionId;
+    int firstSpeakerId;
+    int avatarSize;
+    QString avatarBaseUrl;
+    QList<ConferenceSpec> conferences;
+
+    explicit ConferenceDataGenerator(const quint32 seed) : mRandom(seed) {
+    }
+
+    // longest sessions: all sessions of a room and day fit into one day
+    // (QTime::addSecs() would wrap after midnight)
+    static int maxSessionsPerRoom() {
+        const int maxMinutes = *std::max_element(durations.constBegin(), durations.constEnd());
+        return (24 * 60 - firstStartMinutes - maxMinutes) / (maxMinutes + breakMinutes) + 1;
+    }
+
+    bool generate(const QString& outputPath) {
+        QDir outputDir(outputPath);
+        if (!outputDir.mkpath("avatars")) {
+            qWarning() << "cannot create directories in" << outputPath;
+            return false;
+        }
+        mOutputPath = outputDir.absolutePath() + "/";
+        if (avatarBaseUrl.isEmpty()) {
+            avatarBaseUrl = QUrl::fromLocalFile(mOutputPath + "avatars/").toString();
+        }
+        if (!avatarBaseUrl.endsWith("/")) {
+            avatarBaseUrl.append("/");
+        }
+        if (!writeSpeaker()) {
+            return false;
+        }
+        // no room mapping: rooms unknown to the prepared conference are created by the update
+        int sessionId = firstSessionId;
+        for (int i = 0; i < conferences.size(); ++i) {
+            if (!writeSchedule(conferences.at(i), sessionId)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    QRandomGenerator mRandom;
+    QString mOutputPath;
+
+    QString randomWords(const int count) {
+        QStringList text;
+        for (int i = 0; i < count; ++i) {
+            text.append(words.at(mRandom.bounded(words.size())));
+        }
+        return text.join(" ");
+    }
+
+    QString roomName(const int conferenceId, const int room) {
+        return QString("Room %1-%2").arg(conferenceId).arg(room + 1, 2, 10, QChar('0'));
+    }
+
+    bool writeJson(const QString& filePath, const QJsonDocument& document) {
+        QSaveFile saveFile(filePath);
+        if (!saveFile.open(QIODevice::WriteOnly)) {
+            qWarning() << "cannot write" << filePath;
+            return false;
+        }
+        saveFile.write(document.toJson(QJsonDocument::Indented));
+        return saveFile.commit();
+    }
+
+    // colored square with a lighter circle - no fonts needed
+    bool writeAvatar(const int speakerId) {
+        const QColor background = QColor::fromHsv(speakerId * 37 % 360, 120, 200);
+        QImage avatar(avatarSize, avatarSize, QImage::Format_RGB32);
+        avatar.fill(background);
+        QPainter painter(&avatar);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(background.lighter(150));
+        painter.drawEllipse(avatarSize / 4, avatarSize / 8, avatarSize / 2, avatarSize / 2);
+        painter.drawEllipse(avatarSize / 8, avatarSize * 5 / 8, avatarSize * 3 / 4, avatarSize * 3 / 4);
+        painter.end();
+        const QString avatarPath = mOutputPath + "avatars/speaker_" + QString::number(speakerId) + ".jpg";
+        if (!avatar.save(avatarPath, "JPG")) {
+            qWarning() << "cannot write" << avatarPath;
+            return false;
+        }
+        return true;
+    }
+
+    bool writeSpeaker() {
+        QJsonArray speakerArray;
+        for (int i = 0; i < speakers; ++i) {
+            const int speakerId = firstSpeakerId + i;
+            QJsonObject speakerObject;
+            speakerObject.insert("id", speakerId);
+            speakerObject.insert("first_name", firstNames.at(mRandom.bounded(firstNames.size())));
+            // unique names: speaker list is sorted and sectioned by last name
+            speakerObject.insert("last_name", lastNames.at(mRandom.bounded(lastNames.size())) + " " + QString::number(speakerId));
+            speakerObject.insert("abstract", randomWords(40 + mRandom.bounded(80)));
+            speakerObject.insert("title", randomWords(2));
+            speakerObject.insert("avatar", avatarBaseUrl + "speaker_" + QString::number(speakerId) + ".jpg");
+            speakerArray.append(speakerObject);
+            if (!writeAvatar(speakerId)) {
+                return false;
+            }
+        }
+        qDebug() << "speaker #" << speakerArray.size();
+        return writeJson(mOutputPath + "speaker.json", QJsonDocument(speakerArray));
+    }
+
+    QJsonObject createSession(const int sessionId, const QTime& startTime, const int minutes, const QString& room) {
+        QJsonObject sessionObject;
+        sessionObject.insert("id", sessionId);
+        sessionObject.insert("start", startTime.toString("HH:mm"));
+        sessionObject.insert("duration", QTime(0, 0).addSecs(minutes * 60).toString("HH:mm"));
+        sessionObject.insert("room", room);
+        const QString title = randomWords(3 + mRandom.bounded(6));
+        sessionObject.insert("slug", QString(title).toLower().replace(" ", "-"));
+        sessionObject.insert("title", title);
+        sessionObject.insert("subtitle", "");
+        QJsonArray trackArray;
+        const int track = mRandom.bounded(trackNames.size());
+        QJsonObject trackObject;
+        trackObject.insert("name", trackNames.at(track));
+        trackObject.insert("color", trackColors.at(track));
+        trackArray.append(trackObject);
+        sessionObject.insert("tracks", trackArray);
+        sessionObject.insert("track", "");
+        sessionObject.insert("type", "");
+        sessionObject.insert("language", "");
+        sessionObject.insert("abstract", "");
+        sessionObject.insert("description", randomWords(60 + mRandom.bounded(120)));
+        QJsonArray personArray;
+        const int speakerCount = speakers > 0 ? 1 + mRandom.bounded(maxSpeakersPerSession) : 0;
+        QList<int> speakerIds;
+        for (int i = 0; i < speakerCount; ++i) {
+            const int speakerId = firstSpeakerId + mRandom.bounded(speakers);
+            if (speakerIds.contains(speakerId)) {
+                continue;
+            }
+            speakerIds.append(speakerId);
+            QJsonObject personObject;
+            personObject.insert("id", speakerId);
+            personObject.insert("full_public_name", "Speaker " + QString::number(speakerId));
+            personObject.insert("first_name", "Speaker");
+            personObject.insert("last_name", QString::number(speakerId));
+            personArray.append(personObject);
+        }
+        sessionObject.insert("persons", personArray);
+        sessionObject.insert("links", QJsonArray());
+        return sessionObject;
+    }
+
+    bool writeSchedule(const ConferenceSpec& conference, int& sessionId) {
+        QJsonObject daysObject;
+        for (int d = 0; d < days; ++d) {
+            const QString dayDate = conference.startDate.addDays(d).toString("yyyy-MM-dd");
+            QJsonObject roomsObject;
+            for (int r = 0; r < rooms; ++r) {
+                const QString room = roomName(conference.id, r);
+                QJsonArray sessionArray;
+                QTime startTime = QTime(0, 0).addSecs(firstStartMinutes * 60);
+                for (int s = 0; s < sessionsPerRoom; ++s) {
+                    const int minutes = durations.at(mRandom.bounded(durations.size()));
+                    sessionArray.append(createSession(sessionId++, startTime, minutes, room));
+                    startTime = startTime.addSecs((minutes + breakMinutes) * 60);
+                }
+                roomsObject.insert(room, sessionArray);
+            }
+            QJsonObject dayObject;
+            dayObject.insert("index", d);
+            dayObject.insert("date", dayDate);
+            dayObject.insert("rooms", roomsObject);
+            daysObject.insert(dayDate, dayObject);
+        }
+        QJsonObject conferenceObject;
+        conferenceObject.insert("title", "Synthetic Conference " + QString::number(conference.id));
+        conferenceObject.insert("start", conference.startDate.toString("yyyy-MM-dd"));
+        conferenceObject.insert("end", conference.startDate.addDays(days - 1).toString("yyyy-MM-dd"));
+        conferenceObject.insert("timeslot_duration", "");
+        conferenceObject.insert("days", daysObject);
+        QJsonObject scheduleObject;
+        scheduleObject.insert("version", "1.0");
+        scheduleObject.insert("conference", conferenceObject);
+        qDebug() << "conference" << conference.id << "sessions #" << days * rooms * sessionsPerRoom;
+        return writeJson(mOutputPath + "schedule_" + QString::number(conference.id) + ".json", QJsonDocument(scheduleObject));
+    }
+};
+
+static int intOption(const QCommandLineParser& parser, const QString& name, const int minimum)
+{
+    bool ok = false;
+    const int value = parser.value(name).toInt(&ok);
+    if (!ok || value < minimum) {
+        qWarning() << "invalid value for" << name << ":" << parser.value(name);
+        exit(1);
+    }
+    return value;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("datagenerator");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Synthetic conference data (server format) for scale testing");
+    parser.addHelpOption();
+    parser.addOptions({
+        {"output", "Output directory.", "dir", "."},
+        {"conference", "Conference id and first day, repeatable. Default: 201801:2018-10-29 and 201802:2018-12-05.", "id:yyyy-MM-dd"},
+        {"days", "Days per conference.", "n", "2"},
+        {"rooms", "Rooms per conference.", "n", "10"},
+        {"sessions", "Sessions per room and day, max " + QString::number(ConferenceDataGenerator::maxSessionsPerRoom())
+         + " (more sessions: use more rooms or days).", "n", "8"},
+        {"speakers", "Speakers (all conferences).", "n", "200"},
+        {"max-speakers-per-session", "Speakers per session: 1 .. n.", "n", "2"},
+        {"first-session-id", "Id of first session.", "id", "100000"},
+        {"first-speaker-id", "Id of first speaker.", "id", "100000"},
+        {"avatar-size", "Width and height of placeholder avatars.", "pixel", "300"},
+        {"avatar-base-url", "URL of avatars dir. Default: file URL of <output>/avatars/.", "url"},
+        {"seed", "Seed of random content.", "n", "2018"}
+    });
+    parser.process(app);
+
+    ConferenceDataGenerator generator(static_cast<quint32>(intOption(parser, "seed", 0)));
+    generator.days = intOption(parser, "days", 1);
+    generator.rooms = intOption(parser, "rooms", 1);
+    generator.sessionsPerRoom = intOption(parser, "sessions", 1);
+    if (generator.sessionsPerRoom > ConferenceDataGenerator::maxSessionsPerRoom()) {
+        qWarning() << "sessions per room and day don't fit into one day, max:" << ConferenceDataGenerator::maxSessionsPerRoom()
+                   << "- use more rooms or days";
+        return 1;
+    }
+    generator.speakers = intOption(parser, "speakers", 1);
+    generator.maxSpeakersPerSession = intOption(parser, "max-speakers-per-session", 1);
+    generator.firstSessionId = intOption(parser, "first-session-id", 1);
+    generator.firstSpeakerId = intOption(parser, "first-speaker-id", 1);
+    generator.avatarSize = intOption(parser, "avatar-size", 16);
+    generator.avatarBaseUrl = parser.value("avatar-base-url");
+
+    QStringList conferenceValues = parser.values("conference");
+    if (conferenceValues.isEmpty()) {
+        conferenceValues << "201801:2018-10-29" << "201802:2018-12-05";
+    }
+    for (int i = 0; i < conferenceValues.size(); ++i) {
+        const QStringList parts = conferenceValues.at(i).split(":");
+        ConferenceSpec conference;
+        conference.id = parts.first().toInt();
+        conference.startDate = QDate::fromString(parts.last(), "yyyy-MM-dd");
+        if (parts.size() != 2 || conference.id <= 0 || !conference.startDate.isValid()) {
+            qWarning() << "invalid conference:" << conferenceValues.at(i);
+            return 1;
+        }
+        generator.conferences.append(conference);
+    }
+
+    if (!generator.generate(parser.value("output"))) {
+        return 1;
+    }
+    qDebug() << "written to" << QDir(parser.value("output")).absolutePath();
+    return 0;
+}
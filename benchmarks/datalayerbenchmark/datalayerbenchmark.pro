@@ -0,0 +1,89 @@
+# benchmark: data layer (DataManager, DataUtil) without QML UI
+# cache read/write per entity, cache maps, key lists, lookups, GoTo time and letter,
+# update (continueUpdate -> finishUpdate) from local fixtures, My Schedule, search
+# conditional requests (ETag, Last-Modified, 304) against a local HTTP stand-in
+# run headless: ./datalayerbenchmark -platform offscreen
+# data is written to the Qt test mode AppDataLocation (~/.qttest on Linux)
+# other fixtures: set DATALAYER_BENCHMARK_DATA to a dir containing speaker.json, schedule_<id>.json
+TEMPLATE = app
+TARGET = datalayerbenchmark
+
+QT += qml core gui network concurrent testlib
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+APP_DIR = $$PWD/../..
+INCLUDEPATH += $$APP_DIR/cpp
+
+DEFINES += DATALAYER_BENCHMARK_FIXTURES=\\\"$$APP_DIR/data-assets/conference/\\\"
+
+HEADERS += \
+    $$APP_DIR/cpp/gen/SettingsData.hpp \
+    $$APP_DIR/cpp/gen/Conference.hpp \
+    $$APP_DIR/cpp/gen/DataManager.hpp \
+    $$APP_DIR/cpp/gen/Day.hpp \
+    $$APP_DIR/cpp/gen/Favorite.hpp \
+    $$APP_DIR/cpp/gen/PersonsAPI.hpp \
+    $$APP_DIR/cpp/gen/Room.hpp \
+    $$APP_DIR/cpp/gen/Session.hpp \
+    $$APP_DIR/cpp/gen/SessionAPI.hpp \
+    $$APP_DIR/cpp/gen/SessionTrack.hpp \
+    $$APP_DIR/cpp/gen/Speaker.hpp \
+    $$APP_DIR/cpp/gen/SpeakerAPI.hpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.hpp \
+    $$APP_DIR/cpp/gen/SessionTrackAPI.hpp \
+    $$APP_DIR/cpp/gen/SessionLists.hpp \
+    $$APP_DIR/cpp/datautil.hpp \
+    $$APP_DIR/cpp/imageloader.hpp \
+    $$APP_DIR/cpp/dataserver.hpp \
+    $$APP_DIR/cpp/cachesnapshot.hpp \
+    $$APP_DIR/cpp/updatechangeset.hpp \
+    $$APP_DIR/cpp/scheduleimporter.hpp \
+    $$APP_DIR/cpp/imagedownloadscheduler.hpp \
+    $$APP_DIR/cpp/highdpiimages.hpp \
+    $$APP_DIR/cpp/networkservice.hpp \
+    $$APP_DIR/cpp/cacheformat.hpp \
+    $$APP_DIR/cpp/cachekeys.hpp \
+    $$APP_DIR/cpp/startupprofiler.hpp \
+    $$APP_DIR/cpp/searchindex.hpp \
+    $$APP_DIR/cpp/searchresultmodel.hpp \
+    $$APP_DIR/cpp/sessionlistmodel.hpp \
+    $$APP_DIR/cpp/daytimeindex.hpp
+
+SOURCES += tst_datalayerbenchmark.cpp \
+    $$APP_DIR/cpp/gen/SettingsData.cpp \
+    $$APP_DIR/cpp/gen/Conference.cpp \
+    $$APP_DIR/cpp/gen/DataManager.cpp \
+    $$APP_DIR/cpp/gen/Day.cpp \
+    $$APP_DIR/cpp/gen/Favorite.cpp \
+    $$APP_DIR/cpp/gen/PersonsAPI.cpp \
+    $$APP_DIR/cpp/gen/Room.cpp \
+    $$APP_DIR/cpp/gen/Session.cpp \
+    $$APP_DIR/cpp/gen/SessionAPI.cpp \
+    $$APP_DIR/cpp/gen/SessionTrack.cpp \
+    $$APP_DIR/cpp/gen/Speaker.cpp \
+    $$APP_DIR/cpp/gen/SpeakerAPI.cpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.cpp \
+    $$APP_DIR/cpp/gen/SessionTrackAPI.cpp \
+    $$APP_DIR/cpp/gen/SessionLists.cpp \
+    $$APP_DIR/cpp/datautil.cpp \
+    $$APP_DIR/cpp/imageloader.cpp \
+    $$APP_DIR/cpp/dataserver.cpp \
+    $$APP_DIR/cpp/cachesnapshot.cpp \
+    $$APP_DIR/cpp/scheduleimporter.cpp \
+    $$APP_DIR/cpp/imagedownloadscheduler.cpp \
+    $$APP_DIR/cpp/highdpiimages.cpp \
+    $$APP_DIR/cpp/networkservice.cpp \
+    $$APP_DIR/cpp/cacheformat.cpp \
+    $$APP_DIR/cpp/cachejson.cpp \
+    $$APP_DIR/cpp/cachecbor.cpp \
+    $$APP_DIR/cpp/cachedatastream.cpp \
+    $$APP_DIR/cpp/datamanagersnapshot.cpp \
+    $$APP_DIR/cpp/startupprofiler.cpp \
+    $$APP_DIR/cpp/searchindex.cpp \
+    $$APP_DIR/cpp/searchresultmodel.cpp \
+    $$APP_DIR/cpp/sessionlistmodel.cpp \
+    $$APP_DIR/cpp/daytimeindex.cpp
+
+# settings, speaker caches and room mappings are copied from data-assets
+RESOURCES += $$APP_DIR/data-assets.qrc
@@ -0,0 +1,779 @@
+#include <QtTest>
+#include <QStandardPaths>
+#include <QLoggingCategory>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+#include "gen/DataManager.hpp"
+#include "dataserver.hpp"
+#include "datautil.hpp"
+
+/*
+ * HTTP stand-in for the API server, set as QTWS_API_BASE_URL (see DataServer::init):
+ * serves files of the conference data path with ETag and Last-Modified,
+ * answers '304 Not Modified' if the request carries the current ETag
+ * one request per connection, all requests are recorded
+ */
+class ConditionalHttpServer : public QTcpServer
+{
+    Q_OBJECT
+
+public:
+    struct Request
+    {
+        QString path;
+        // header names in lower case
+        QHash<QByteArray, QByteArray> headers;
+    };
+
+    explicit ConditionalHttpServer(QObject* parent = nullptr) : QTcpServer(parent) {
+        bool res = connect(this, SIGNAL(newConnection()), this, SLOT(onNewConnection()));
+        if (!res) {
+            Q_ASSERT(res);
+        }
+    }
+
+    static QByteArray etag(const QString& path) {
+        return "\"" + QByteArray::number(qHash(path)) + "\"";
+    }
+    static QByteArray lastModified() {
+        return "Mon, 29 Oct 2018 08:00:00 GMT";
+    }
+
+    // path of request, per ex. "/speakers/all/"
+    void setFile(const QString& path, const QString& filePath) {
+        mFiles.insert(path, filePath);
+    }
+    QList<Request> takeRequests() {
+        QList<Request> requests = mRequests;
+        mRequests.clear();
+        return requests;
+    }
+
+private slots:
+    void onNewConnection() {
+        while (hasPendingConnections()) {
+            QTcpSocket* socket = nextPendingConnection();
+            connect(socket, SIGNAL(readyRead()), this, SLOT(onReadyRead()));
+            connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+        }
+    }
+
+    void onReadyRead() {
+        QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+        if(!socket) {
+            return;
+        }
+        mBuffers[socket].append(socket->readAll());
+        const int headerEnd = mBuffers.value(socket).indexOf("\r\n\r\n");
+        if(headerEnd < 0) {
+            return;
+        }
+        const QList<QByteArray> lines = mBuffers.take(socket).left(headerEnd).split('\n');
+        Request request;
+        request.path = QUrl::fromPercentEncoding(lines.first().split(' ').value(1));
+        for (int i = 1; i < lines.size(); ++i) {
+            const int colon = lines.at(i).indexOf(':');
+            if(colon > 0) {
+                request.headers.insert(lines.at(i).left(colon).trimmed().toLower(), lines.at(i).mid(colon + 1).trimmed());
+            }
+        }
+        mRequests.append(request);
+        socket->write(response(request));
+        socket->disconnectFromHost();
+    }
+
+private:
+    QHash<QString, QString> mFiles;
+    QHash<QTcpSocket*, QByteArray> mBuffers;
+    QList<Request> mRequests;
+
+    QByteArray response(const Request& request) {
+        const QString filePath = mFiles.value(request.path);
+        QFile file(filePath);
+        if(filePath.isEmpty() || !file.open(QIODevice::ReadOnly)) {
+            return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+        QByteArray response;
+        QByteArray body;
+        if(request.headers.value("if-none-match") == etag(request.path)) {
+            response = "HTTP/1.1 304 Not Modified\r\n";
+        } else {
+            body = file.readAll();
+            response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n";
+            response.append("Content-Length: " + QByteArray::number(body.size()) + "\r\n");
+        }
+        file.close();
+        response.append("ETag: " + etag(request.path) + "\r\n");
+        response.append("Last-Modified: " + lastModified() + "\r\n");
+        response.append("Connection: close\r\n\r\n");
+        return response.append(body);
+    }
+};
+
+/*
+ * data layer as used by the app, without QML UI
+ * runs against a Qt test mode AppDataLocation:
+ * first update prepares the conferences (same as first start of the app),
+ * all other benchmarks use the data of this update
+ */
+class DataLayerBenchmark : public QObject
+{
+    Q_OBJECT
+
+private:
+    DataManager* mDataManager;
+    DataServer* mDataServer;
+    DataUtil* mDataUtil;
+    QString mFixturesPath;
+    bool mUpdated;
+    ConditionalHttpServer* mHttpServer;
+    bool mValidatorsWrittenEarly;
+
+signals:
+    // updateDone() or updateFailed() of DataUtil
+    void updateFinished();
+
+private:
+
+    // fromServer: same as the app, requests Schedules and Speaker from mHttpServer
+    void runUpdate(const bool fromServer = false) {
+        QSignalSpy finishedSpy(this, SIGNAL(updateFinished()));
+        QSignalSpy failedSpy(mDataUtil, SIGNAL(updateFailed(QString)));
+        if(fromServer) {
+            mDataUtil->startUpdate();
+        } else {
+            mDataUtil->updateFromConferenceData();
+        }
+        // parsing runs on a worker thread: wait returns as soon as done or failed is emitted
+        QVERIFY(!finishedSpy.isEmpty() || finishedSpy.wait(60000));
+        QVERIFY2(failedSpy.isEmpty(), qPrintable(failedSpy.isEmpty() ? QString() : failedSpy.first().first().toString()));
+        mUpdated = true;
+    }
+    void ensureUpdated() {
+        if(!mUpdated) {
+            runUpdate();
+        }
+    }
+
+    // all DataObjects of one kind, per ex. "Session"
+    QList<QObject*> allOf(const QString& entity) {
+        if(entity == "Conference") {
+            return mDataManager->mAllConference;
+        }
+        if(entity == "Room") {
+            return mDataManager->mAllRoom;
+        }
+        if(entity == "Session") {
+            return mDataManager->mAllSession;
+        }
+        if(entity == "Speaker") {
+            return mDataManager->mAllSpeaker;
+        }
+        if(entity == "SpeakerImage") {
+            return mDataManager->mAllSpeakerImage;
+        }
+        if(entity == "SessionTrack") {
+            return mDataManager->mAllSessionTrack;
+        }
+        return mDataManager->mAllDay;
+    }
+
+    template<class T>
+    QVariantList toCacheMaps(const QList<QObject*>& all) {
+        QVariantList cacheMaps;
+        for (int i = 0; i < all.size(); ++i) {
+            cacheMaps.append(static_cast<T*>(all.at(i))->toCacheMap());
+        }
+        return cacheMaps;
+    }
+    QVariantList toCacheMaps(const QString& entity) {
+        const QList<QObject*> all = allOf(entity);
+        if(entity == "Conference") {
+            return toCacheMaps<Conference>(all);
+        }
+        if(entity == "Room") {
+            return toCacheMaps<Room>(all);
+        }
+        if(entity == "Session") {
+            return toCacheMaps<Session>(all);
+        }
+        if(entity == "Speaker") {
+            return toCacheMaps<Speaker>(all);
+        }
+        if(entity == "SpeakerImage") {
+            return toCacheMaps<SpeakerImage>(all);
+        }
+        if(entity == "SessionTrack") {
+            return toCacheMaps<SessionTrack>(all);
+        }
+        return toCacheMaps<Day>(all);
+    }
+
+    template<class T>
+    QJsonArray toCacheJsonArray(const QList<QObject*>& all) {
+        QJsonArray cacheArray;
+        for (int i = 0; i < all.size(); ++i) {
+            cacheArray.append(static_cast<T*>(all.at(i))->toCacheJson());
+        }
+        return cacheArray;
+    }
+    QJsonArray toCacheJsonArray(const QString& entity) {
+        const QList<QObject*> all = allOf(entity);
+        if(entity == "Conference") {
+            return toCacheJsonArray<Conference>(all);
+        }
+        if(entity == "Room") {
+            return toCacheJsonArray<Room>(all);
+        }
+        if(entity == "Session") {
+            return toCacheJsonArray<Session>(all);
+        }
+        if(entity == "Speaker") {
+            return toCacheJsonArray<Speaker>(all);
+        }
+        if(entity == "SpeakerImage") {
+            return toCacheJsonArray<SpeakerImage>(all);
+        }
+        if(entity == "SessionTrack") {
+            return toCacheJsonArray<SessionTrack>(all);
+        }
+        return toCacheJsonArray<Day>(all);
+    }
+
+    template<class T>
+    void fillFromCacheJsonArray(const QJsonArray& cacheArray) {
+        for (int i = 0; i < cacheArray.size(); ++i) {
+            T dataObject;
+            dataObject.fillFromCacheJson(cacheArray.at(i).toObject());
+        }
+    }
+    void fillFromCacheJsonArray(const QString& entity, const QJsonArray& cacheArray) {
+        if(entity == "Conference") {
+            fillFromCacheJsonArray<Conference>(cacheArray);
+        } else if(entity == "Room") {
+            fillFromCacheJsonArray<Room>(cacheArray);
+        } else if(entity == "Session") {
+            fillFromCacheJsonArray<Session>(cacheArray);
+        } else if(entity == "Speaker") {
+            fillFromCacheJsonArray<Speaker>(cacheArray);
+        } else if(entity == "SpeakerImage") {
+            fillFromCacheJsonArray<SpeakerImage>(cacheArray);
+        } else if(entity == "SessionTrack") {
+            fillFromCacheJsonArray<SessionTrack>(cacheArray);
+        } else {
+            fillFromCacheJsonArray<Day>(cacheArray);
+        }
+    }
+
+    template<class T>
+    void fillFromCacheMaps(const QVariantList& cacheMaps) {
+        for (int i = 0; i < cacheMaps.size(); ++i) {
+            T dataObject;
+            dataObject.fillFromCacheMap(cacheMaps.at(i).toMap());
+        }
+    }
+    void fillFromCacheMaps(const QString& entity, const QVariantList& cacheMaps) {
+        if(entity == "Conference") {
+            fillFromCacheMaps<Conference>(cacheMaps);
+        } else if(entity == "Room") {
+            fillFromCacheMaps<Room>(cacheMaps);
+        } else if(entity == "Session") {
+            fillFromCacheMaps<Session>(cacheMaps);
+        } else if(entity == "Speaker") {
+            fillFromCacheMaps<Speaker>(cacheMaps);
+        } else if(entity == "SpeakerImage") {
+            fillFromCacheMaps<SpeakerImage>(cacheMaps);
+        } else if(entity == "SessionTrack") {
+            fillFromCacheMaps<SessionTrack>(cacheMaps);
+        } else {
+            fillFromCacheMaps<Day>(cacheMaps);
+        }
+    }
+
+    QList<int> idsOf(const QString& entity) {
+        QList<int> ids;
+        const QList<QObject*> all = allOf(entity);
+        for (int i = 0; i < all.size(); ++i) {
+            if(entity == "Conference") {
+                ids.append(static_cast<Conference*>(all.at(i))->id());
+            } else if(entity == "Room") {
+                ids.append(static_cast<Room*>(all.at(i))->roomId());
+            } else if(entity == "Session") {
+                ids.append(static_cast<Session*>(all.at(i))->sessionId());
+            } else if(entity == "Speaker") {
+                ids.append(static_cast<Speaker*>(all.at(i))->speakerId());
+            } else if(entity == "SpeakerImage") {
+                ids.append(static_cast<SpeakerImage*>(all.at(i))->speakerId());
+            } else if(entity == "SessionTrack") {
+                ids.append(static_cast<SessionTrack*>(all.at(i))->trackId());
+            } else {
+                ids.append(static_cast<Day*>(all.at(i))->id());
+            }
+        }
+        return ids;
+    }
+    // returns number of DataObjects found
+    int findAll(const QString& entity, const QList<int>& ids) {
+        int found = 0;
+        for (int i = 0; i < ids.size(); ++i) {
+            QObject* dataObject;
+            if(entity == "Conference") {
+                dataObject = mDataManager->findConferenceById(ids.at(i));
+            } else if(entity == "Room") {
+                dataObject = mDataManager->findRoomByRoomId(ids.at(i));
+            } else if(entity == "Session") {
+                dataObject = mDataManager->findSessionBySessionId(ids.at(i));
+            } else if(entity == "Speaker") {
+                dataObject = mDataManager->findSpeakerBySpeakerId(ids.at(i));
+            } else if(entity == "SpeakerImage") {
+                dataObject = mDataManager->findSpeakerImageBySpeakerId(ids.at(i));
+            } else if(entity == "SessionTrack") {
+                dataObject = mDataManager->findSessionTrackByTrackId(ids.at(i));
+            } else {
+                dataObject = mDataManager->findDayById(ids.at(i));
+            }
+            if(dataObject) {
+                found++;
+            }
+        }
+        return found;
+    }
+
+    void addEntityRows() {
+        QTest::addColumn<QString>("entity");
+        QTest::newRow("Conference") << "Conference";
+        QTest::newRow("Room") << "Room";
+        QTest::newRow("Session") << "Session";
+        QTest::newRow("Speaker") << "Speaker";
+        QTest::newRow("SpeakerImage") << "SpeakerImage";
+        QTest::newRow("SessionTrack") << "SessionTrack";
+        QTest::newRow("Day") << "Day";
+    }
+    void addCacheFileRows() {
+        ensureUpdated();
+        QTest::addColumn<QString>("fileName");
+        const QStringList cacheFiles = QDir(mDataManager->dataPath("")).entryList(QStringList("cache*.json"), QDir::Files, QDir::Name);
+        for (int i = 0; i < cacheFiles.size(); ++i) {
+            QTest::newRow(qPrintable(cacheFiles.at(i))) << cacheFiles.at(i);
+        }
+    }
+
+    QString validatorsFilePath() {
+        return mDataUtil->mConferenceDataPath + "httpValidators.json";
+    }
+
+public slots:
+    // connected to progressInfo() while the first update from server is running
+    void checkValidatorsNotWritten() {
+        if(QFile::exists(validatorsFilePath())) {
+            mValidatorsWrittenEarly = true;
+        }
+    }
+
+private slots:
+    void initTestCase() {
+        // thousands of debug logs would be measured, too
+        QLoggingCategory::setFilterRules("default.debug=false");
+        QStandardPaths::setTestModeEnabled(true);
+        QDir(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)).removeRecursively();
+        mFixturesPath = qEnvironmentVariable("DATALAYER_BENCHMARK_DATA", DATALAYER_BENCHMARK_FIXTURES);
+        if(!mFixturesPath.endsWith("/")) {
+            mFixturesPath.append("/");
+        }
+        QVERIFY2(QFile::exists(mFixturesPath + "speaker.json"), qPrintable(mFixturesPath));
+        mUpdated = false;
+
+        // DataServer reads the API base URL from environment at init()
+        mHttpServer = new ConditionalHttpServer(this);
+        QVERIFY(mHttpServer->listen(QHostAddress::LocalHost));
+        qputenv("QTWS_API_BASE_URL", "http://127.0.0.1:" + QByteArray::number(mHttpServer->serverPort()) + "/");
+
+        mDataManager = new DataManager(this);
+        mDataServer = new DataServer(this);
+        mDataServer->init(mDataManager);
+        mDataUtil = new DataUtil(this);
+        mDataUtil->init(mDataManager, mDataServer);
+        mDataManager->init();
+        bool res = connect(mDataUtil, SIGNAL(updateDone()), this, SIGNAL(updateFinished()));
+        QVERIFY(res);
+        res = connect(mDataUtil, SIGNAL(updateFailed(QString)), this, SIGNAL(updateFinished()));
+        QVERIFY(res);
+
+        // same as downloaded from server
+        QVERIFY(mDataUtil->checkDirs());
+        const QStringList serverFiles = QDir(mFixturesPath).entryList(QStringList("*.json"), QDir::Files);
+        for (int i = 0; i < serverFiles.size(); ++i) {
+            QVERIFY(QFile::copy(mFixturesPath + serverFiles.at(i), mDataUtil->mConferenceDataPath + serverFiles.at(i)));
+        }
+    }
+
+    void cleanupTestCase() {
+        QDir(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)).removeRecursively();
+    }
+
+    // prepare conferences, all Sessions and Speaker are new
+    void initialUpdate() {
+        QVERIFY(!mUpdated);
+        QBENCHMARK_ONCE {
+            runUpdate();
+        }
+    }
+
+    // nothing changed: compare only
+    void repeatedUpdate() {
+        ensureUpdated();
+        QBENCHMARK {
+            runUpdate();
+            if(QTest::currentTestFailed()) {
+                return;
+            }
+        }
+    }
+
+    // nothing changed: no DataObject is created or kept alive per update
+    // children of DataManager are all root DTOs (Session, Speaker, ...)
+    void repeatedUpdateKeepsMemoryFlat() {
+        ensureUpdated();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        const int children = mDataManager->children().size();
+        const int sessions = mDataManager->mAllSession.size();
+        const int speakers = mDataManager->mAllSpeaker.size();
+        for (int i = 0; i < 5; ++i) {
+            runUpdate();
+            if(QTest::currentTestFailed()) {
+                return;
+            }
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+            QCOMPARE(mDataManager->children().size(), children);
+            QCOMPARE(mDataManager->mAllSession.size(), sessions);
+            QCOMPARE(mDataManager->mAllSpeaker.size(), speakers);
+        }
+    }
+
+    // Speaker no longer received from server is deleted, not only removed from the lists
+    void removedSpeakerIsDeleted() {
+        ensureUpdated();
+        const QString speakerPath = mDataUtil->mConferenceDataPath + "speaker.json";
+        QFile speakerFile(speakerPath);
+        QVERIFY(speakerFile.open(QIODevice::ReadOnly));
+        const QByteArray allSpeakers = speakerFile.readAll();
+        speakerFile.close();
+        QJsonArray speakerArray = QJsonDocument::fromJson(allSpeakers).array();
+        QVERIFY(!speakerArray.isEmpty());
+        const int removedId = speakerArray.last().toObject().value("id").toInt();
+        QPointer<Speaker> removedSpeaker = mDataManager->findSpeakerBySpeakerId(removedId);
+        QVERIFY(removedSpeaker);
+        const int speakers = mDataManager->mAllSpeaker.size();
+
+        speakerArray.removeLast();
+        QVERIFY(speakerFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        speakerFile.write(QJsonDocument(speakerArray).toJson(QJsonDocument::Compact));
+        speakerFile.close();
+        runUpdate();
+        // following tests need all Speaker again
+        QVERIFY(speakerFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        speakerFile.write(allSpeakers);
+        speakerFile.close();
+        if(QTest::currentTestFailed()) {
+            return;
+        }
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        QVERIFY(removedSpeaker.isNull());
+        QVERIFY(!mDataManager->findSpeakerBySpeakerId(removedId));
+        QCOMPARE(mDataManager->mAllSpeaker.size(), speakers - 1);
+
+        runUpdate();
+        QCOMPARE(mDataManager->mAllSpeaker.size(), speakers);
+    }
+
+    // conditional requests: 1st update gets the validators, 2nd sends them
+    // and gets '304 Not Modified' for all - nothing is downloaded, parsed or compared
+    void conditionalUpdate() {
+        ensureUpdated();
+        if(!mDataServer->networkService()->isNetworkAccessible()) {
+            QSKIP("Network not accessible");
+        }
+        const QString dataPath = mDataUtil->mConferenceDataPath;
+        QStringList fileNames("speaker.json");
+        mHttpServer->setFile("/speakers/all/", dataPath + "speaker.json");
+        const QList<ScheduleSource> sources = mDataUtil->scheduleSources();
+        for (int i = 0; i < sources.size(); ++i) {
+            const QString fileName = "schedule_" + QString::number(sources.at(i).conferenceId) + ".json";
+            mHttpServer->setFile("/schedule/all/?location=" + sources.at(i).location, dataPath + fileName);
+            fileNames.append(fileName);
+        }
+        QVERIFY(!QFile::exists(validatorsFilePath()));
+        mHttpServer->takeRequests();
+
+        // validators are committed after the data was applied (completeUpdate)
+        mValidatorsWrittenEarly = false;
+        bool res = connect(mDataUtil, SIGNAL(progressInfo(QString)), this, SLOT(checkValidatorsNotWritten()));
+        QVERIFY(res);
+        runUpdate(true);
+        disconnect(mDataUtil, SIGNAL(progressInfo(QString)), this, SLOT(checkValidatorsNotWritten()));
+        if(QTest::currentTestFailed()) {
+            return;
+        }
+        QVERIFY(mDataServer->hasModifiedData());
+        QVERIFY(!mValidatorsWrittenEarly);
+        QVERIFY(QFile::exists(validatorsFilePath()));
+        QList<ConditionalHttpServer::Request> requests = mHttpServer->takeRequests();
+        QCOMPARE(requests.size(), fileNames.size());
+        for (int i = 0; i < requests.size(); ++i) {
+            QVERIFY2(!requests.at(i).headers.contains("if-none-match"), qPrintable(requests.at(i).path));
+            QVERIFY2(!requests.at(i).headers.contains("if-modified-since"), qPrintable(requests.at(i).path));
+        }
+
+        QFile validatorsFile(validatorsFilePath());
+        QVERIFY(validatorsFile.open(QIODevice::ReadOnly));
+        const QByteArray validators = validatorsFile.readAll();
+        validatorsFile.close();
+        // a file written again gets the current time
+        const QDateTime modified = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch() - 24*60*60);
+        for (int i = 0; i < fileNames.size(); ++i) {
+            QFile file(dataPath + fileNames.at(i));
+            QVERIFY(file.open(QIODevice::ReadWrite));
+            QVERIFY(file.setFileTime(modified, QFileDevice::FileModificationTime));
+            file.close();
+        }
+
+        QSignalSpy progressSpy(mDataUtil, SIGNAL(progressInfo(QString)));
+        runUpdate(true);
+        if(QTest::currentTestFailed()) {
+            return;
+        }
+        requests = mHttpServer->takeRequests();
+        QCOMPARE(requests.size(), fileNames.size());
+        for (int i = 0; i < requests.size(); ++i) {
+            const ConditionalHttpServer::Request& request = requests.at(i);
+            QVERIFY2(request.headers.contains("if-none-match"), qPrintable(request.path));
+            QCOMPARE(request.headers.value("if-none-match"), ConditionalHttpServer::etag(request.path));
+            QCOMPARE(request.headers.value("if-modified-since"), ConditionalHttpServer::lastModified());
+        }
+        // finishUnmodifiedUpdate()
+        QVERIFY(!mDataServer->hasModifiedData());
+        QVERIFY(!progressSpy.isEmpty());
+        QVERIFY(progressSpy.last().first().toString().contains("not modified"));
+        for (int i = 0; i < fileNames.size(); ++i) {
+            QCOMPARE(QFileInfo(dataPath + fileNames.at(i)).lastModified().toSecsSinceEpoch(), modified.toSecsSinceEpoch());
+        }
+        QVERIFY(validatorsFile.open(QIODevice::ReadOnly));
+        QCOMPARE(validatorsFile.readAll(), validators);
+        validatorsFile.close();
+    }
+
+    // file and JSON / CBOR decoding - typed, no QVariantList
+    void readJsonArrayFromCache_data() {
+        addCacheFileRows();
+    }
+    void readJsonArrayFromCache() {
+        QFETCH(QString, fileName);
+        QJsonArray cacheArray;
+        QBENCHMARK {
+            cacheArray = mDataManager->readJsonArrayFromCache(fileName);
+        }
+        QVERIFY(!cacheArray.isEmpty());
+    }
+
+    void writeJsonArrayToCache_data() {
+        addCacheFileRows();
+    }
+    void writeJsonArrayToCache() {
+        QFETCH(QString, fileName);
+        const QJsonArray cacheArray = mDataManager->readJsonArrayFromCache(fileName);
+        QVERIFY(!cacheArray.isEmpty());
+        // don't touch the caches used by the app
+        const QString benchmarkFileName = "benchmark_" + fileName;
+        QBENCHMARK {
+            mDataManager->writeJsonArrayToCache(benchmarkFileName, cacheArray);
+        }
+        QFile::remove(mDataManager->dataPath(benchmarkFileName));
+    }
+
+    // DataObjects <-> QJsonObject as used by init...FromCache / save...ToCache
+    void toCacheJson_data() {
+        ensureUpdated();
+        addEntityRows();
+    }
+    void toCacheJson() {
+        QFETCH(QString, entity);
+        QVERIFY(!allOf(entity).isEmpty());
+        QBENCHMARK {
+            toCacheJsonArray(entity);
+        }
+    }
+
+    void fillFromCacheJson_data() {
+        ensureUpdated();
+        addEntityRows();
+    }
+    void fillFromCacheJson() {
+        QFETCH(QString, entity);
+        const QJsonArray cacheArray = toCacheJsonArray(entity);
+        QVERIFY(!cacheArray.isEmpty());
+        QBENCHMARK {
+            fillFromCacheJsonArray(entity, cacheArray);
+        }
+    }
+
+    void toCacheMap_data() {
+        ensureUpdated();
+        addEntityRows();
+    }
+    void toCacheMap() {
+        QFETCH(QString, entity);
+        QVERIFY(!allOf(entity).isEmpty());
+        QBENCHMARK {
+            toCacheMaps(entity);
+        }
+    }
+
+    void fillFromCacheMap_data() {
+        ensureUpdated();
+        addEntityRows();
+    }
+    void fillFromCacheMap() {
+        QFETCH(QString, entity);
+        const QVariantList cacheMaps = toCacheMaps(entity);
+        QVERIFY(!cacheMaps.isEmpty());
+        QBENCHMARK {
+            fillFromCacheMaps(entity, cacheMaps);
+        }
+    }
+
+    // all Sessions of all Days
+    void listOfSessionForKeys() {
+        ensureUpdated();
+        QStringList keys;
+        for (int i = 0; i < mDataManager->mAllDay.size(); ++i) {
+            keys.append(static_cast<Day*>(mDataManager->mAllDay.at(i))->sessionsKeys());
+        }
+        QVERIFY(!keys.isEmpty());
+        int resolved = 0;
+        QBENCHMARK {
+            resolved = mDataManager->listOfSessionForKeys(keys).size();
+        }
+        QCOMPARE(resolved, keys.size());
+    }
+
+    void findById_data() {
+        ensureUpdated();
+        addEntityRows();
+    }
+    void findById() {
+        QFETCH(QString, entity);
+        const QList<int> ids = idsOf(entity);
+        QVERIFY(!ids.isEmpty());
+        int found = 0;
+        QBENCHMARK {
+            found = findAll(entity, ids);
+        }
+        QCOMPARE(found, ids.size());
+    }
+
+    // GoTo time picker: every full hour of every Day
+    void findFirstSessionItem() {
+        ensureUpdated();
+        Conference* conference = mDataUtil->currentConference();
+        QVERIFY(conference);
+        QVERIFY(!conference->days().isEmpty());
+        int found = 0;
+        QBENCHMARK {
+            found = 0;
+            for (int d = 0; d < conference->days().size(); ++d) {
+                for (int hour = 8; hour < 20; ++hour) {
+                    if(mDataUtil->findFirstSessionItem(d, QString("%1:00").arg(hour, 2, 10, QChar('0'))) < conference->days().at(d)->sessionsCount()) {
+                        found++;
+                    }
+                }
+            }
+        }
+        QVERIFY(found > 0);
+    }
+
+    // LetterPicker: every letter
+    void findFirstSpeakerItem() {
+        ensureUpdated();
+        int found = 0;
+        QBENCHMARK {
+            found = 0;
+            for (char letter = 'A'; letter <= 'Z'; ++letter) {
+                if(mDataUtil->findFirstSpeakerItem(QString(QChar(letter))) < mDataManager->mAllSpeaker.size()) {
+                    found++;
+                }
+            }
+        }
+        QVERIFY(found > 0);
+        QVERIFY(!mDataUtil->speakerLetters().isEmpty());
+    }
+
+    // every 4th Session of current Conference is a Favorite
+    void rebuildMySchedule() {
+        ensureUpdated();
+        Conference* conference = mDataUtil->currentConference();
+        QVERIFY(conference);
+        for (int d = 0; d < conference->days().size(); ++d) {
+            Day* day = conference->days().at(d);
+            for (int s = 0; s < day->sessions().size(); s += 4) {
+                day->sessions().at(s)->setIsFavorite(true);
+            }
+        }
+        // full build, refreshMySchedule() only builds once per conference
+        QBENCHMARK {
+            mDataUtil->rebuildMySchedule();
+        }
+        QVERIFY(mDataUtil->mySchedule()->scheduledSessionsCount() > 0);
+    }
+
+    // incremental: binary search, one Session inserted or removed
+    void toggleFavorite() {
+        ensureUpdated();
+        mDataUtil->refreshMySchedule();
+        Conference* conference = mDataUtil->currentConference();
+        QVERIFY(conference);
+        QVERIFY(!conference->days().isEmpty());
+        Day* day = conference->days().at(conference->days().size() / 2);
+        QVERIFY(!day->sessions().isEmpty());
+        Session* session = day->sessions().at(day->sessions().size() / 2);
+        const int scheduled = mDataUtil->mySchedule()->scheduledSessionsCount();
+        QBENCHMARK {
+            session->setIsFavorite(!session->isFavorite());
+            session->setIsFavorite(!session->isFavorite());
+        }
+        QCOMPARE(mDataUtil->mySchedule()->scheduledSessionsCount(), scheduled);
+    }
+
+    void buildSearchIndex() {
+        ensureUpdated();
+        QBENCHMARK {
+            mDataUtil->buildSearchIndex();
+        }
+        QVERIFY(!mDataUtil->mSearchIndex.isEmpty());
+    }
+
+    // search-as-you-type: short prefixes match most records
+    void search_data() {
+        QTest::addColumn<QString>("query");
+        QTest::newRow("one letter") << "q";
+        QTest::newRow("prefix") << "aut";
+        QTest::newRow("word") << "qml";
+        QTest::newRow("two words") << "qt quick";
+        QTest::newRow("diacritics") << "MÜLLER";
+        QTest::newRow("no match") << "xyzzy";
+    }
+    void search() {
+        QFETCH(QString, query);
+        ensureUpdated();
+        if(mDataUtil->mSearchIndex.isEmpty()) {
+            mDataUtil->buildSearchIndex();
+        }
+        QBENCHMARK {
+            mDataUtil->mSearchIndex.search(query, 100);
+        }
+    }
+};
+
+QTEST_MAIN(DataLayerBenchmark)
+
+#include "tst_datalayerbenchmark.moc"
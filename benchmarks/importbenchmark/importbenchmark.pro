@@ -0,0 +1,44 @@
+# benchmark: import of server data (schedule, speaker)
+# direct JSON import (ScheduleImporter) compared with the former QVariant path
+# run: ./importbenchmark -platform offscreen
+# other data (per ex. generated large conference): set IMPORT_BENCHMARK_DATA to the directory
+TEMPLATE = app
+TARGET = importbenchmark
+
+QT += qml core testlib
+QT -= gui
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+APP_DIR = $$PWD/../..
+INCLUDEPATH += $$APP_DIR/cpp
+
+DEFINES += IMPORT_BENCHMARK_FIXTURES=\\\"$$APP_DIR/data-assets/conference/\\\"
+
+HEADERS += \
+    $$APP_DIR/cpp/scheduleimporter.hpp \
+    $$APP_DIR/cpp/gen/Session.hpp \
+    $$APP_DIR/cpp/gen/Speaker.hpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.hpp \
+    $$APP_DIR/cpp/gen/SessionTrack.hpp \
+    $$APP_DIR/cpp/gen/Day.hpp \
+    $$APP_DIR/cpp/gen/Conference.hpp \
+    $$APP_DIR/cpp/gen/Room.hpp \
+    $$APP_DIR/cpp/gen/SessionAPI.hpp \
+    $$APP_DIR/cpp/gen/SpeakerAPI.hpp \
+    $$APP_DIR/cpp/gen/PersonsAPI.hpp \
+    $$APP_DIR/cpp/gen/SessionTrackAPI.hpp
+
+SOURCES += tst_importbenchmark.cpp \
+    $$APP_DIR/cpp/scheduleimporter.cpp \
+    $$APP_DIR/cpp/gen/Session.cpp \
+    $$APP_DIR/cpp/gen/Speaker.cpp \
+    $$APP_DIR/cpp/gen/SpeakerImage.cpp \
+    $$APP_DIR/cpp/gen/SessionTrack.cpp \
+    $$APP_DIR/cpp/gen/Day.cpp \
+    $$APP_DIR/cpp/gen/Conference.cpp \
+    $$APP_DIR/cpp/gen/Room.cpp \
+    $$APP_DIR/cpp/gen/SessionAPI.cpp \
+    $$APP_DIR/cpp/gen/SpeakerAPI.cpp \
+    $$APP_DIR/cpp/gen/PersonsAPI.cpp \
+    $$APP_DIR/cpp/gen/SessionTrackAPI.cpp
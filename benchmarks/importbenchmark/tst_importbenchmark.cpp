@@ -0,0 +1,166 @@
+#include <QtTest>
+#include <QJsonDocument>
+
+#include "scheduleimporter.hpp"
+#include "gen/Session.hpp"
+#include "gen/SessionAPI.hpp"
+#include "gen/SpeakerAPI.hpp"
+
+/*
+ * former import path (until direct JSON import):
+ * JSON -> QVariantMap -> adjustPersons() -> SessionAPI::fillFromForeignMap()
+ * -> SessionAPI::toMap() -> Session::fillFromMap()
+ * kept here as reference to compare speed and results
+ */
+class VariantImport
+{
+public:
+    static QVariantMap readMap(const QString path) {
+        QFile readFile(path);
+        if (!readFile.open(QIODevice::ReadOnly)) {
+            return QVariantMap();
+        }
+        return QJsonDocument::fromJson(readFile.readAll()).toVariant().toMap();
+    }
+    static QVariantList readList(const QString path) {
+        QFile readFile(path);
+        if (!readFile.open(QIODevice::ReadOnly)) {
+            return QVariantList();
+        }
+        return QJsonDocument::fromJson(readFile.readAll()).toVariant().toList();
+    }
+    static void adjustPersons(QVariantMap& sessionMap) {
+        QStringList personKeys;
+        QVariantList personsList = sessionMap.value("persons").toList();
+        if (!personsList.empty()) {
+            for (int pvl = 0; pvl < personsList.size(); ++pvl) {
+                QVariantMap map = personsList.at(pvl).toMap();
+                if(map.contains("id")) {
+                    personKeys.append(map.value("id").toString());
+                }
+            }
+            sessionMap.insert("persons", personKeys);
+        }
+    }
+    // returns number of speaker
+    static int importSpeaker(const QString speakerPath) {
+        QVariantList dataList = readList(speakerPath);
+        for (int i = 0; i < dataList.size(); ++i) {
+            SpeakerAPI speakerAPI;
+            speakerAPI.fillFromForeignMap(dataList.at(i).toMap());
+        }
+        return dataList.size();
+    }
+    // Sessions are created with parent
+    static void importSessions(const QString schedulePath, const QStringList& dayDates, QObject* parent, QList<Session*>& sessions) {
+        QVariantMap allDaysMap = readMap(schedulePath).value("conference").toMap().value("days").toMap();
+        for (int d = 0; d < dayDates.size(); ++d) {
+            QVariantMap roomMap = allDaysMap.value(dayDates.at(d)).toMap().value("rooms").toMap();
+            QStringList roomKeys = roomMap.keys();
+            for (int r = 0; r < roomKeys.size(); ++r) {
+                QVariantList sessionList = roomMap.value(roomKeys.at(r)).toList();
+                for (int sl = 0; sl < sessionList.size(); ++sl) {
+                    QVariantMap sessionMap = sessionList.at(sl).toMap();
+                    adjustPersons(sessionMap);
+                    sessionMap.remove("tracks");
+                    SessionAPI sessionAPI;
+                    sessionAPI.fillFromForeignMap(sessionMap);
+                    Session* session = new Session(parent);
+                    session->fillFromMap(sessionAPI.toMap());
+                    sessions.append(session);
+                }
+            }
+        }
+    }
+};
+
+class ImportBenchmark : public QObject
+{
+    Q_OBJECT
+
+private:
+    QString mDataPath;
+    QList<ScheduleSource> mSources;
+
+    void importDirect(QObject* parent, QList<Session*>& sessions) {
+        ScheduleImporter importer;
+        ScheduleImport result = importer.importAll(mDataPath, mSources);
+        QVERIFY2(result.isValid(), qPrintable(result.errorMessage));
+        for (int s = 0; s < result.schedules.size(); ++s) {
+            const ImportedSchedule& schedule = result.schedules.at(s);
+            for (int d = 0; d < schedule.days.size(); ++d) {
+                for (int r = 0; r < schedule.days.at(d).rooms.size(); ++r) {
+                    const ImportedRoom& room = schedule.days.at(d).rooms.at(r);
+                    for (int i = 0; i < room.sessions.size(); ++i) {
+                        Session* session = new Session(parent);
+                        ScheduleImporter::fillSession(session, room.sessions.at(i));
+                        sessions.append(session);
+                    }
+                }
+            }
+        }
+    }
+    void importVariant(QObject* parent, QList<Session*>& sessions) {
+        QVERIFY(VariantImport::importSpeaker(mDataPath + "speaker.json") > 0);
+        for (int s = 0; s < mSources.size(); ++s) {
+            const QString schedulePath = mDataPath + "schedule_"+QString::number(mSources.at(s).conferenceId)+".json";
+            VariantImport::importSessions(schedulePath, mSources.at(s).dayDates, parent, sessions);
+        }
+    }
+
+private slots:
+    void initTestCase() {
+        mDataPath = qEnvironmentVariable("IMPORT_BENCHMARK_DATA", IMPORT_BENCHMARK_FIXTURES);
+        if(!mDataPath.endsWith("/")) {
+            mDataPath.append("/");
+        }
+        QVERIFY2(QFile::exists(mDataPath + "speaker.json"), qPrintable(mDataPath));
+        ScheduleSource source;
+        source.conferenceId = 201801;
+        source.city = "BOSTON";
+        source.location = "Boston";
+        source.dayDates << "2018-10-29" << "2018-10-30";
+        mSources.append(source);
+        source.conferenceId = 201802;
+        source.city = "BERLIN";
+        source.location = "Berlin";
+        source.dayDates.clear();
+        source.dayDates << "2018-12-05" << "2018-12-06";
+        mSources.append(source);
+    }
+
+    // both paths must create the same Sessions
+    void sameResult() {
+        QObject variantParent;
+        QList<Session*> variantSessions;
+        importVariant(&variantParent, variantSessions);
+        QObject directParent;
+        QList<Session*> directSessions;
+        importDirect(&directParent, directSessions);
+        QCOMPARE(directSessions.size(), variantSessions.size());
+        QVERIFY(!directSessions.isEmpty());
+        for (int i = 0; i < directSessions.size(); ++i) {
+            QCOMPARE(directSessions.at(i)->toCacheMap(), variantSessions.at(i)->toCacheMap());
+        }
+    }
+
+    void variantImport() {
+        QBENCHMARK {
+            QObject parent;
+            QList<Session*> sessions;
+            importVariant(&parent, sessions);
+        }
+    }
+
+    void directImport() {
+        QBENCHMARK {
+            QObject parent;
+            QList<Session*> sessions;
+            importDirect(&parent, sessions);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(ImportBenchmark)
+
+#include "tst_importbenchmark.moc"
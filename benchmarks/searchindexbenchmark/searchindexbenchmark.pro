@@ -0,0 +1,19 @@
+# benchmark: search-as-you-type over SearchIndex
+# checks folding, prefix matching and AND semantics, then times search() on generated records
+# run: ./searchindexbenchmark
+TEMPLATE = app
+TARGET = searchindexbenchmark
+
+QT += core testlib
+QT -= gui
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+APP_DIR = $$PWD/../..
+INCLUDEPATH += $$APP_DIR/cpp
+
+HEADERS += \
+    $$APP_DIR/cpp/searchindex.hpp
+
+SOURCES += tst_searchindexbenchmark.cpp \
+    $$APP_DIR/cpp/searchindex.cpp
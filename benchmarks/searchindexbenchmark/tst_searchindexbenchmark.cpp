@@ -0,0 +1,127 @@
+#include <QtTest>
+
+#include "searchindex.hpp"
+
+class SearchIndexBenchmark : public QObject
+{
+    Q_OBJECT
+
+private:
+    SearchIndex mIndex;
+
+    static QList<int> idsOf(const QList<SearchIndex::Hit>& hits) {
+        QList<int> ids;
+        for (int i = 0; i < hits.size(); ++i) {
+            ids.append(hits.at(i).id);
+        }
+        return ids;
+    }
+
+    static QList<int> idsFor(const SearchIndex& index, const QString& query) {
+        return idsOf(index.search(query, 100));
+    }
+
+private slots:
+    void initTestCase() {
+        // large conference: 20000 records with 12 words out of 2000
+        for (int i = 0; i < 20000; ++i) {
+            QStringList words;
+            for (int w = 0; w < 12; ++w) {
+                words << QString("word%1").arg((i * 7 + w * 131) % 2000);
+            }
+            mIndex.insert(SearchIndex::SessionRecord, i, QStringList(words.join(' ')));
+        }
+    }
+
+    void fold_data() {
+        QTest::addColumn<QString>("text");
+        QTest::addColumn<QString>("folded");
+        QTest::newRow("case") << "QtQuick" << "qtquick";
+        QTest::newRow("umlaut") << QString::fromUtf8("Müller") << "muller";
+        QTest::newRow("accent") << QString::fromUtf8("ÉCOLE") << "ecole";
+        QTest::newRow("sharp s") << QString::fromUtf8("Straße") << "strasse";
+        QTest::newRow("unchanged") << "c++ 2018" << "c++ 2018";
+    }
+    void fold() {
+        QFETCH(QString, text);
+        QFETCH(QString, folded);
+        QCOMPARE(SearchIndex::fold(text), folded);
+    }
+
+    void terms() {
+        QCOMPARE(SearchIndex::terms(QString::fromUtf8("Qt Quick: qt & Müller-Lüdenscheidt")),
+                 QStringList() << "qt" << "quick" << "muller" << "ludenscheidt");
+        QVERIFY(SearchIndex::terms(" -- ").isEmpty());
+    }
+
+    void prefix() {
+        SearchIndex index;
+        index.insert(SearchIndex::SessionRecord, 1, QStringList() << "Qt Quick Controls");
+        index.insert(SearchIndex::SessionRecord, 2, QStringList() << "Qt Widgets");
+        index.insert(SearchIndex::SpeakerRecord, 3, QStringList() << QString::fromUtf8("Jörg Müller"));
+        QCOMPARE(idsFor(index, "qu"), QList<int>() << 1);
+        QCOMPARE(idsFor(index, "QT"), QList<int>() << 1 << 2);
+        QCOMPARE(idsFor(index, "mull"), QList<int>() << 3);
+        QCOMPARE(idsFor(index, QString::fromUtf8("Mül")), QList<int>() << 3);
+        // prefix only: no substring match
+        QVERIFY(idsFor(index, "uick").isEmpty());
+        QVERIFY(idsFor(index, "").isEmpty());
+    }
+
+    void allTermsMustMatch() {
+        SearchIndex index;
+        index.insert(SearchIndex::SessionRecord, 1, QStringList() << "Qt Quick" << "Boston");
+        index.insert(SearchIndex::SessionRecord, 2, QStringList() << "Qt Quick" << "Berlin");
+        index.insert(SearchIndex::RoomRecord, 3, QStringList() << "Berlin");
+        QCOMPARE(idsFor(index, "quick ber"), QList<int>() << 2);
+        QCOMPARE(idsFor(index, "ber"), QList<int>() << 2 << 3);
+        // terms from different texts of the same record
+        QCOMPARE(idsFor(index, "boston qt"), QList<int>() << 1);
+        QVERIFY(idsFor(index, "quick munich").isEmpty());
+    }
+
+    void insertReplacesRemoveDrops() {
+        SearchIndex index;
+        index.insert(SearchIndex::SessionRecord, 1, QStringList() << "Qt Quick");
+        index.insert(SearchIndex::SessionRecord, 2, QStringList() << "Qt 3D");
+        index.insert(SearchIndex::SessionRecord, 1, QStringList() << "Qt Widgets");
+        QCOMPARE(index.size(), 2);
+        QVERIFY(idsFor(index, "quick").isEmpty());
+        // replaced record gets a new slot at the end
+        QCOMPARE(idsFor(index, "qt"), QList<int>() << 2 << 1);
+        index.remove(SearchIndex::SessionRecord, 2);
+        QVERIFY(!index.contains(SearchIndex::SessionRecord, 2));
+        QCOMPARE(idsFor(index, "qt"), QList<int>() << 1);
+        // same id, other kind: other record
+        index.insert(SearchIndex::SpeakerRecord, 1, QStringList() << "Qt");
+        QCOMPARE(index.size(), 2);
+    }
+
+    void totalHits() {
+        SearchIndex index;
+        for (int i = 0; i < 10; ++i) {
+            index.insert(SearchIndex::SessionRecord, i, QStringList() << "Qt");
+        }
+        int total = 0;
+        QCOMPARE(index.search("qt", 3, &total).size(), 3);
+        QCOMPARE(total, 10);
+    }
+
+    void search_data() {
+        QTest::addColumn<QString>("query");
+        QTest::newRow("one char") << "w";
+        QTest::newRow("prefix") << "word1";
+        QTest::newRow("term") << "word1234";
+        QTest::newRow("and") << "word1 word2";
+    }
+    void search() {
+        QFETCH(QString, query);
+        QBENCHMARK {
+            mIndex.search(query, 50);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(SearchIndexBenchmark)
+
+#include "tst_searchindexbenchmark.moc"
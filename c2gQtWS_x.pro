@@ -2,7 +2,7 @@
 TEMPLATE = app
 TARGET = c2gQtWS_x
 
-QT += qml quick core network
+QT += qml quick core network concurrent
 CONFIG += c++11
 
 include(../statusbar/src/statusbar.pri)
@@ -28,7 +28,20 @@ HEADERS += \
     cpp/gen/SessionTrackAPI.hpp \
     cpp/gen/SessionLists.hpp \
     cpp/dataserver.hpp \
-    cpp/unsafearea.hpp
+    cpp/unsafearea.hpp \
+    cpp/cachesnapshot.hpp \
+    cpp/updatechangeset.hpp \
+    cpp/scheduleimporter.hpp \
+    cpp/imagedownloadscheduler.hpp \
+    cpp/highdpiimages.hpp \
+    cpp/networkservice.hpp \
+    cpp/cacheformat.hpp \
+    cpp/cachekeys.hpp \
+    cpp/startupprofiler.hpp \
+    cpp/searchindex.hpp \
+    cpp/searchresultmodel.hpp \
+    cpp/sessionlistmodel.hpp \
+    cpp/daytimeindex.hpp
 
 SOURCES += cpp/main.cpp \
     cpp/applicationui.cpp \
@@ -50,7 +63,22 @@ SOURCES += cpp/main.cpp \
     cpp/gen/SessionTrackAPI.cpp \
     cpp/gen/SessionLists.cpp \
     cpp/dataserver.cpp \
-    cpp/unsafearea.cpp
+    cpp/unsafearea.cpp \
+    cpp/cachesnapshot.cpp \
+    cpp/scheduleimporter.cpp \
+    cpp/imagedownloadscheduler.cpp \
+    cpp/highdpiimages.cpp \
+    cpp/networkservice.cpp \
+    cpp/cacheformat.cpp \
+    cpp/cachejson.cpp \
+    cpp/cachecbor.cpp \
+    cpp/cachedatastream.cpp \
+    cpp/datamanagersnapshot.cpp \
+    cpp/startupprofiler.cpp \
+    cpp/searchindex.cpp \
+    cpp/searchresultmodel.cpp \
+    cpp/sessionlistmodel.cpp \
+    cpp/daytimeindex.cpp
 
 lupdate_only {
     SOURCES +=  qml/main.qml \
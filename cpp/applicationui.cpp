@@ -37,6 +37,7 @@ void ApplicationUI::addContextProperty(QQmlContext *context)
     context->setContextProperty("dataUtil", mDataUtil);
     context->setContextProperty("dataServer", mDataServer);
     context->setContextProperty("unsafeArea", mUnsafeArea);
+    context->setContextProperty("searchModel", mDataUtil->searchModel());
 }
 
 /* Change Theme Palette */
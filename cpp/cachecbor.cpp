@@ -0,0 +1,898 @@
+/*
+ * CBOR cache serializers of the data objects:
+ * fillFromCacheCbor() / toCacheCbor() declared in cpp/gen/*.hpp
+ *
+ * not generated - same as cachejson.cpp (see gen-model/README.md)
+ *
+ * same keys and values as toCacheJson(), but streamed:
+ * QCborStreamReader / QCborStreamWriter work directly on the typed fields,
+ * there's no QCborValue, QJsonObject or QJsonArray in between
+ * used by CacheFormat::encodeObjects() / decodeObjects() if SettingsData useCborCache
+ *
+ * files written from a QJsonArray (CacheFormat::encode) can be read here too:
+ * numbers may come as integer or double, lazy keys as integer or string
+ */
+#include "cachekeys.hpp"
+
+#include "gen/Conference.hpp"
+#include "gen/Day.hpp"
+#include "gen/Favorite.hpp"
+#include "gen/Room.hpp"
+#include "gen/Session.hpp"
+#include "gen/SessionLists.hpp"
+#include "gen/SessionTrack.hpp"
+#include "gen/Speaker.hpp"
+#include "gen/SpeakerImage.hpp"
+
+#include <QUuid>
+#include <QDebug>
+
+// reads the current text string (all chunks) - other types are skipped
+static QString readCborString(QCborStreamReader& reader)
+{
+    QString text;
+    if (!reader.isString()) {
+        reader.next();
+        return text;
+    }
+    QCborStreamReader::StringResult<QString> chunk = reader.readString();
+    while (chunk.status == QCborStreamReader::Ok) {
+        text += chunk.data;
+        chunk = reader.readString();
+    }
+    return text;
+}
+
+static int readCborInt(QCborStreamReader& reader)
+{
+    int value = 0;
+    if (reader.isInteger()) {
+        value = int(reader.toInteger());
+    } else if (reader.isDouble()) {
+        value = int(reader.toDouble());
+    }
+    reader.next();
+    return value;
+}
+
+static bool readCborBool(QCborStreamReader& reader)
+{
+    const bool value = reader.isBool() && reader.toBool();
+    reader.next();
+    return value;
+}
+
+static QDate readCborDate(QCborStreamReader& reader)
+{
+    const QString dateAsString = readCborString(reader);
+    const QDate date = QDate::fromString(dateAsString, "yyyy-MM-dd");
+    if (!date.isValid()) {
+        qDebug() << "Date is not valid for String: " << dateAsString;
+        return QDate();
+    }
+    return date;
+}
+
+static QTime readCborTime(QCborStreamReader& reader)
+{
+    const QString timeAsString = readCborString(reader);
+    const QTime time = QTime::fromString(timeAsString, "HH:mm");
+    if (!time.isValid()) {
+        qDebug() << "Time is not valid for String: " << timeAsString;
+        return QTime();
+    }
+    return time;
+}
+
+// lazy arrays persist only the keys
+static QStringList readCborKeys(QCborStreamReader& reader)
+{
+    QStringList keys;
+    if (!reader.isArray()) {
+        reader.next();
+        return keys;
+    }
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        if (reader.isInteger()) {
+            keys << QString::number(reader.toInteger());
+            reader.next();
+        } else if (reader.isDouble()) {
+            keys << QString::number(int(reader.toDouble()));
+            reader.next();
+        } else {
+            keys << readCborString(reader);
+        }
+    }
+    if (reader.lastError() == QCborError::NoError) {
+        reader.leaveContainer();
+    }
+    return keys;
+}
+
+// each record is a map: key (text string), value
+static bool enterCborMap(QCborStreamReader& reader)
+{
+    if (!reader.isMap()) {
+        qWarning() << "CBOR cache record is not a Map";
+        reader.next();
+        return false;
+    }
+    return reader.enterContainer();
+}
+
+static bool hasNextCborEntry(QCborStreamReader& reader)
+{
+    return reader.lastError() == QCborError::NoError && reader.hasNext();
+}
+
+static void leaveCborMap(QCborStreamReader& reader)
+{
+    if (reader.lastError() == QCborError::NoError) {
+        reader.leaveContainer();
+    }
+}
+
+static void appendCborKeys(QCborStreamWriter& writer, const QLatin1String key, const QStringList& keys)
+{
+    writer.append(key);
+    writer.startArray(keys.size());
+    for (int i = 0; i < keys.size(); ++i) {
+        writer.append(keys.at(i));
+    }
+    writer.endArray();
+}
+
+/*
+ * Conference
+ * missing entries get the same values as from fillFromCacheJson()
+ */
+void Conference::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mId = 0;
+    mConferenceName.clear();
+    mConferenceCity.clear();
+    mAddress.clear();
+    mMapAddress.clear();
+    mTimeZoneName.clear();
+    mTimeZoneOffsetSeconds = 0;
+    mHashTag.clear();
+    mHomePage.clear();
+    mCoordinate.clear();
+    mPlaceId.clear();
+    mLastRoomId = 0;
+    mLastSessionTrackId = 0;
+    mLastGenericSessionId = 0;
+    mDaysKeys.clear();
+    mTracksKeys.clear();
+    mRoomsKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == ConferenceCacheKeys::id) {
+                mId = readCborInt(reader);
+            } else if (key == ConferenceCacheKeys::conferenceName) {
+                mConferenceName = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::conferenceCity) {
+                mConferenceCity = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::address) {
+                mAddress = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::mapAddress) {
+                mMapAddress = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::timeZoneName) {
+                mTimeZoneName = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::timeZoneOffsetSeconds) {
+                mTimeZoneOffsetSeconds = readCborInt(reader);
+            } else if (key == ConferenceCacheKeys::conferenceFrom) {
+                mConferenceFrom = readCborDate(reader);
+            } else if (key == ConferenceCacheKeys::conferenceTo) {
+                mConferenceTo = readCborDate(reader);
+            } else if (key == ConferenceCacheKeys::hashTag) {
+                mHashTag = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::homePage) {
+                mHomePage = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::coordinate) {
+                mCoordinate = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::placeId) {
+                mPlaceId = readCborString(reader);
+            } else if (key == ConferenceCacheKeys::lastRoomId) {
+                mLastRoomId = readCborInt(reader);
+            } else if (key == ConferenceCacheKeys::lastSessionTrackId) {
+                mLastSessionTrackId = readCborInt(reader);
+            } else if (key == ConferenceCacheKeys::lastGenericSessionId) {
+                mLastGenericSessionId = readCborInt(reader);
+            } else if (key == ConferenceCacheKeys::days) {
+                mDaysKeys = readCborKeys(reader);
+            } else if (key == ConferenceCacheKeys::tracks) {
+                mTracksKeys = readCborKeys(reader);
+            } else if (key == ConferenceCacheKeys::rooms) {
+                mRoomsKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    // lazy arrays must be resolved later if there are keys
+    mDaysKeysResolved = mDaysKeys.isEmpty();
+    mDays.clear();
+    mTracksKeysResolved = mTracksKeys.isEmpty();
+    mTracks.clear();
+    mRoomsKeysResolved = mRoomsKeys.isEmpty();
+    mRooms.clear();
+    mIsDirty = false;
+}
+
+/*
+ * lazy arrays: same keys as toCacheJson()
+ */
+void Conference::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mDaysKeysResolved) {
+        mDaysKeys.clear();
+    }
+    for (int i = 0; i < mDays.size(); ++i) {
+        mDaysKeys << QString::number(mDays.at(i)->id());
+    }
+    appendCborKeys(writer, ConferenceCacheKeys::days, mDaysKeys);
+    if (mTracksKeysResolved) {
+        mTracksKeys.clear();
+    }
+    for (int i = 0; i < mTracks.size(); ++i) {
+        mTracksKeys << QString::number(mTracks.at(i)->trackId());
+    }
+    appendCborKeys(writer, ConferenceCacheKeys::tracks, mTracksKeys);
+    if (mRoomsKeysResolved) {
+        mRoomsKeys.clear();
+    }
+    for (int i = 0; i < mRooms.size(); ++i) {
+        mRoomsKeys << QString::number(mRooms.at(i)->roomId());
+    }
+    appendCborKeys(writer, ConferenceCacheKeys::rooms, mRoomsKeys);
+    writer.append(ConferenceCacheKeys::id);
+    writer.append(qint64(mId));
+    writer.append(ConferenceCacheKeys::conferenceName);
+    writer.append(mConferenceName);
+    writer.append(ConferenceCacheKeys::conferenceCity);
+    writer.append(mConferenceCity);
+    writer.append(ConferenceCacheKeys::address);
+    writer.append(mAddress);
+    writer.append(ConferenceCacheKeys::mapAddress);
+    writer.append(mMapAddress);
+    writer.append(ConferenceCacheKeys::timeZoneName);
+    writer.append(mTimeZoneName);
+    writer.append(ConferenceCacheKeys::timeZoneOffsetSeconds);
+    writer.append(qint64(mTimeZoneOffsetSeconds));
+    if (hasConferenceFrom()) {
+        writer.append(ConferenceCacheKeys::conferenceFrom);
+        writer.append(mConferenceFrom.toString("yyyy-MM-dd"));
+    }
+    if (hasConferenceTo()) {
+        writer.append(ConferenceCacheKeys::conferenceTo);
+        writer.append(mConferenceTo.toString("yyyy-MM-dd"));
+    }
+    writer.append(ConferenceCacheKeys::hashTag);
+    writer.append(mHashTag);
+    writer.append(ConferenceCacheKeys::homePage);
+    writer.append(mHomePage);
+    writer.append(ConferenceCacheKeys::coordinate);
+    writer.append(mCoordinate);
+    writer.append(ConferenceCacheKeys::placeId);
+    writer.append(mPlaceId);
+    writer.append(ConferenceCacheKeys::lastRoomId);
+    writer.append(qint64(mLastRoomId));
+    writer.append(ConferenceCacheKeys::lastSessionTrackId);
+    writer.append(qint64(mLastSessionTrackId));
+    writer.append(ConferenceCacheKeys::lastGenericSessionId);
+    writer.append(qint64(mLastGenericSessionId));
+    writer.endMap();
+}
+
+/*
+ * Day
+ */
+void Day::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mId = 0;
+    mConference = 0;
+    mWeekDay = 0;
+    mSessionsKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == DayCacheKeys::id) {
+                mId = readCborInt(reader);
+            } else if (key == DayCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == DayCacheKeys::weekDay) {
+                mWeekDay = readCborInt(reader);
+            } else if (key == DayCacheKeys::conferenceDay) {
+                mConferenceDay = readCborDate(reader);
+            } else if (key == DayCacheKeys::sessions) {
+                mSessionsKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+void Day::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, DayCacheKeys::sessions, mSessionsKeys);
+    writer.append(DayCacheKeys::id);
+    writer.append(qint64(mId));
+    writer.append(DayCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.append(DayCacheKeys::weekDay);
+    writer.append(qint64(mWeekDay));
+    if (hasConferenceDay()) {
+        writer.append(DayCacheKeys::conferenceDay);
+        writer.append(mConferenceDay.toString("yyyy-MM-dd"));
+    }
+    writer.endMap();
+}
+
+/*
+ * Favorite
+ */
+void Favorite::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mSessionId = 0;
+    mConference = 0;
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == FavoriteCacheKeys::sessionId) {
+                mSessionId = readCborInt(reader);
+            } else if (key == FavoriteCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == FavoriteCacheKeys::session) {
+                // session lazy pointing to Session* (domainKey: sessionId)
+                mSession = readCborInt(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mIsDirty = false;
+}
+
+void Favorite::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSession != -1) {
+        writer.append(FavoriteCacheKeys::session);
+        writer.append(qint64(mSession));
+    }
+    writer.append(FavoriteCacheKeys::sessionId);
+    writer.append(qint64(mSessionId));
+    writer.append(FavoriteCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.endMap();
+}
+
+/*
+ * Room
+ */
+void Room::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mRoomId = 0;
+    mConference = 0;
+    mRoomName.clear();
+    mInAssets = false;
+    mSessionsKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == RoomCacheKeys::roomId) {
+                mRoomId = readCborInt(reader);
+            } else if (key == RoomCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == RoomCacheKeys::roomName) {
+                mRoomName = readCborString(reader);
+            } else if (key == RoomCacheKeys::inAssets) {
+                mInAssets = readCborBool(reader);
+            } else if (key == RoomCacheKeys::sessions) {
+                mSessionsKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+void Room::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, RoomCacheKeys::sessions, mSessionsKeys);
+    writer.append(RoomCacheKeys::roomId);
+    writer.append(qint64(mRoomId));
+    writer.append(RoomCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.append(RoomCacheKeys::roomName);
+    writer.append(mRoomName);
+    writer.append(RoomCacheKeys::inAssets);
+    writer.append(mInAssets);
+    writer.endMap();
+}
+
+/*
+ * Session
+ * mIsFavorite is transient: not cached
+ */
+void Session::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mSessionId = 0;
+    mConference = 0;
+    mIsDeprecated = false;
+    mSortKey.clear();
+    mIsTraining = false;
+    mIsLightning = false;
+    mIsKeynote = false;
+    mIsSession = false;
+    mIsCommunity = false;
+    mIsUnconference = false;
+    mIsMeeting = false;
+    mIsGenericScheduleSession = false;
+    mIsBreak = false;
+    mIsLunch = false;
+    mIsEvent = false;
+    mIsRegistration = false;
+    mTitle.clear();
+    mDescription.clear();
+    mSessionType.clear();
+    mMinutes = 0;
+    mAbstractText.clear();
+    mPresenterKeys.clear();
+    mSessionTracksKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == SessionCacheKeys::sessionId) {
+                mSessionId = readCborInt(reader);
+            } else if (key == SessionCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == SessionCacheKeys::isDeprecated) {
+                mIsDeprecated = readCborBool(reader);
+            } else if (key == SessionCacheKeys::sortKey) {
+                mSortKey = readCborString(reader);
+            } else if (key == SessionCacheKeys::isTraining) {
+                mIsTraining = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isLightning) {
+                mIsLightning = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isKeynote) {
+                mIsKeynote = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isSession) {
+                mIsSession = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isCommunity) {
+                mIsCommunity = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isUnconference) {
+                mIsUnconference = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isMeeting) {
+                mIsMeeting = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isGenericScheduleSession) {
+                mIsGenericScheduleSession = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isBreak) {
+                mIsBreak = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isLunch) {
+                mIsLunch = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isEvent) {
+                mIsEvent = readCborBool(reader);
+            } else if (key == SessionCacheKeys::isRegistration) {
+                mIsRegistration = readCborBool(reader);
+            } else if (key == SessionCacheKeys::title) {
+                mTitle = readCborString(reader);
+            } else if (key == SessionCacheKeys::description) {
+                mDescription = readCborString(reader);
+            } else if (key == SessionCacheKeys::sessionType) {
+                mSessionType = readCborString(reader);
+            } else if (key == SessionCacheKeys::startTime) {
+                mStartTime = readCborTime(reader);
+            } else if (key == SessionCacheKeys::endTime) {
+                mEndTime = readCborTime(reader);
+            } else if (key == SessionCacheKeys::minutes) {
+                mMinutes = readCborInt(reader);
+            } else if (key == SessionCacheKeys::abstractText) {
+                mAbstractText = readCborString(reader);
+            } else if (key == SessionCacheKeys::sessionDay) {
+                // lazy: Day* resolved on demand from DataManager
+                mSessionDay = readCborInt(reader);
+            } else if (key == SessionCacheKeys::room) {
+                // lazy: Room* resolved on demand from DataManager
+                mRoom = readCborInt(reader);
+            } else if (key == SessionCacheKeys::presenter) {
+                mPresenterKeys = readCborKeys(reader);
+            } else if (key == SessionCacheKeys::sessionTracks) {
+                mSessionTracksKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mPresenterKeysResolved = mPresenterKeys.isEmpty();
+    mPresenter.clear();
+    mSessionTracksKeysResolved = mSessionTracksKeys.isEmpty();
+    mSessionTracks.clear();
+    mIsDirty = false;
+}
+
+void Session::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSessionDay != -1) {
+        writer.append(SessionCacheKeys::sessionDay);
+        writer.append(qint64(mSessionDay));
+    }
+    if (mRoom != -1) {
+        writer.append(SessionCacheKeys::room);
+        writer.append(qint64(mRoom));
+    }
+    if (mPresenterKeysResolved) {
+        mPresenterKeys.clear();
+    }
+    for (int i = 0; i < mPresenter.size(); ++i) {
+        mPresenterKeys << QString::number(mPresenter.at(i)->speakerId());
+    }
+    appendCborKeys(writer, SessionCacheKeys::presenter, mPresenterKeys);
+    if (mSessionTracksKeysResolved) {
+        mSessionTracksKeys.clear();
+    }
+    for (int i = 0; i < mSessionTracks.size(); ++i) {
+        mSessionTracksKeys << QString::number(mSessionTracks.at(i)->trackId());
+    }
+    appendCborKeys(writer, SessionCacheKeys::sessionTracks, mSessionTracksKeys);
+    writer.append(SessionCacheKeys::sessionId);
+    writer.append(qint64(mSessionId));
+    writer.append(SessionCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.append(SessionCacheKeys::isDeprecated);
+    writer.append(mIsDeprecated);
+    writer.append(SessionCacheKeys::sortKey);
+    writer.append(mSortKey);
+    writer.append(SessionCacheKeys::isTraining);
+    writer.append(mIsTraining);
+    writer.append(SessionCacheKeys::isLightning);
+    writer.append(mIsLightning);
+    writer.append(SessionCacheKeys::isKeynote);
+    writer.append(mIsKeynote);
+    writer.append(SessionCacheKeys::isSession);
+    writer.append(mIsSession);
+    writer.append(SessionCacheKeys::isCommunity);
+    writer.append(mIsCommunity);
+    writer.append(SessionCacheKeys::isUnconference);
+    writer.append(mIsUnconference);
+    writer.append(SessionCacheKeys::isMeeting);
+    writer.append(mIsMeeting);
+    writer.append(SessionCacheKeys::isGenericScheduleSession);
+    writer.append(mIsGenericScheduleSession);
+    writer.append(SessionCacheKeys::isBreak);
+    writer.append(mIsBreak);
+    writer.append(SessionCacheKeys::isLunch);
+    writer.append(mIsLunch);
+    writer.append(SessionCacheKeys::isEvent);
+    writer.append(mIsEvent);
+    writer.append(SessionCacheKeys::isRegistration);
+    writer.append(mIsRegistration);
+    writer.append(SessionCacheKeys::title);
+    writer.append(mTitle);
+    writer.append(SessionCacheKeys::description);
+    writer.append(mDescription);
+    writer.append(SessionCacheKeys::sessionType);
+    writer.append(mSessionType);
+    if (hasStartTime()) {
+        writer.append(SessionCacheKeys::startTime);
+        writer.append(mStartTime.toString("HH:mm"));
+    }
+    if (hasEndTime()) {
+        writer.append(SessionCacheKeys::endTime);
+        writer.append(mEndTime.toString("HH:mm"));
+    }
+    writer.append(SessionCacheKeys::minutes);
+    writer.append(qint64(mMinutes));
+    writer.append(SessionCacheKeys::abstractText);
+    writer.append(mAbstractText);
+    writer.endMap();
+}
+
+/*
+ * SessionLists
+ */
+void SessionLists::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mUuid.clear();
+    mConference = 0;
+    mScheduledSessionsKeys.clear();
+    mSameTimeSessionsKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == SessionListsCacheKeys::uuid) {
+                mUuid = readCborString(reader);
+            } else if (key == SessionListsCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == SessionListsCacheKeys::scheduledSessions) {
+                mScheduledSessionsKeys = readCborKeys(reader);
+            } else if (key == SessionListsCacheKeys::sameTimeSessions) {
+                mSameTimeSessionsKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    if (mUuid.isEmpty()) {
+        mUuid = QUuid::createUuid().toString();
+        mUuid = mUuid.right(mUuid.length() - 1);
+        mUuid = mUuid.left(mUuid.length() - 1);
+    }
+    mScheduledSessionsKeysResolved = mScheduledSessionsKeys.isEmpty();
+    mScheduledSessions.clear();
+    mSameTimeSessionsKeysResolved = mSameTimeSessionsKeys.isEmpty();
+    mSameTimeSessions.clear();
+}
+
+void SessionLists::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mScheduledSessionsKeysResolved) {
+        mScheduledSessionsKeys.clear();
+    }
+    for (int i = 0; i < mScheduledSessions.size(); ++i) {
+        mScheduledSessionsKeys << QString::number(mScheduledSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, SessionListsCacheKeys::scheduledSessions, mScheduledSessionsKeys);
+    if (mSameTimeSessionsKeysResolved) {
+        mSameTimeSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSameTimeSessions.size(); ++i) {
+        mSameTimeSessionsKeys << QString::number(mSameTimeSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, SessionListsCacheKeys::sameTimeSessions, mSameTimeSessionsKeys);
+    writer.append(SessionListsCacheKeys::uuid);
+    writer.append(mUuid);
+    writer.append(SessionListsCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.endMap();
+}
+
+/*
+ * SessionTrack
+ */
+void SessionTrack::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mTrackId = 0;
+    mConference = 0;
+    mName.clear();
+    mColor.clear();
+    mInAssets = false;
+    mSessionsKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == SessionTrackCacheKeys::trackId) {
+                mTrackId = readCborInt(reader);
+            } else if (key == SessionTrackCacheKeys::conference) {
+                mConference = readCborInt(reader);
+            } else if (key == SessionTrackCacheKeys::name) {
+                mName = readCborString(reader);
+            } else if (key == SessionTrackCacheKeys::color) {
+                mColor = readCborString(reader);
+            } else if (key == SessionTrackCacheKeys::inAssets) {
+                mInAssets = readCborBool(reader);
+            } else if (key == SessionTrackCacheKeys::sessions) {
+                mSessionsKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+void SessionTrack::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, SessionTrackCacheKeys::sessions, mSessionsKeys);
+    writer.append(SessionTrackCacheKeys::trackId);
+    writer.append(qint64(mTrackId));
+    writer.append(SessionTrackCacheKeys::conference);
+    writer.append(qint64(mConference));
+    writer.append(SessionTrackCacheKeys::name);
+    writer.append(mName);
+    writer.append(SessionTrackCacheKeys::color);
+    writer.append(mColor);
+    writer.append(SessionTrackCacheKeys::inAssets);
+    writer.append(mInAssets);
+    writer.endMap();
+}
+
+/*
+ * Speaker
+ */
+void Speaker::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mSpeakerId = 0;
+    mIsDeprecated = false;
+    mSortKey.clear();
+    mSortGroup.clear();
+    mName.clear();
+    mPublicName.clear();
+    mTitle.clear();
+    mBio.clear();
+    mSessionsKeys.clear();
+    mConferencesKeys.clear();
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == SpeakerCacheKeys::speakerId) {
+                mSpeakerId = readCborInt(reader);
+            } else if (key == SpeakerCacheKeys::isDeprecated) {
+                mIsDeprecated = readCborBool(reader);
+            } else if (key == SpeakerCacheKeys::sortKey) {
+                mSortKey = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::sortGroup) {
+                mSortGroup = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::name) {
+                mName = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::publicName) {
+                mPublicName = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::title) {
+                mTitle = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::bio) {
+                mBio = readCborString(reader);
+            } else if (key == SpeakerCacheKeys::speakerImage) {
+                // speakerImage lazy pointing to SpeakerImage* (domainKey: speakerId)
+                mSpeakerImage = readCborInt(reader);
+            } else if (key == SpeakerCacheKeys::sessions) {
+                mSessionsKeys = readCborKeys(reader);
+            } else if (key == SpeakerCacheKeys::conferences) {
+                mConferencesKeys = readCborKeys(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mConferencesKeysResolved = mConferencesKeys.isEmpty();
+    mConferences.clear();
+    mIsDirty = false;
+}
+
+void Speaker::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    if (mSpeakerImage != -1) {
+        writer.append(SpeakerCacheKeys::speakerImage);
+        writer.append(qint64(mSpeakerImage));
+    }
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    appendCborKeys(writer, SpeakerCacheKeys::sessions, mSessionsKeys);
+    if (mConferencesKeysResolved) {
+        mConferencesKeys.clear();
+    }
+    for (int i = 0; i < mConferences.size(); ++i) {
+        mConferencesKeys << QString::number(mConferences.at(i)->id());
+    }
+    appendCborKeys(writer, SpeakerCacheKeys::conferences, mConferencesKeys);
+    writer.append(SpeakerCacheKeys::speakerId);
+    writer.append(qint64(mSpeakerId));
+    writer.append(SpeakerCacheKeys::isDeprecated);
+    writer.append(mIsDeprecated);
+    writer.append(SpeakerCacheKeys::sortKey);
+    writer.append(mSortKey);
+    writer.append(SpeakerCacheKeys::sortGroup);
+    writer.append(mSortGroup);
+    writer.append(SpeakerCacheKeys::name);
+    writer.append(mName);
+    writer.append(SpeakerCacheKeys::publicName);
+    writer.append(mPublicName);
+    writer.append(SpeakerCacheKeys::title);
+    writer.append(mTitle);
+    writer.append(SpeakerCacheKeys::bio);
+    writer.append(mBio);
+    writer.endMap();
+}
+
+/*
+ * SpeakerImage
+ */
+void SpeakerImage::fillFromCacheCbor(QCborStreamReader& reader)
+{
+    mSpeakerId = 0;
+    mOriginImageUrl.clear();
+    mDownloadSuccess = false;
+    mDownloadFailed = false;
+    mInAssets = false;
+    mInData = false;
+    mSuffix.clear();
+    mMaxScaleFactor = 0;
+    if (enterCborMap(reader)) {
+        while (hasNextCborEntry(reader)) {
+            const QString key = readCborString(reader);
+            if (key == SpeakerImageCacheKeys::speakerId) {
+                mSpeakerId = readCborInt(reader);
+            } else if (key == SpeakerImageCacheKeys::originImageUrl) {
+                mOriginImageUrl = readCborString(reader);
+            } else if (key == SpeakerImageCacheKeys::downloadSuccess) {
+                mDownloadSuccess = readCborBool(reader);
+            } else if (key == SpeakerImageCacheKeys::downloadFailed) {
+                mDownloadFailed = readCborBool(reader);
+            } else if (key == SpeakerImageCacheKeys::inAssets) {
+                mInAssets = readCborBool(reader);
+            } else if (key == SpeakerImageCacheKeys::inData) {
+                mInData = readCborBool(reader);
+            } else if (key == SpeakerImageCacheKeys::suffix) {
+                mSuffix = readCborString(reader);
+            } else if (key == SpeakerImageCacheKeys::maxScaleFactor) {
+                mMaxScaleFactor = readCborInt(reader);
+            } else {
+                reader.next();
+            }
+        }
+        leaveCborMap(reader);
+    }
+    mIsDirty = false;
+}
+
+void SpeakerImage::toCacheCbor(QCborStreamWriter& writer)
+{
+    writer.startMap();
+    writer.append(SpeakerImageCacheKeys::speakerId);
+    writer.append(qint64(mSpeakerId));
+    writer.append(SpeakerImageCacheKeys::originImageUrl);
+    writer.append(mOriginImageUrl);
+    writer.append(SpeakerImageCacheKeys::downloadSuccess);
+    writer.append(mDownloadSuccess);
+    writer.append(SpeakerImageCacheKeys::downloadFailed);
+    writer.append(mDownloadFailed);
+    writer.append(SpeakerImageCacheKeys::inAssets);
+    writer.append(mInAssets);
+    writer.append(SpeakerImageCacheKeys::inData);
+    writer.append(mInData);
+    writer.append(SpeakerImageCacheKeys::suffix);
+    writer.append(mSuffix);
+    writer.append(SpeakerImageCacheKeys::maxScaleFactor);
+    writer.append(qint64(mMaxScaleFactor));
+    writer.endMap();
+}
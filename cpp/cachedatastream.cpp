@@ -0,0 +1,465 @@
+/*
+ * binary snapshot serializers of the data objects:
+ * fillFromSnapshot() / toSnapshot() declared in cpp/gen/*.hpp
+ * used by DataManager through CacheSnapshot (cachesnapshot.hpp, datamanagersnapshot.cpp)
+ *
+ * not generated: the generator (gen-model) doesn't know snapshots - keep this file
+ * when regenerating cpp/gen and re-add the declarations (see gen-model/README.md)
+ *
+ * same content as toCacheMap(), properties in a fixed order:
+ * increment snapshotSchemaVersion (datamanagersnapshot.cpp) if the order is changed
+ */
+#include "gen/Conference.hpp"
+#include "gen/Day.hpp"
+#include "gen/Favorite.hpp"
+#include "gen/Room.hpp"
+#include "gen/Session.hpp"
+#include "gen/SessionTrack.hpp"
+#include "gen/Speaker.hpp"
+#include "gen/SpeakerImage.hpp"
+
+/*
+ * initialize Conference from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Conference::fillFromSnapshot(QDataStream& in)
+{
+    in >> mId;
+    in >> mConferenceName;
+    in >> mConferenceCity;
+    in >> mAddress;
+    in >> mMapAddress;
+    in >> mTimeZoneName;
+    in >> mTimeZoneOffsetSeconds;
+    in >> mConferenceFrom;
+    in >> mConferenceTo;
+    in >> mHashTag;
+    in >> mHomePage;
+    in >> mCoordinate;
+    in >> mPlaceId;
+    in >> mLastRoomId;
+    in >> mLastSessionTrackId;
+    in >> mLastGenericSessionId;
+    // mDays is (lazy loaded) Array of Day*
+    in >> mDaysKeys;
+    // mDays must be resolved later if there are keys
+    mDaysKeysResolved = (mDaysKeys.size() == 0);
+    mDays.clear();
+    // mTracks is (lazy loaded) Array of SessionTrack*
+    in >> mTracksKeys;
+    // mTracks must be resolved later if there are keys
+    mTracksKeysResolved = (mTracksKeys.size() == 0);
+    mTracks.clear();
+    // mRooms is (lazy loaded) Array of Room*
+    in >> mRoomsKeys;
+    // mRooms must be resolved later if there are keys
+    mRoomsKeysResolved = (mRoomsKeys.size() == 0);
+    mRooms.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Conference::toSnapshot(QDataStream& out)
+{
+    out << mId;
+    out << mConferenceName;
+    out << mConferenceCity;
+    out << mAddress;
+    out << mMapAddress;
+    out << mTimeZoneName;
+    out << mTimeZoneOffsetSeconds;
+    out << mConferenceFrom;
+    out << mConferenceTo;
+    out << mHashTag;
+    out << mHomePage;
+    out << mCoordinate;
+    out << mPlaceId;
+    out << mLastRoomId;
+    out << mLastSessionTrackId;
+    out << mLastGenericSessionId;
+    // mDays points to Day*
+    // lazy array: persist only keys
+    if(mDaysKeysResolved) {
+        QStringList daysKeys;
+        for (int i = 0; i < mDays.size(); ++i) {
+            daysKeys << QString::number(mDays.at(i)->id());
+        }
+        out << daysKeys;
+    } else {
+        out << mDaysKeys;
+    }
+    // mTracks points to SessionTrack*
+    // lazy array: persist only keys
+    if(mTracksKeysResolved) {
+        QStringList tracksKeys;
+        for (int i = 0; i < mTracks.size(); ++i) {
+            tracksKeys << QString::number(mTracks.at(i)->trackId());
+        }
+        out << tracksKeys;
+    } else {
+        out << mTracksKeys;
+    }
+    // mRooms points to Room*
+    // lazy array: persist only keys
+    if(mRoomsKeysResolved) {
+        QStringList roomsKeys;
+        for (int i = 0; i < mRooms.size(); ++i) {
+            roomsKeys << QString::number(mRooms.at(i)->roomId());
+        }
+        out << roomsKeys;
+    } else {
+        out << mRoomsKeys;
+    }
+}
+
+/*
+ * initialize Day from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Day::fillFromSnapshot(QDataStream& in)
+{
+    in >> mId;
+    in >> mConference;
+    in >> mWeekDay;
+    in >> mConferenceDay;
+    // mSessions is (lazy loaded) Array of Session*
+    in >> mSessionsKeys;
+    // mSessions must be resolved later if there are keys
+    mSessionsKeysResolved = (mSessionsKeys.size() == 0);
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Day::toSnapshot(QDataStream& out)
+{
+    out << mId;
+    out << mConference;
+    out << mWeekDay;
+    out << mConferenceDay;
+    // mSessions points to Session*
+    // lazy array: persist only keys
+    if(mSessionsKeysResolved) {
+        QStringList sessionsKeys;
+        for (int i = 0; i < mSessions.size(); ++i) {
+            sessionsKeys << QString::number(mSessions.at(i)->sessionId());
+        }
+        out << sessionsKeys;
+    } else {
+        out << mSessionsKeys;
+    }
+}
+
+/*
+ * initialize Favorite from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Favorite::fillFromSnapshot(QDataStream& in)
+{
+    in >> mSessionId;
+    in >> mConference;
+    in >> mSession;
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Favorite::toSnapshot(QDataStream& out)
+{
+    out << mSessionId;
+    out << mConference;
+    out << mSession;
+}
+
+/*
+ * initialize Room from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Room::fillFromSnapshot(QDataStream& in)
+{
+    in >> mRoomId;
+    in >> mConference;
+    in >> mRoomName;
+    in >> mInAssets;
+    // mSessions is (lazy loaded) Array of Session*
+    in >> mSessionsKeys;
+    // mSessions must be resolved later if there are keys
+    mSessionsKeysResolved = (mSessionsKeys.size() == 0);
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Room::toSnapshot(QDataStream& out)
+{
+    out << mRoomId;
+    out << mConference;
+    out << mRoomName;
+    out << mInAssets;
+    // mSessions points to Session*
+    // lazy array: persist only keys
+    if(mSessionsKeysResolved) {
+        QStringList sessionsKeys;
+        for (int i = 0; i < mSessions.size(); ++i) {
+            sessionsKeys << QString::number(mSessions.at(i)->sessionId());
+        }
+        out << sessionsKeys;
+    } else {
+        out << mSessionsKeys;
+    }
+}
+
+/*
+ * initialize Session from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Session::fillFromSnapshot(QDataStream& in)
+{
+    in >> mSessionId;
+    in >> mConference;
+    in >> mIsDeprecated;
+    in >> mSortKey;
+    in >> mIsTraining;
+    in >> mIsLightning;
+    in >> mIsKeynote;
+    in >> mIsSession;
+    in >> mIsCommunity;
+    in >> mIsUnconference;
+    in >> mIsMeeting;
+    in >> mIsGenericScheduleSession;
+    in >> mIsBreak;
+    in >> mIsLunch;
+    in >> mIsEvent;
+    in >> mIsRegistration;
+    in >> mTitle;
+    in >> mDescription;
+    in >> mSessionType;
+    in >> mStartTime;
+    in >> mEndTime;
+    in >> mMinutes;
+    in >> mAbstractText;
+    in >> mSessionDay;
+    in >> mRoom;
+    // mIsFavorite is transient - don't forget to initialize
+    // mPresenter is (lazy loaded) Array of Speaker*
+    in >> mPresenterKeys;
+    // mPresenter must be resolved later if there are keys
+    mPresenterKeysResolved = (mPresenterKeys.size() == 0);
+    mPresenter.clear();
+    // mSessionTracks is (lazy loaded) Array of SessionTrack*
+    in >> mSessionTracksKeys;
+    // mSessionTracks must be resolved later if there are keys
+    mSessionTracksKeysResolved = (mSessionTracksKeys.size() == 0);
+    mSessionTracks.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Session::toSnapshot(QDataStream& out)
+{
+    out << mSessionId;
+    out << mConference;
+    out << mIsDeprecated;
+    out << mSortKey;
+    out << mIsTraining;
+    out << mIsLightning;
+    out << mIsKeynote;
+    out << mIsSession;
+    out << mIsCommunity;
+    out << mIsUnconference;
+    out << mIsMeeting;
+    out << mIsGenericScheduleSession;
+    out << mIsBreak;
+    out << mIsLunch;
+    out << mIsEvent;
+    out << mIsRegistration;
+    out << mTitle;
+    out << mDescription;
+    out << mSessionType;
+    out << mStartTime;
+    out << mEndTime;
+    out << mMinutes;
+    out << mAbstractText;
+    out << mSessionDay;
+    out << mRoom;
+    // excluded: mIsFavorite
+    // mPresenter points to Speaker*
+    // lazy array: persist only keys
+    if(mPresenterKeysResolved) {
+        QStringList presenterKeys;
+        for (int i = 0; i < mPresenter.size(); ++i) {
+            presenterKeys << QString::number(mPresenter.at(i)->speakerId());
+        }
+        out << presenterKeys;
+    } else {
+        out << mPresenterKeys;
+    }
+    // mSessionTracks points to SessionTrack*
+    // lazy array: persist only keys
+    if(mSessionTracksKeysResolved) {
+        QStringList sessionTracksKeys;
+        for (int i = 0; i < mSessionTracks.size(); ++i) {
+            sessionTracksKeys << QString::number(mSessionTracks.at(i)->trackId());
+        }
+        out << sessionTracksKeys;
+    } else {
+        out << mSessionTracksKeys;
+    }
+}
+
+/*
+ * initialize SessionTrack from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void SessionTrack::fillFromSnapshot(QDataStream& in)
+{
+    in >> mTrackId;
+    in >> mConference;
+    in >> mName;
+    in >> mColor;
+    in >> mInAssets;
+    // mSessions is (lazy loaded) Array of Session*
+    in >> mSessionsKeys;
+    // mSessions must be resolved later if there are keys
+    mSessionsKeysResolved = (mSessionsKeys.size() == 0);
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void SessionTrack::toSnapshot(QDataStream& out)
+{
+    out << mTrackId;
+    out << mConference;
+    out << mName;
+    out << mColor;
+    out << mInAssets;
+    // mSessions points to Session*
+    // lazy array: persist only keys
+    if(mSessionsKeysResolved) {
+        QStringList sessionsKeys;
+        for (int i = 0; i < mSessions.size(); ++i) {
+            sessionsKeys << QString::number(mSessions.at(i)->sessionId());
+        }
+        out << sessionsKeys;
+    } else {
+        out << mSessionsKeys;
+    }
+}
+
+/*
+ * initialize Speaker from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void Speaker::fillFromSnapshot(QDataStream& in)
+{
+    in >> mSpeakerId;
+    in >> mIsDeprecated;
+    in >> mSortKey;
+    in >> mSortGroup;
+    in >> mName;
+    in >> mPublicName;
+    in >> mTitle;
+    in >> mBio;
+    in >> mSpeakerImage;
+    // mSessions is (lazy loaded) Array of Session*
+    in >> mSessionsKeys;
+    // mSessions must be resolved later if there are keys
+    mSessionsKeysResolved = (mSessionsKeys.size() == 0);
+    mSessions.clear();
+    // mConferences is (lazy loaded) Array of Conference*
+    in >> mConferencesKeys;
+    // mConferences must be resolved later if there are keys
+    mConferencesKeysResolved = (mConferencesKeys.size() == 0);
+    mConferences.clear();
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void Speaker::toSnapshot(QDataStream& out)
+{
+    out << mSpeakerId;
+    out << mIsDeprecated;
+    out << mSortKey;
+    out << mSortGroup;
+    out << mName;
+    out << mPublicName;
+    out << mTitle;
+    out << mBio;
+    out << mSpeakerImage;
+    // mSessions points to Session*
+    // lazy array: persist only keys
+    if(mSessionsKeysResolved) {
+        QStringList sessionsKeys;
+        for (int i = 0; i < mSessions.size(); ++i) {
+            sessionsKeys << QString::number(mSessions.at(i)->sessionId());
+        }
+        out << sessionsKeys;
+    } else {
+        out << mSessionsKeys;
+    }
+    // mConferences points to Conference*
+    // lazy array: persist only keys
+    if(mConferencesKeysResolved) {
+        QStringList conferencesKeys;
+        for (int i = 0; i < mConferences.size(); ++i) {
+            conferencesKeys << QString::number(mConferences.at(i)->id());
+        }
+        out << conferencesKeys;
+    } else {
+        out << mConferencesKeys;
+    }
+}
+
+/*
+ * initialize SpeakerImage from binary cache snapshot
+ * same order as written by toSnapshot()
+ */
+void SpeakerImage::fillFromSnapshot(QDataStream& in)
+{
+    in >> mSpeakerId;
+    in >> mOriginImageUrl;
+    in >> mDownloadSuccess;
+    in >> mDownloadFailed;
+    in >> mInAssets;
+    in >> mInData;
+    in >> mSuffix;
+    in >> mMaxScaleFactor;
+    mIsDirty = false;
+}
+
+/*
+ * writes all cached properties to binary snapshot
+ * without transient values - same as toCacheMap()
+ */
+void SpeakerImage::toSnapshot(QDataStream& out)
+{
+    out << mSpeakerId;
+    out << mOriginImageUrl;
+    out << mDownloadSuccess;
+    out << mDownloadFailed;
+    out << mInAssets;
+    out << mInData;
+    out << mSuffix;
+    out << mMaxScaleFactor;
+}
@@ -0,0 +1,63 @@
+#include "cacheformat.hpp"
+
+#include <QJsonDocument>
+#include <QCborArray>
+#include <QCborValue>
+#include <QCborStreamWriter>
+#include <QDebug>
+
+// self-describe CBOR tag 55799 as encoded by QCborStreamWriter
+static const char cborSignature[] = "\xd9\xd9\xf7";
+
+QByteArray CacheFormat::encode(const QJsonArray& data, const Format format)
+{
+    if (format != Cbor) {
+        return QJsonDocument(data).toJson(format == JsonCompact ? QJsonDocument::Compact : QJsonDocument::Indented);
+    }
+    QByteArray bytes;
+    QCborStreamWriter writer(&bytes);
+    writer.append(QCborKnownTags::Signature);
+    QCborArray::fromJsonArray(data).toCborValue().toCbor(writer);
+    return bytes;
+}
+
+QJsonArray CacheFormat::decode(const QByteArray& data, bool* ok)
+{
+    if (ok) {
+        *ok = false;
+    }
+    if (isCbor(data)) {
+        QCborParserError error;
+        QCborValue value = QCborValue::fromCbor(data, &error);
+        if (error.error != QCborError::NoError) {
+            qWarning() << "Couldn't parse CBOR cache:" << error.errorString() << "at" << error.offset;
+            return QJsonArray();
+        }
+        if (value.isTag()) {
+            value = value.taggedValue();
+        }
+        if (!value.isArray()) {
+            qWarning() << "CBOR cache is not an Array";
+            return QJsonArray();
+        }
+        if (ok) {
+            *ok = true;
+        }
+        return value.toArray().toJsonArray();
+    }
+    QJsonParseError error;
+    QJsonDocument jda = QJsonDocument::fromJson(data, &error);
+    if (!jda.isArray()) {
+        qWarning() << "Couldn't create JSON Array:" << error.errorString();
+        return QJsonArray();
+    }
+    if (ok) {
+        *ok = true;
+    }
+    return jda.array();
+}
+
+bool CacheFormat::isCbor(const QByteArray& data)
+{
+    return data.startsWith(cborSignature);
+}
@@ -0,0 +1,119 @@
+#ifndef CACHEFORMAT_HPP
+#define CACHEFORMAT_HPP
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QList>
+#include <QObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+#include <QDebug>
+
+/*
+ * On-disk format of the cache files (cacheXYZ.json)
+ *
+ * JSON (compact or indented) or CBOR (RFC 7049) - selected by
+ * SettingsData useCborCache. CBOR files start with the self-describe
+ * tag (0xd9d9f7), so reading detects the format from the content:
+ * switching the option doesn't invalidate existing caches,
+ * prefilled data-assets stay JSON.
+ */
+class CacheFormat
+{
+public:
+    enum Format {
+        JsonIndented,
+        JsonCompact,
+        Cbor
+    };
+
+    static QByteArray encode(const QJsonArray& data, const Format format);
+
+    // ok is false if data is neither a valid JSON nor CBOR array
+    static QJsonArray decode(const QByteArray& data, bool* ok = nullptr);
+
+    static bool isCbor(const QByteArray& data);
+
+    // cache content of data objects (Session*, Speaker*, ...)
+    // JSON: T::toCacheJson() - CBOR: streamed by T::toCacheCbor(), no QJsonArray in between
+    template<class T>
+    static QByteArray encodeObjects(const QList<QObject*>& objects, const Format format);
+
+    // appends a new T* per record: JSON via T::fillFromCacheJson(),
+    // CBOR streamed record by record into T::fillFromCacheCbor()
+    // empty data: nothing cached - false if data couldn't be read, no T* appended then
+    template<class T>
+    static bool decodeObjects(const QByteArray& data, QObject* parent, QList<QObject*>& objects);
+};
+
+template<class T>
+QByteArray CacheFormat::encodeObjects(const QList<QObject*>& objects, const Format format)
+{
+    if (format != Cbor) {
+        QJsonArray cacheArray;
+        for (int i = 0; i < objects.size(); ++i) {
+            cacheArray.append(static_cast<T*>(objects.at(i))->toCacheJson());
+        }
+        return encode(cacheArray, format);
+    }
+    QByteArray bytes;
+    QCborStreamWriter writer(&bytes);
+    writer.append(QCborKnownTags::Signature);
+    writer.startArray(objects.size());
+    for (int i = 0; i < objects.size(); ++i) {
+        static_cast<T*>(objects.at(i))->toCacheCbor(writer);
+    }
+    writer.endArray();
+    return bytes;
+}
+
+template<class T>
+bool CacheFormat::decodeObjects(const QByteArray& data, QObject* parent, QList<QObject*>& objects)
+{
+    if (data.isEmpty()) {
+        return true;
+    }
+    if (!isCbor(data)) {
+        bool ok = false;
+        const QJsonArray cacheArray = decode(data, &ok);
+        objects.reserve(objects.size() + cacheArray.size());
+        for (int i = 0; i < cacheArray.size(); ++i) {
+            T* object = new T();
+            object->setParent(parent);
+            object->fillFromCacheJson(cacheArray.at(i).toObject());
+            objects.append(object);
+        }
+        return ok;
+    }
+    const int sizeBefore = objects.size();
+    QCborStreamReader reader(data);
+    // self-describe tag, then the array
+    reader.next();
+    if (!reader.isArray()) {
+        qWarning() << "CBOR cache is not an Array";
+        return false;
+    }
+    if (reader.isLengthKnown()) {
+        objects.reserve(sizeBefore + int(reader.length()));
+    }
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        T* object = new T();
+        object->setParent(parent);
+        object->fillFromCacheCbor(reader);
+        objects.append(object);
+    }
+    if (reader.lastError() == QCborError::NoError) {
+        reader.leaveContainer();
+    }
+    if (reader.lastError() != QCborError::NoError) {
+        qWarning() << "Couldn't parse CBOR cache:" << reader.lastError().toString() << "at" << reader.currentOffset();
+        while (objects.size() > sizeBefore) {
+            delete objects.takeLast();
+        }
+        return false;
+    }
+    return true;
+}
+
+#endif // CACHEFORMAT_HPP
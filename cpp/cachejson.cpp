@@ -0,0 +1,521 @@
+/*
+ * JSON cache serializers of the data objects:
+ * fillFromCacheJson() / toCacheJson() declared in cpp/gen/*.hpp
+ *
+ * not generated: the generator (gen-model) only knows the QVariantMap
+ * based fillFromCacheMap() / toCacheMap() - keep this file when
+ * regenerating cpp/gen and re-add the declarations (see gen-model/README.md)
+ *
+ * reads and writes typed values field by field - no QVariantMap
+ * same content as toCacheMap(), keys from cachekeys.hpp
+ */
+#include "cachekeys.hpp"
+
+#include "gen/Conference.hpp"
+#include "gen/Day.hpp"
+#include "gen/Favorite.hpp"
+#include "gen/Room.hpp"
+#include "gen/Session.hpp"
+#include "gen/SessionLists.hpp"
+#include "gen/SessionTrack.hpp"
+#include "gen/Speaker.hpp"
+#include "gen/SpeakerImage.hpp"
+
+#include <QJsonArray>
+#include <QUuid>
+#include <QDebug>
+
+// QJsonObject::insert(QLatin1String, ...) is available since Qt 5.15
+static inline void insertValue(QJsonObject& jsonObject, const QLatin1String key, const QJsonValue& value)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+    jsonObject.insert(key, value);
+#else
+    jsonObject.insert(QString(key), value);
+#endif
+}
+
+// lazy arrays persist only the keys:
+// numbers in prefilled data-assets, strings if written by toCacheJson()
+static QStringList keysFromJson(const QJsonValue& keysValue)
+{
+    QStringList keys;
+    const QJsonArray keysArray = keysValue.toArray();
+    keys.reserve(keysArray.size());
+    for (int i = 0; i < keysArray.size(); ++i) {
+        const QJsonValue keyValue = keysArray.at(i);
+        keys << (keyValue.isDouble() ? QString::number(keyValue.toInt()) : keyValue.toString());
+    }
+    return keys;
+}
+
+// always getting Date and Time as a String (from server or JSON)
+static QDate dateFromJson(const QJsonValue& dateValue)
+{
+    const QString dateAsString = dateValue.toString();
+    const QDate date = QDate::fromString(dateAsString, "yyyy-MM-dd");
+    if (!date.isValid()) {
+        qDebug() << "Date is not valid for String: " << dateAsString;
+        return QDate();
+    }
+    return date;
+}
+
+static QTime timeFromJson(const QJsonValue& timeValue)
+{
+    const QString timeAsString = timeValue.toString();
+    const QTime time = QTime::fromString(timeAsString, "HH:mm");
+    if (!time.isValid()) {
+        qDebug() << "Time is not valid for String: " << timeAsString;
+        return QTime();
+    }
+    return time;
+}
+
+/*
+ * Conference
+ */
+void Conference::fillFromCacheJson(const QJsonObject& conferenceObject)
+{
+    mId = conferenceObject.value(ConferenceCacheKeys::id).toInt();
+    mConferenceName = conferenceObject.value(ConferenceCacheKeys::conferenceName).toString();
+    mConferenceCity = conferenceObject.value(ConferenceCacheKeys::conferenceCity).toString();
+    mAddress = conferenceObject.value(ConferenceCacheKeys::address).toString();
+    mMapAddress = conferenceObject.value(ConferenceCacheKeys::mapAddress).toString();
+    mTimeZoneName = conferenceObject.value(ConferenceCacheKeys::timeZoneName).toString();
+    mTimeZoneOffsetSeconds = conferenceObject.value(ConferenceCacheKeys::timeZoneOffsetSeconds).toInt();
+    if (conferenceObject.contains(ConferenceCacheKeys::conferenceFrom)) {
+        mConferenceFrom = dateFromJson(conferenceObject.value(ConferenceCacheKeys::conferenceFrom));
+    }
+    if (conferenceObject.contains(ConferenceCacheKeys::conferenceTo)) {
+        mConferenceTo = dateFromJson(conferenceObject.value(ConferenceCacheKeys::conferenceTo));
+    }
+    mHashTag = conferenceObject.value(ConferenceCacheKeys::hashTag).toString();
+    mHomePage = conferenceObject.value(ConferenceCacheKeys::homePage).toString();
+    mCoordinate = conferenceObject.value(ConferenceCacheKeys::coordinate).toString();
+    mPlaceId = conferenceObject.value(ConferenceCacheKeys::placeId).toString();
+    mLastRoomId = conferenceObject.value(ConferenceCacheKeys::lastRoomId).toInt();
+    mLastSessionTrackId = conferenceObject.value(ConferenceCacheKeys::lastSessionTrackId).toInt();
+    mLastGenericSessionId = conferenceObject.value(ConferenceCacheKeys::lastGenericSessionId).toInt();
+    // lazy arrays must be resolved later if there are keys
+    mDaysKeys = keysFromJson(conferenceObject.value(ConferenceCacheKeys::days));
+    mDaysKeysResolved = mDaysKeys.isEmpty();
+    mDays.clear();
+    mTracksKeys = keysFromJson(conferenceObject.value(ConferenceCacheKeys::tracks));
+    mTracksKeysResolved = mTracksKeys.isEmpty();
+    mTracks.clear();
+    mRoomsKeys = keysFromJson(conferenceObject.value(ConferenceCacheKeys::rooms));
+    mRoomsKeysResolved = mRoomsKeys.isEmpty();
+    mRooms.clear();
+    mIsDirty = false;
+}
+
+/*
+ * lazy arrays: if the keys are already resolved they're rebuilt from the objects,
+ * otherwise objects added without resolving before are appended to the keys
+ */
+QJsonObject Conference::toCacheJson()
+{
+    QJsonObject conferenceObject;
+    if (mDaysKeysResolved) {
+        mDaysKeys.clear();
+    }
+    for (int i = 0; i < mDays.size(); ++i) {
+        mDaysKeys << QString::number(mDays.at(i)->id());
+    }
+    insertValue(conferenceObject, ConferenceCacheKeys::days, QJsonArray::fromStringList(mDaysKeys));
+    if (mTracksKeysResolved) {
+        mTracksKeys.clear();
+    }
+    for (int i = 0; i < mTracks.size(); ++i) {
+        mTracksKeys << QString::number(mTracks.at(i)->trackId());
+    }
+    insertValue(conferenceObject, ConferenceCacheKeys::tracks, QJsonArray::fromStringList(mTracksKeys));
+    if (mRoomsKeysResolved) {
+        mRoomsKeys.clear();
+    }
+    for (int i = 0; i < mRooms.size(); ++i) {
+        mRoomsKeys << QString::number(mRooms.at(i)->roomId());
+    }
+    insertValue(conferenceObject, ConferenceCacheKeys::rooms, QJsonArray::fromStringList(mRoomsKeys));
+    insertValue(conferenceObject, ConferenceCacheKeys::id, mId);
+    insertValue(conferenceObject, ConferenceCacheKeys::conferenceName, mConferenceName);
+    insertValue(conferenceObject, ConferenceCacheKeys::conferenceCity, mConferenceCity);
+    insertValue(conferenceObject, ConferenceCacheKeys::address, mAddress);
+    insertValue(conferenceObject, ConferenceCacheKeys::mapAddress, mMapAddress);
+    insertValue(conferenceObject, ConferenceCacheKeys::timeZoneName, mTimeZoneName);
+    insertValue(conferenceObject, ConferenceCacheKeys::timeZoneOffsetSeconds, mTimeZoneOffsetSeconds);
+    if (hasConferenceFrom()) {
+        insertValue(conferenceObject, ConferenceCacheKeys::conferenceFrom, mConferenceFrom.toString("yyyy-MM-dd"));
+    }
+    if (hasConferenceTo()) {
+        insertValue(conferenceObject, ConferenceCacheKeys::conferenceTo, mConferenceTo.toString("yyyy-MM-dd"));
+    }
+    insertValue(conferenceObject, ConferenceCacheKeys::hashTag, mHashTag);
+    insertValue(conferenceObject, ConferenceCacheKeys::homePage, mHomePage);
+    insertValue(conferenceObject, ConferenceCacheKeys::coordinate, mCoordinate);
+    insertValue(conferenceObject, ConferenceCacheKeys::placeId, mPlaceId);
+    insertValue(conferenceObject, ConferenceCacheKeys::lastRoomId, mLastRoomId);
+    insertValue(conferenceObject, ConferenceCacheKeys::lastSessionTrackId, mLastSessionTrackId);
+    insertValue(conferenceObject, ConferenceCacheKeys::lastGenericSessionId, mLastGenericSessionId);
+    return conferenceObject;
+}
+
+/*
+ * Day
+ */
+void Day::fillFromCacheJson(const QJsonObject& dayObject)
+{
+    mId = dayObject.value(DayCacheKeys::id).toInt();
+    mConference = dayObject.value(DayCacheKeys::conference).toInt();
+    mWeekDay = dayObject.value(DayCacheKeys::weekDay).toInt();
+    if (dayObject.contains(DayCacheKeys::conferenceDay)) {
+        mConferenceDay = dateFromJson(dayObject.value(DayCacheKeys::conferenceDay));
+    }
+    mSessionsKeys = keysFromJson(dayObject.value(DayCacheKeys::sessions));
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+QJsonObject Day::toCacheJson()
+{
+    QJsonObject dayObject;
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    insertValue(dayObject, DayCacheKeys::sessions, QJsonArray::fromStringList(mSessionsKeys));
+    insertValue(dayObject, DayCacheKeys::id, mId);
+    insertValue(dayObject, DayCacheKeys::conference, mConference);
+    insertValue(dayObject, DayCacheKeys::weekDay, mWeekDay);
+    if (hasConferenceDay()) {
+        insertValue(dayObject, DayCacheKeys::conferenceDay, mConferenceDay.toString("yyyy-MM-dd"));
+    }
+    return dayObject;
+}
+
+/*
+ * Favorite
+ */
+void Favorite::fillFromCacheJson(const QJsonObject& favoriteObject)
+{
+    mSessionId = favoriteObject.value(FavoriteCacheKeys::sessionId).toInt();
+    mConference = favoriteObject.value(FavoriteCacheKeys::conference).toInt();
+    // session lazy pointing to Session* (domainKey: sessionId)
+    // resolved on demand from DataManager
+    if (favoriteObject.contains(FavoriteCacheKeys::session)) {
+        mSession = favoriteObject.value(FavoriteCacheKeys::session).toInt();
+    }
+    mIsDirty = false;
+}
+
+QJsonObject Favorite::toCacheJson()
+{
+    QJsonObject favoriteObject;
+    if (mSession != -1) {
+        insertValue(favoriteObject, FavoriteCacheKeys::session, mSession);
+    }
+    insertValue(favoriteObject, FavoriteCacheKeys::sessionId, mSessionId);
+    insertValue(favoriteObject, FavoriteCacheKeys::conference, mConference);
+    return favoriteObject;
+}
+
+/*
+ * Room
+ */
+void Room::fillFromCacheJson(const QJsonObject& roomObject)
+{
+    mRoomId = roomObject.value(RoomCacheKeys::roomId).toInt();
+    mConference = roomObject.value(RoomCacheKeys::conference).toInt();
+    mRoomName = roomObject.value(RoomCacheKeys::roomName).toString();
+    mInAssets = roomObject.value(RoomCacheKeys::inAssets).toBool();
+    mSessionsKeys = keysFromJson(roomObject.value(RoomCacheKeys::sessions));
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+QJsonObject Room::toCacheJson()
+{
+    QJsonObject roomObject;
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    insertValue(roomObject, RoomCacheKeys::sessions, QJsonArray::fromStringList(mSessionsKeys));
+    insertValue(roomObject, RoomCacheKeys::roomId, mRoomId);
+    insertValue(roomObject, RoomCacheKeys::conference, mConference);
+    insertValue(roomObject, RoomCacheKeys::roomName, mRoomName);
+    insertValue(roomObject, RoomCacheKeys::inAssets, mInAssets);
+    return roomObject;
+}
+
+/*
+ * Session
+ * mIsFavorite is transient: not cached
+ */
+void Session::fillFromCacheJson(const QJsonObject& sessionObject)
+{
+    mSessionId = sessionObject.value(SessionCacheKeys::sessionId).toInt();
+    mConference = sessionObject.value(SessionCacheKeys::conference).toInt();
+    mIsDeprecated = sessionObject.value(SessionCacheKeys::isDeprecated).toBool();
+    mSortKey = sessionObject.value(SessionCacheKeys::sortKey).toString();
+    mIsTraining = sessionObject.value(SessionCacheKeys::isTraining).toBool();
+    mIsLightning = sessionObject.value(SessionCacheKeys::isLightning).toBool();
+    mIsKeynote = sessionObject.value(SessionCacheKeys::isKeynote).toBool();
+    mIsSession = sessionObject.value(SessionCacheKeys::isSession).toBool();
+    mIsCommunity = sessionObject.value(SessionCacheKeys::isCommunity).toBool();
+    mIsUnconference = sessionObject.value(SessionCacheKeys::isUnconference).toBool();
+    mIsMeeting = sessionObject.value(SessionCacheKeys::isMeeting).toBool();
+    mIsGenericScheduleSession = sessionObject.value(SessionCacheKeys::isGenericScheduleSession).toBool();
+    mIsBreak = sessionObject.value(SessionCacheKeys::isBreak).toBool();
+    mIsLunch = sessionObject.value(SessionCacheKeys::isLunch).toBool();
+    mIsEvent = sessionObject.value(SessionCacheKeys::isEvent).toBool();
+    mIsRegistration = sessionObject.value(SessionCacheKeys::isRegistration).toBool();
+    mTitle = sessionObject.value(SessionCacheKeys::title).toString();
+    mDescription = sessionObject.value(SessionCacheKeys::description).toString();
+    mSessionType = sessionObject.value(SessionCacheKeys::sessionType).toString();
+    if (sessionObject.contains(SessionCacheKeys::startTime)) {
+        mStartTime = timeFromJson(sessionObject.value(SessionCacheKeys::startTime));
+    }
+    if (sessionObject.contains(SessionCacheKeys::endTime)) {
+        mEndTime = timeFromJson(sessionObject.value(SessionCacheKeys::endTime));
+    }
+    mMinutes = sessionObject.value(SessionCacheKeys::minutes).toInt();
+    mAbstractText = sessionObject.value(SessionCacheKeys::abstractText).toString();
+    // sessionDay (Day*) and room (Room*) are lazy: resolved on demand from DataManager
+    if (sessionObject.contains(SessionCacheKeys::sessionDay)) {
+        mSessionDay = sessionObject.value(SessionCacheKeys::sessionDay).toInt();
+    }
+    if (sessionObject.contains(SessionCacheKeys::room)) {
+        mRoom = sessionObject.value(SessionCacheKeys::room).toInt();
+    }
+    mPresenterKeys = keysFromJson(sessionObject.value(SessionCacheKeys::presenter));
+    mPresenterKeysResolved = mPresenterKeys.isEmpty();
+    mPresenter.clear();
+    mSessionTracksKeys = keysFromJson(sessionObject.value(SessionCacheKeys::sessionTracks));
+    mSessionTracksKeysResolved = mSessionTracksKeys.isEmpty();
+    mSessionTracks.clear();
+    mIsDirty = false;
+}
+
+QJsonObject Session::toCacheJson()
+{
+    QJsonObject sessionObject;
+    if (mSessionDay != -1) {
+        insertValue(sessionObject, SessionCacheKeys::sessionDay, mSessionDay);
+    }
+    if (mRoom != -1) {
+        insertValue(sessionObject, SessionCacheKeys::room, mRoom);
+    }
+    if (mPresenterKeysResolved) {
+        mPresenterKeys.clear();
+    }
+    for (int i = 0; i < mPresenter.size(); ++i) {
+        mPresenterKeys << QString::number(mPresenter.at(i)->speakerId());
+    }
+    insertValue(sessionObject, SessionCacheKeys::presenter, QJsonArray::fromStringList(mPresenterKeys));
+    if (mSessionTracksKeysResolved) {
+        mSessionTracksKeys.clear();
+    }
+    for (int i = 0; i < mSessionTracks.size(); ++i) {
+        mSessionTracksKeys << QString::number(mSessionTracks.at(i)->trackId());
+    }
+    insertValue(sessionObject, SessionCacheKeys::sessionTracks, QJsonArray::fromStringList(mSessionTracksKeys));
+    insertValue(sessionObject, SessionCacheKeys::sessionId, mSessionId);
+    insertValue(sessionObject, SessionCacheKeys::conference, mConference);
+    insertValue(sessionObject, SessionCacheKeys::isDeprecated, mIsDeprecated);
+    insertValue(sessionObject, SessionCacheKeys::sortKey, mSortKey);
+    insertValue(sessionObject, SessionCacheKeys::isTraining, mIsTraining);
+    insertValue(sessionObject, SessionCacheKeys::isLightning, mIsLightning);
+    insertValue(sessionObject, SessionCacheKeys::isKeynote, mIsKeynote);
+    insertValue(sessionObject, SessionCacheKeys::isSession, mIsSession);
+    insertValue(sessionObject, SessionCacheKeys::isCommunity, mIsCommunity);
+    insertValue(sessionObject, SessionCacheKeys::isUnconference, mIsUnconference);
+    insertValue(sessionObject, SessionCacheKeys::isMeeting, mIsMeeting);
+    insertValue(sessionObject, SessionCacheKeys::isGenericScheduleSession, mIsGenericScheduleSession);
+    insertValue(sessionObject, SessionCacheKeys::isBreak, mIsBreak);
+    insertValue(sessionObject, SessionCacheKeys::isLunch, mIsLunch);
+    insertValue(sessionObject, SessionCacheKeys::isEvent, mIsEvent);
+    insertValue(sessionObject, SessionCacheKeys::isRegistration, mIsRegistration);
+    insertValue(sessionObject, SessionCacheKeys::title, mTitle);
+    insertValue(sessionObject, SessionCacheKeys::description, mDescription);
+    insertValue(sessionObject, SessionCacheKeys::sessionType, mSessionType);
+    if (hasStartTime()) {
+        insertValue(sessionObject, SessionCacheKeys::startTime, mStartTime.toString("HH:mm"));
+    }
+    if (hasEndTime()) {
+        insertValue(sessionObject, SessionCacheKeys::endTime, mEndTime.toString("HH:mm"));
+    }
+    insertValue(sessionObject, SessionCacheKeys::minutes, mMinutes);
+    insertValue(sessionObject, SessionCacheKeys::abstractText, mAbstractText);
+    return sessionObject;
+}
+
+/*
+ * SessionLists
+ */
+void SessionLists::fillFromCacheJson(const QJsonObject& sessionListsObject)
+{
+    mUuid = sessionListsObject.value(SessionListsCacheKeys::uuid).toString();
+    if (mUuid.isEmpty()) {
+        mUuid = QUuid::createUuid().toString();
+        mUuid = mUuid.right(mUuid.length() - 1);
+        mUuid = mUuid.left(mUuid.length() - 1);
+    }
+    mConference = sessionListsObject.value(SessionListsCacheKeys::conference).toInt();
+    mScheduledSessionsKeys = keysFromJson(sessionListsObject.value(SessionListsCacheKeys::scheduledSessions));
+    mScheduledSessionsKeysResolved = mScheduledSessionsKeys.isEmpty();
+    mScheduledSessions.clear();
+    mSameTimeSessionsKeys = keysFromJson(sessionListsObject.value(SessionListsCacheKeys::sameTimeSessions));
+    mSameTimeSessionsKeysResolved = mSameTimeSessionsKeys.isEmpty();
+    mSameTimeSessions.clear();
+}
+
+QJsonObject SessionLists::toCacheJson()
+{
+    QJsonObject sessionListsObject;
+    if (mScheduledSessionsKeysResolved) {
+        mScheduledSessionsKeys.clear();
+    }
+    for (int i = 0; i < mScheduledSessions.size(); ++i) {
+        mScheduledSessionsKeys << QString::number(mScheduledSessions.at(i)->sessionId());
+    }
+    insertValue(sessionListsObject, SessionListsCacheKeys::scheduledSessions, QJsonArray::fromStringList(mScheduledSessionsKeys));
+    if (mSameTimeSessionsKeysResolved) {
+        mSameTimeSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSameTimeSessions.size(); ++i) {
+        mSameTimeSessionsKeys << QString::number(mSameTimeSessions.at(i)->sessionId());
+    }
+    insertValue(sessionListsObject, SessionListsCacheKeys::sameTimeSessions, QJsonArray::fromStringList(mSameTimeSessionsKeys));
+    insertValue(sessionListsObject, SessionListsCacheKeys::uuid, mUuid);
+    insertValue(sessionListsObject, SessionListsCacheKeys::conference, mConference);
+    return sessionListsObject;
+}
+
+/*
+ * SessionTrack
+ */
+void SessionTrack::fillFromCacheJson(const QJsonObject& sessionTrackObject)
+{
+    mTrackId = sessionTrackObject.value(SessionTrackCacheKeys::trackId).toInt();
+    mConference = sessionTrackObject.value(SessionTrackCacheKeys::conference).toInt();
+    mName = sessionTrackObject.value(SessionTrackCacheKeys::name).toString();
+    mColor = sessionTrackObject.value(SessionTrackCacheKeys::color).toString();
+    mInAssets = sessionTrackObject.value(SessionTrackCacheKeys::inAssets).toBool();
+    mSessionsKeys = keysFromJson(sessionTrackObject.value(SessionTrackCacheKeys::sessions));
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mIsDirty = false;
+}
+
+QJsonObject SessionTrack::toCacheJson()
+{
+    QJsonObject sessionTrackObject;
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::sessions, QJsonArray::fromStringList(mSessionsKeys));
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::trackId, mTrackId);
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::conference, mConference);
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::name, mName);
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::color, mColor);
+    insertValue(sessionTrackObject, SessionTrackCacheKeys::inAssets, mInAssets);
+    return sessionTrackObject;
+}
+
+/*
+ * Speaker
+ */
+void Speaker::fillFromCacheJson(const QJsonObject& speakerObject)
+{
+    mSpeakerId = speakerObject.value(SpeakerCacheKeys::speakerId).toInt();
+    mIsDeprecated = speakerObject.value(SpeakerCacheKeys::isDeprecated).toBool();
+    mSortKey = speakerObject.value(SpeakerCacheKeys::sortKey).toString();
+    mSortGroup = speakerObject.value(SpeakerCacheKeys::sortGroup).toString();
+    mName = speakerObject.value(SpeakerCacheKeys::name).toString();
+    mPublicName = speakerObject.value(SpeakerCacheKeys::publicName).toString();
+    mTitle = speakerObject.value(SpeakerCacheKeys::title).toString();
+    mBio = speakerObject.value(SpeakerCacheKeys::bio).toString();
+    // speakerImage lazy pointing to SpeakerImage* (domainKey: speakerId)
+    if (speakerObject.contains(SpeakerCacheKeys::speakerImage)) {
+        mSpeakerImage = speakerObject.value(SpeakerCacheKeys::speakerImage).toInt();
+    }
+    mSessionsKeys = keysFromJson(speakerObject.value(SpeakerCacheKeys::sessions));
+    mSessionsKeysResolved = mSessionsKeys.isEmpty();
+    mSessions.clear();
+    mConferencesKeys = keysFromJson(speakerObject.value(SpeakerCacheKeys::conferences));
+    mConferencesKeysResolved = mConferencesKeys.isEmpty();
+    mConferences.clear();
+    mIsDirty = false;
+}
+
+QJsonObject Speaker::toCacheJson()
+{
+    QJsonObject speakerObject;
+    if (mSpeakerImage != -1) {
+        insertValue(speakerObject, SpeakerCacheKeys::speakerImage, mSpeakerImage);
+    }
+    if (mSessionsKeysResolved) {
+        mSessionsKeys.clear();
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        mSessionsKeys << QString::number(mSessions.at(i)->sessionId());
+    }
+    insertValue(speakerObject, SpeakerCacheKeys::sessions, QJsonArray::fromStringList(mSessionsKeys));
+    if (mConferencesKeysResolved) {
+        mConferencesKeys.clear();
+    }
+    for (int i = 0; i < mConferences.size(); ++i) {
+        mConferencesKeys << QString::number(mConferences.at(i)->id());
+    }
+    insertValue(speakerObject, SpeakerCacheKeys::conferences, QJsonArray::fromStringList(mConferencesKeys));
+    insertValue(speakerObject, SpeakerCacheKeys::speakerId, mSpeakerId);
+    insertValue(speakerObject, SpeakerCacheKeys::isDeprecated, mIsDeprecated);
+    insertValue(speakerObject, SpeakerCacheKeys::sortKey, mSortKey);
+    insertValue(speakerObject, SpeakerCacheKeys::sortGroup, mSortGroup);
+    insertValue(speakerObject, SpeakerCacheKeys::name, mName);
+    insertValue(speakerObject, SpeakerCacheKeys::publicName, mPublicName);
+    insertValue(speakerObject, SpeakerCacheKeys::title, mTitle);
+    insertValue(speakerObject, SpeakerCacheKeys::bio, mBio);
+    return speakerObject;
+}
+
+/*
+ * SpeakerImage
+ */
+void SpeakerImage::fillFromCacheJson(const QJsonObject& speakerImageObject)
+{
+    mSpeakerId = speakerImageObject.value(SpeakerImageCacheKeys::speakerId).toInt();
+    mOriginImageUrl = speakerImageObject.value(SpeakerImageCacheKeys::originImageUrl).toString();
+    mDownloadSuccess = speakerImageObject.value(SpeakerImageCacheKeys::downloadSuccess).toBool();
+    mDownloadFailed = speakerImageObject.value(SpeakerImageCacheKeys::downloadFailed).toBool();
+    mInAssets = speakerImageObject.value(SpeakerImageCacheKeys::inAssets).toBool();
+    mInData = speakerImageObject.value(SpeakerImageCacheKeys::inData).toBool();
+    mSuffix = speakerImageObject.value(SpeakerImageCacheKeys::suffix).toString();
+    mMaxScaleFactor = speakerImageObject.value(SpeakerImageCacheKeys::maxScaleFactor).toInt();
+    mIsDirty = false;
+}
+
+QJsonObject SpeakerImage::toCacheJson()
+{
+    QJsonObject speakerImageObject;
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::speakerId, mSpeakerId);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::originImageUrl, mOriginImageUrl);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::downloadSuccess, mDownloadSuccess);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::downloadFailed, mDownloadFailed);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::inAssets, mInAssets);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::inData, mInData);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::suffix, mSuffix);
+    insertValue(speakerImageObject, SpeakerImageCacheKeys::maxScaleFactor, mMaxScaleFactor);
+    return speakerImageObject;
+}
@@ -0,0 +1,135 @@
+#ifndef CACHEKEYS_HPP
+#define CACHEKEYS_HPP
+
+#include <QLatin1String>
+
+/*
+ * property names of the cache files (cacheXYZ.json / CBOR)
+ * used by fillFromCacheJson() / toCacheJson() (cachejson.cpp)
+ *
+ * compile-time QLatin1String: no QString is constructed per key and record
+ * names must stay the same as the keys of toCacheMap() in cpp/gen:
+ * existing caches and prefilled data-assets are read with both
+ */
+template <int N>
+Q_DECL_CONSTEXPR inline QLatin1String cacheKey(const char (&key)[N])
+{
+    return QLatin1String(key, N - 1);
+}
+
+namespace ConferenceCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String id = cacheKey("id");
+Q_DECL_CONSTEXPR QLatin1String conferenceName = cacheKey("conferenceName");
+Q_DECL_CONSTEXPR QLatin1String conferenceCity = cacheKey("conferenceCity");
+Q_DECL_CONSTEXPR QLatin1String address = cacheKey("address");
+Q_DECL_CONSTEXPR QLatin1String mapAddress = cacheKey("mapAddress");
+Q_DECL_CONSTEXPR QLatin1String timeZoneName = cacheKey("timeZoneName");
+Q_DECL_CONSTEXPR QLatin1String timeZoneOffsetSeconds = cacheKey("timeZoneOffsetSeconds");
+Q_DECL_CONSTEXPR QLatin1String conferenceFrom = cacheKey("conferenceFrom");
+Q_DECL_CONSTEXPR QLatin1String conferenceTo = cacheKey("conferenceTo");
+Q_DECL_CONSTEXPR QLatin1String hashTag = cacheKey("hashTag");
+Q_DECL_CONSTEXPR QLatin1String homePage = cacheKey("homePage");
+Q_DECL_CONSTEXPR QLatin1String coordinate = cacheKey("coordinate");
+Q_DECL_CONSTEXPR QLatin1String placeId = cacheKey("placeId");
+Q_DECL_CONSTEXPR QLatin1String lastRoomId = cacheKey("lastRoomId");
+Q_DECL_CONSTEXPR QLatin1String lastSessionTrackId = cacheKey("lastSessionTrackId");
+Q_DECL_CONSTEXPR QLatin1String lastGenericSessionId = cacheKey("lastGenericSessionId");
+Q_DECL_CONSTEXPR QLatin1String days = cacheKey("days");
+Q_DECL_CONSTEXPR QLatin1String tracks = cacheKey("tracks");
+Q_DECL_CONSTEXPR QLatin1String rooms = cacheKey("rooms");
+}
+
+namespace DayCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String id = cacheKey("id");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String weekDay = cacheKey("weekDay");
+Q_DECL_CONSTEXPR QLatin1String conferenceDay = cacheKey("conferenceDay");
+Q_DECL_CONSTEXPR QLatin1String sessions = cacheKey("sessions");
+}
+
+namespace FavoriteCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String sessionId = cacheKey("sessionId");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String session = cacheKey("session");
+}
+
+namespace RoomCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String roomId = cacheKey("roomId");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String roomName = cacheKey("roomName");
+Q_DECL_CONSTEXPR QLatin1String inAssets = cacheKey("inAssets");
+Q_DECL_CONSTEXPR QLatin1String sessions = cacheKey("sessions");
+}
+
+namespace SessionCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String sessionId = cacheKey("sessionId");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String isDeprecated = cacheKey("isDeprecated");
+Q_DECL_CONSTEXPR QLatin1String sortKey = cacheKey("sortKey");
+Q_DECL_CONSTEXPR QLatin1String isTraining = cacheKey("isTraining");
+Q_DECL_CONSTEXPR QLatin1String isLightning = cacheKey("isLightning");
+Q_DECL_CONSTEXPR QLatin1String isKeynote = cacheKey("isKeynote");
+Q_DECL_CONSTEXPR QLatin1String isSession = cacheKey("isSession");
+Q_DECL_CONSTEXPR QLatin1String isCommunity = cacheKey("isCommunity");
+Q_DECL_CONSTEXPR QLatin1String isUnconference = cacheKey("isUnconference");
+Q_DECL_CONSTEXPR QLatin1String isMeeting = cacheKey("isMeeting");
+Q_DECL_CONSTEXPR QLatin1String isGenericScheduleSession = cacheKey("isGenericScheduleSession");
+Q_DECL_CONSTEXPR QLatin1String isBreak = cacheKey("isBreak");
+Q_DECL_CONSTEXPR QLatin1String isLunch = cacheKey("isLunch");
+Q_DECL_CONSTEXPR QLatin1String isEvent = cacheKey("isEvent");
+Q_DECL_CONSTEXPR QLatin1String isRegistration = cacheKey("isRegistration");
+Q_DECL_CONSTEXPR QLatin1String title = cacheKey("title");
+Q_DECL_CONSTEXPR QLatin1String description = cacheKey("description");
+Q_DECL_CONSTEXPR QLatin1String sessionType = cacheKey("sessionType");
+Q_DECL_CONSTEXPR QLatin1String startTime = cacheKey("startTime");
+Q_DECL_CONSTEXPR QLatin1String endTime = cacheKey("endTime");
+Q_DECL_CONSTEXPR QLatin1String minutes = cacheKey("minutes");
+Q_DECL_CONSTEXPR QLatin1String abstractText = cacheKey("abstractText");
+Q_DECL_CONSTEXPR QLatin1String sessionDay = cacheKey("sessionDay");
+Q_DECL_CONSTEXPR QLatin1String room = cacheKey("room");
+Q_DECL_CONSTEXPR QLatin1String presenter = cacheKey("presenter");
+Q_DECL_CONSTEXPR QLatin1String sessionTracks = cacheKey("sessionTracks");
+}
+
+namespace SessionListsCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String uuid = cacheKey("uuid");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String scheduledSessions = cacheKey("scheduledSessions");
+Q_DECL_CONSTEXPR QLatin1String sameTimeSessions = cacheKey("sameTimeSessions");
+}
+
+namespace SessionTrackCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String trackId = cacheKey("trackId");
+Q_DECL_CONSTEXPR QLatin1String conference = cacheKey("conference");
+Q_DECL_CONSTEXPR QLatin1String name = cacheKey("name");
+Q_DECL_CONSTEXPR QLatin1String color = cacheKey("color");
+Q_DECL_CONSTEXPR QLatin1String inAssets = cacheKey("inAssets");
+Q_DECL_CONSTEXPR QLatin1String sessions = cacheKey("sessions");
+}
+
+namespace SpeakerCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String speakerId = cacheKey("speakerId");
+Q_DECL_CONSTEXPR QLatin1String isDeprecated = cacheKey("isDeprecated");
+Q_DECL_CONSTEXPR QLatin1String sortKey = cacheKey("sortKey");
+Q_DECL_CONSTEXPR QLatin1String sortGroup = cacheKey("sortGroup");
+Q_DECL_CONSTEXPR QLatin1String name = cacheKey("name");
+Q_DECL_CONSTEXPR QLatin1String publicName = cacheKey("publicName");
+Q_DECL_CONSTEXPR QLatin1String title = cacheKey("title");
+Q_DECL_CONSTEXPR QLatin1String bio = cacheKey("bio");
+Q_DECL_CONSTEXPR QLatin1String speakerImage = cacheKey("speakerImage");
+Q_DECL_CONSTEXPR QLatin1String sessions = cacheKey("sessions");
+Q_DECL_CONSTEXPR QLatin1String conferences = cacheKey("conferences");
+}
+
+namespace SpeakerImageCacheKeys {
+Q_DECL_CONSTEXPR QLatin1String speakerId = cacheKey("speakerId");
+Q_DECL_CONSTEXPR QLatin1String originImageUrl = cacheKey("originImageUrl");
+Q_DECL_CONSTEXPR QLatin1String downloadSuccess = cacheKey("downloadSuccess");
+Q_DECL_CONSTEXPR QLatin1String downloadFailed = cacheKey("downloadFailed");
+Q_DECL_CONSTEXPR QLatin1String inAssets = cacheKey("inAssets");
+Q_DECL_CONSTEXPR QLatin1String inData = cacheKey("inData");
+Q_DECL_CONSTEXPR QLatin1String suffix = cacheKey("suffix");
+Q_DECL_CONSTEXPR QLatin1String maxScaleFactor = cacheKey("maxScaleFactor");
+}
+
+#endif // CACHEKEYS_HPP
@@ -0,0 +1,136 @@
+#include "cachesnapshot.hpp"
+
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDebug>
+
+static const quint32 SNAPSHOT_MAGIC = 0xC2C5A900;
+static const quint16 SNAPSHOT_FORMAT_VERSION = 1;
+// never change this: snapshots must be readable by all app versions using the same format version
+static const int SNAPSHOT_STREAM_VERSION = QDataStream::Qt_5_6;
+
+static qint64 cacheFileModified(const QFileInfo& cacheFileInfo)
+{
+    return cacheFileInfo.lastModified().toMSecsSinceEpoch();
+}
+
+CacheSnapshotReader::CacheSnapshotReader(const QString& snapshotPath) :
+    mFile(snapshotPath), mMapped(nullptr), mCount(0)
+{
+}
+
+CacheSnapshotReader::~CacheSnapshotReader()
+{
+    // mBytes only wraps the mapped memory - must go away before unmap
+    mStream.setDevice(nullptr);
+    mBuffer.close();
+    mBytes.clear();
+    if (mMapped) {
+        mFile.unmap(mMapped);
+        mMapped = nullptr;
+    }
+    mFile.close();
+}
+
+bool CacheSnapshotReader::open(const quint16 schemaVersion, const QString& cacheFilePath)
+{
+    QFileInfo cacheFileInfo(cacheFilePath);
+    if (!mFile.exists() || !cacheFileInfo.exists() || mFile.size() == 0) {
+        return false;
+    }
+    if (!mFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "Couldn't open snapshot: " << mFile.fileName();
+        return false;
+    }
+    mMapped = mFile.map(0, mFile.size());
+    if (!mMapped) {
+        qWarning() << "Couldn't map snapshot: " << mFile.fileName();
+        return false;
+    }
+    // no deep copy: the stream reads directly from mapped memory
+    mBytes = QByteArray::fromRawData(reinterpret_cast<const char*>(mMapped), static_cast<int>(mFile.size()));
+    mBuffer.setBuffer(&mBytes);
+    mBuffer.open(QIODevice::ReadOnly);
+    mStream.setDevice(&mBuffer);
+    mStream.setVersion(SNAPSHOT_STREAM_VERSION);
+
+    quint32 magic = 0;
+    quint16 formatVersion = 0;
+    quint16 entitySchemaVersion = 0;
+    qint64 cacheFileSize = -1;
+    qint64 cacheFileLastModified = -1;
+    qint32 count = 0;
+    mStream >> magic >> formatVersion >> entitySchemaVersion >> cacheFileSize >> cacheFileLastModified >> count;
+    if (mStream.status() != QDataStream::Ok || magic != SNAPSHOT_MAGIC) {
+        qWarning() << "not a valid snapshot: " << mFile.fileName();
+        return false;
+    }
+    if (formatVersion != SNAPSHOT_FORMAT_VERSION || entitySchemaVersion != schemaVersion) {
+        qDebug() << "snapshot version outdated: " << mFile.fileName();
+        return false;
+    }
+    if (cacheFileSize != cacheFileInfo.size() || cacheFileLastModified != cacheFileModified(cacheFileInfo)) {
+        qDebug() << "snapshot outdated - JSON cache was changed: " << cacheFilePath;
+        return false;
+    }
+    if (count < 0) {
+        return false;
+    }
+    mCount = count;
+    return true;
+}
+
+int CacheSnapshotReader::count() const
+{
+    return mCount;
+}
+
+QDataStream& CacheSnapshotReader::stream()
+{
+    return mStream;
+}
+
+bool CacheSnapshotReader::hasError() const
+{
+    return mStream.status() != QDataStream::Ok;
+}
+
+CacheSnapshotWriter::CacheSnapshotWriter(const QString& snapshotPath) :
+    mFile(snapshotPath)
+{
+}
+
+bool CacheSnapshotWriter::open(const quint16 schemaVersion, const QString& cacheFilePath, const int count)
+{
+    QFileInfo cacheFileInfo(cacheFilePath);
+    if (!cacheFileInfo.exists()) {
+        // nothing to stamp - a snapshot without JSON master would never be valid
+        return false;
+    }
+    if (!mFile.open(QIODevice::WriteOnly)) {
+        qWarning() << "Couldn't open snapshot to write " << mFile.fileName();
+        return false;
+    }
+    mStream.setDevice(&mFile);
+    mStream.setVersion(SNAPSHOT_STREAM_VERSION);
+    mStream << SNAPSHOT_MAGIC << SNAPSHOT_FORMAT_VERSION << schemaVersion
+            << static_cast<qint64>(cacheFileInfo.size()) << cacheFileModified(cacheFileInfo)
+            << static_cast<qint32>(count);
+    return mStream.status() == QDataStream::Ok;
+}
+
+QDataStream& CacheSnapshotWriter::stream()
+{
+    return mStream;
+}
+
+bool CacheSnapshotWriter::commit()
+{
+    if (mStream.status() != QDataStream::Ok) {
+        qWarning() << "Couldn't write snapshot " << mFile.fileName();
+        mFile.cancelWriting();
+        return false;
+    }
+    mStream.setDevice(nullptr);
+    return mFile.commit();
+}
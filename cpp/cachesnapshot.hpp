@@ -0,0 +1,133 @@
+#ifndef CACHESNAPSHOT_HPP
+#define CACHESNAPSHOT_HPP
+
+#include <QString>
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QBuffer>
+#include <QSaveFile>
+#include <QList>
+#include <QObject>
+#include <QDebug>
+
+/*
+ * Binary snapshot of a JSON cache file (cacheXYZ.json -> cacheXYZ.snapshot)
+ *
+ * Layout:
+ *   quint32 magic
+ *   quint16 snapshot format version
+ *   quint16 entity schema version
+ *   qint64  size of the JSON cache file the snapshot was written for
+ *   qint64  last modified (ms since epoch, UTC) of that JSON cache file
+ *   qint32  number of records
+ *   records written by the DTO's toSnapshot()
+ *
+ * The JSON cache always stays the master. A snapshot is only used if magic,
+ * versions and the stamp of the JSON file match - otherwise DataManager
+ * falls back to JSON and writes a new snapshot (migration of old caches).
+ */
+
+class CacheSnapshotReader
+{
+public:
+    explicit CacheSnapshotReader(const QString& snapshotPath);
+    ~CacheSnapshotReader();
+
+    // maps the snapshot into memory and validates the header
+    bool open(const quint16 schemaVersion, const QString& cacheFilePath);
+
+    int count() const;
+    QDataStream& stream();
+    bool hasError() const;
+
+private:
+    QFile mFile;
+    uchar* mMapped;
+    QByteArray mBytes;
+    QBuffer mBuffer;
+    QDataStream mStream;
+    int mCount;
+
+    Q_DISABLE_COPY(CacheSnapshotReader)
+};
+
+class CacheSnapshotWriter
+{
+public:
+    explicit CacheSnapshotWriter(const QString& snapshotPath);
+
+    // writes the header - stamps the already written JSON cache file
+    bool open(const quint16 schemaVersion, const QString& cacheFilePath, const int count);
+
+    QDataStream& stream();
+    // atomically replaces the previous snapshot
+    bool commit();
+
+private:
+    QSaveFile mFile;
+    QDataStream mStream;
+
+    Q_DISABLE_COPY(CacheSnapshotWriter)
+};
+
+/*
+ * snapshot of a list of data objects (Session*, Speaker*, ...)
+ * records: T::fillFromSnapshot() / T::toSnapshot() (cpp/cachedatastream.cpp)
+ */
+class CacheSnapshot
+{
+public:
+    // appends a new T* per record - false if there's no valid snapshot
+    // for the cache file or if it's corrupt, no T* appended then
+    template<class T>
+    static bool readObjects(const QString& snapshotPath, const quint16 schemaVersion, const QString& cacheFilePath,
+                            QObject* parent, QList<QObject*>& objects);
+
+    // must be called after the cache file was written
+    template<class T>
+    static bool writeObjects(const QString& snapshotPath, const quint16 schemaVersion, const QString& cacheFilePath,
+                             const QList<QObject*>& objects);
+};
+
+template<class T>
+bool CacheSnapshot::readObjects(const QString& snapshotPath, const quint16 schemaVersion, const QString& cacheFilePath,
+                                QObject* parent, QList<QObject*>& objects)
+{
+    CacheSnapshotReader snapshot(snapshotPath);
+    if (!snapshot.open(schemaVersion, cacheFilePath)) {
+        return false;
+    }
+    const int sizeBefore = objects.size();
+    objects.reserve(sizeBefore + snapshot.count());
+    for (int i = 0; i < snapshot.count() && !snapshot.hasError(); ++i) {
+        T* object = new T();
+        object->setParent(parent);
+        object->fillFromSnapshot(snapshot.stream());
+        objects.append(object);
+    }
+    if (snapshot.hasError()) {
+        qWarning() << "snapshot corrupt - using cache file" << cacheFilePath;
+        while (objects.size() > sizeBefore) {
+            delete objects.takeLast();
+        }
+        return false;
+    }
+    return true;
+}
+
+template<class T>
+bool CacheSnapshot::writeObjects(const QString& snapshotPath, const quint16 schemaVersion, const QString& cacheFilePath,
+                                 const QList<QObject*>& objects)
+{
+    CacheSnapshotWriter snapshot(snapshotPath);
+    if (!snapshot.open(schemaVersion, cacheFilePath, objects.size())) {
+        return false;
+    }
+    for (int i = 0; i < objects.size(); ++i) {
+        static_cast<T*>(objects.at(i))->toSnapshot(snapshot.stream());
+    }
+    return snapshot.commit();
+}
+
+#endif // CACHESNAPSHOT_HPP
@@ -0,0 +1,134 @@
+/*
+ * binary snapshots of the DataManager caches: cacheXYZ.json -> cacheXYZ.snapshot
+ * thin wrappers around CacheSnapshot (cachesnapshot.hpp), declared in cpp/gen/DataManager.hpp
+ *
+ * not generated: keep this file when regenerating cpp/gen
+ * and re-add the declarations (see gen-model/README.md)
+ */
+#include "gen/DataManager.hpp"
+#include "cachesnapshot.hpp"
+
+#include <QDebug>
+
+// increment if properties of cached DTOs were changed (cpp/cachedatastream.cpp)
+static const quint16 snapshotSchemaVersion = 1;
+
+bool DataManager::initConferenceFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllConference.size();
+    if (!CacheSnapshot::readObjects<Conference>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllConference)) {
+        return false;
+    }
+    qDebug() << "created Conference* from snapshot" << fileName << "#" << mAllConference.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveConferenceToSnapshot(const QString& fileName, const QList<QObject*>& conferences)
+{
+    CacheSnapshot::writeObjects<Conference>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), conferences);
+}
+
+bool DataManager::initRoomFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllRoom.size();
+    if (!CacheSnapshot::readObjects<Room>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllRoom)) {
+        return false;
+    }
+    qDebug() << "created Room* from snapshot" << fileName << "#" << mAllRoom.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveRoomToSnapshot(const QString& fileName, const QList<QObject*>& rooms)
+{
+    CacheSnapshot::writeObjects<Room>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), rooms);
+}
+
+bool DataManager::initSessionFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllSession.size();
+    if (!CacheSnapshot::readObjects<Session>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllSession)) {
+        return false;
+    }
+    qDebug() << "created Session* from snapshot" << fileName << "#" << mAllSession.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveSessionToSnapshot(const QString& fileName, const QList<QObject*>& sessions)
+{
+    CacheSnapshot::writeObjects<Session>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), sessions);
+}
+
+bool DataManager::initFavoriteFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllFavorite.size();
+    if (!CacheSnapshot::readObjects<Favorite>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllFavorite)) {
+        return false;
+    }
+    qDebug() << "created Favorite* from snapshot" << fileName << "#" << mAllFavorite.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveFavoriteToSnapshot(const QString& fileName, const QList<QObject*>& favorites)
+{
+    CacheSnapshot::writeObjects<Favorite>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), favorites);
+}
+
+bool DataManager::initSpeakerFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllSpeaker.size();
+    if (!CacheSnapshot::readObjects<Speaker>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllSpeaker)) {
+        return false;
+    }
+    qDebug() << "created Speaker* from snapshot" << fileName << "#" << mAllSpeaker.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveSpeakerToSnapshot(const QString& fileName, const QList<QObject*>& speakers)
+{
+    CacheSnapshot::writeObjects<Speaker>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), speakers);
+}
+
+bool DataManager::initSpeakerImageFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllSpeakerImage.size();
+    if (!CacheSnapshot::readObjects<SpeakerImage>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllSpeakerImage)) {
+        return false;
+    }
+    qDebug() << "created SpeakerImage* from snapshot" << fileName << "#" << mAllSpeakerImage.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveSpeakerImageToSnapshot(const QString& fileName, const QList<QObject*>& speakerImages)
+{
+    CacheSnapshot::writeObjects<SpeakerImage>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), speakerImages);
+}
+
+bool DataManager::initSessionTrackFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllSessionTrack.size();
+    if (!CacheSnapshot::readObjects<SessionTrack>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllSessionTrack)) {
+        return false;
+    }
+    qDebug() << "created SessionTrack* from snapshot" << fileName << "#" << mAllSessionTrack.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveSessionTrackToSnapshot(const QString& fileName, const QList<QObject*>& sessionTracks)
+{
+    CacheSnapshot::writeObjects<SessionTrack>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), sessionTracks);
+}
+
+bool DataManager::initDayFromSnapshot(const QString& fileName)
+{
+    const int loadedBefore = mAllDay.size();
+    if (!CacheSnapshot::readObjects<Day>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), this, mAllDay)) {
+        return false;
+    }
+    qDebug() << "created Day* from snapshot" << fileName << "#" << mAllDay.size() - loadedBefore;
+    return true;
+}
+
+void DataManager::saveDayToSnapshot(const QString& fileName, const QList<QObject*>& days)
+{
+    CacheSnapshot::writeObjects<Day>(snapshotPath(fileName), snapshotSchemaVersion, dataPath(fileName), days);
+}
@@ -1,6 +1,18 @@
 #include "dataserver.hpp"
 
 #include <QSslConfiguration>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+// validators are stored per resource (file name or 'version')
+const QString VALIDATORS_FILE = "httpValidators.json";
+const QString VERSION_RESOURCE = "version";
+const QString ETAG = "etag";
+const QString LAST_MODIFIED = "lastModified";
+// payload of resources not stored in a file
+const QString BODY = "body";
+// file name (in conference data path) a reply is streamed to
+const QNetworkRequest::Attribute DOWNLOAD_FILE_ATTRIBUTE = QNetworkRequest::User;
 
 DataServer::DataServer(QObject *parent) : QObject(parent)
 {
@@ -19,9 +31,14 @@ void DataServer::init(DataManager *dataManager)
 {
     mDataManager = dataManager;
 
+    // can be set to a local HTTP server for testing
+    mPendingRequests = 0;
+    mApiBaseUrl = qEnvironmentVariable("QTWS_API_BASE_URL", "https://www.qtworldsummit.com/2018/api/");
+
     // workaround bug iOS - cannot reuse QNetworkAccessManager QTBUG-49751
     // otherwise accessibility not detected if switch off and on again
-    // mNetworkAccessManager = new QNetworkAccessManager(this);
+    // NetworkService creates a new QNetworkAccessManager if online state changed
+    mNetworkService = new NetworkService(this);
 
     // ONLINE, OFFLINE, HUNGRY
     // get this from settings:
@@ -69,6 +86,9 @@ void DataServer::init(DataManager *dataManager)
     connectResult = connect(mOnlineStateCollector, SIGNAL(timeout()), this, SLOT(onOnlineStateCollected()));
     Q_ASSERT(connectResult);
 
+    connectResult = connect(this, SIGNAL(onlineChanged(bool)), mNetworkService, SLOT(onOnlineChanged(bool)));
+    Q_ASSERT(connectResult);
+
     if(mUseOnlineStableTimer) {
         connectResult = connect(mOnlineStableTimer, SIGNAL(timeout()), this, SLOT(onOnlineStableConnection()));
         Q_ASSERT(connectResult);
@@ -212,66 +232,188 @@ void DataServer::statusChanged(utility::NetworkStatus newStatus)
 // ONLINE end
 
 
+NetworkService* DataServer::networkService()
+{
+    return mNetworkService;
+}
+
 void DataServer::setConferenceDataPath(const QString &conferenceDataPath)
 {
     mConferenceDataPath = conferenceDataPath;
     qDebug() << "Conference Data path: " << mConferenceDataPath;
+    readValidators();
 }
 
-void DataServer::requestSchedule(const int conferenceId)
+// CONDITIONAL REQUESTS
+QString DataServer::validatorsFilePath()
 {
-    // workaround bug iOS - cannot reuse QNetworkAccessManager QTBUG-49751
-    // otherwise accessibility not detected if switch off and on again
-    QNetworkAccessManager* networkAccessManager = new QNetworkAccessManager(this);
-    if(networkAccessManager->networkAccessible() != QNetworkAccessManager::Accessible) {
-        if(networkAccessManager->networkAccessible() == QNetworkAccessManager::NotAccessible) {
-            qDebug() << "requestSchedule NO ACCESS TO NETWORK";
-            emit serverFailed(tr("No Network Access"));
+    return mConferenceDataPath + VALIDATORS_FILE;
+}
+
+void DataServer::readValidators()
+{
+    mValidators.clear();
+    QFile readFile(validatorsFilePath());
+    if(!readFile.exists()) {
+        qDebug() << "no HTTP validators stored yet";
+        return;
+    }
+    if (!readFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "Couldn't open file: " << validatorsFilePath();
+        return;
+    }
+    QJsonDocument jda = QJsonDocument::fromJson(readFile.readAll());
+    readFile.close();
+    if(!jda.isObject()) {
+        qWarning() << "Couldn't create JSON from file: " << validatorsFilePath();
+        return;
+    }
+    mValidators = jda.toVariant().toMap();
+}
+
+void DataServer::saveValidators()
+{
+    QFile saveFile(validatorsFilePath());
+    if (!saveFile.open(QIODevice::WriteOnly)) {
+        qWarning() << "Couldn't open file to write " << validatorsFilePath();
+        return;
+    }
+    QJsonDocument jda = QJsonDocument::fromVariant(mValidators);
+    saveFile.write(jda.toJson(QJsonDocument::Compact));
+    saveFile.close();
+}
+
+// only ask for modifications if we still have the data of last request
+void DataServer::addValidators(QNetworkRequest& request, const QString& resource)
+{
+    QVariantMap validatorMap = mValidators.value(resource).toMap();
+    if(validatorMap.isEmpty()) {
+        return;
+    }
+    if(validatorMap.contains(BODY)) {
+        if(validatorMap.value(BODY).toString().isEmpty()) {
             return;
         }
-        qDebug() << "requestSchedule NO ACCESS: The network accessibility cannot be determined.";
-        emit serverFailed(tr("No Network Access"));
+    } else if(!QFile::exists(mConferenceDataPath+resource)) {
+        return;
+    }
+    const QString etag = validatorMap.value(ETAG).toString();
+    if(!etag.isEmpty()) {
+        request.setRawHeader("If-None-Match", etag.toUtf8());
+    }
+    const QString lastModified = validatorMap.value(LAST_MODIFIED).toString();
+    if(!lastModified.isEmpty()) {
+        request.setRawHeader("If-Modified-Since", lastModified.toUtf8());
+    }
+}
+
+// empty if server sent no validators
+QVariantMap DataServer::validatorsFromReply(QNetworkReply* reply)
+{
+    QVariantMap validatorMap;
+    if(reply->hasRawHeader("ETag")) {
+        validatorMap.insert(ETAG, QString::fromUtf8(reply->rawHeader("ETag")));
+    }
+    if(reply->hasRawHeader("Last-Modified")) {
+        validatorMap.insert(LAST_MODIFIED, QString::fromUtf8(reply->rawHeader("Last-Modified")));
+    }
+    return validatorMap;
+}
+
+bool DataServer::hasModifiedData()
+{
+    return !mModifiedResources.isEmpty();
+}
+
+void DataServer::commitValidators()
+{
+    if(mPendingValidators.isEmpty()) {
+        return;
+    }
+    QMapIterator<QString, QVariant> validatorsIterator(mPendingValidators);
+    while (validatorsIterator.hasNext()) {
+        validatorsIterator.next();
+        mValidators.insert(validatorsIterator.key(), validatorsIterator.value());
+    }
+    mPendingValidators.clear();
+    saveValidators();
+}
+
+// schedules of all conferences and speaker are requested at the same time
+// serverSuccess() or serverFailed() is emitted after the last one was finished
+void DataServer::requestUpdate(const QList<ScheduleSource> sources)
+{
+    if(mPendingRequests > 0) {
+        qWarning() << "requestUpdate: still waiting for " << mPendingRequests << " requests";
+        return;
+    }
+    mPendingValidators.clear();
+    mModifiedResources.clear();
+    mUpdateFailures.clear();
+    // all requests counted before sending: failures can be reported immediately
+    mPendingRequests = sources.size() + 1;
+    for (int i = 0; i < sources.size(); ++i) {
+        requestSchedule(sources.at(i).conferenceId, sources.at(i).location);
+    }
+    requestSpeaker();
+}
+
+// join: all requests of this update done
+void DataServer::requestFinished()
+{
+    mPendingRequests--;
+    if(mPendingRequests > 0) {
+        return;
+    }
+    if(mUpdateFailures.isEmpty()) {
+        emit serverSuccess();
+        return;
+    }
+    emit serverFailed(mUpdateFailures.join("\n"));
+}
+
+void DataServer::requestFailed(const QString message)
+{
+    // per ex. 'No Network Access' only once
+    if(!mUpdateFailures.contains(message)) {
+        mUpdateFailures.append(message);
+    }
+    requestFinished();
+}
+
+void DataServer::requestSchedule(const int conferenceId, const QString location)
+{
+    if(!mNetworkService->isNetworkAccessible()) {
+        qDebug() << "requestSchedule NO ACCESS TO NETWORK";
+        requestFailed(tr("No Network Access"));
         return;
     }
 
     QString uri;
     // uri = "https://conf.qtcon.org/en/qtcon/public/schedule.json";
     // uri = "http://www.qtworldsummit.com/api/schedule/all/";
-    if(conferenceId == 201801) {
-        uri = "https://www.qtworldsummit.com/2018/api/schedule/all/?location=Boston";
-    } else {
-        uri = "https://www.qtworldsummit.com/2018/api/schedule/all/?location=Berlin";
-    }
+    uri = mApiBaseUrl + "schedule/all/?location=" + location;
 
     qDebug() << "requestSchedule uri:" << uri;
 
     QNetworkRequest request(uri);
     QByteArray ba = QString::number(conferenceId).toUtf8();
     request.setRawHeader("CONFERENCE_ID", ba);
+    addValidators(request, "schedule_"+QString::number(conferenceId)+".json");
+    request.setAttribute(DOWNLOAD_FILE_ATTRIBUTE, "schedule_"+QString::number(conferenceId)+".json");
 
     // to avoid ssl errors:
     QSslConfiguration conf = request.sslConfiguration();
     conf.setPeerVerifyMode(QSslSocket::VerifyNone);
     request.setSslConfiguration(conf);
 
-    QNetworkReply* reply = networkAccessManager->get(request);
-    bool connectResult = connect(reply, SIGNAL(finished()), this, SLOT(onFinishedSchedule()));
-    Q_ASSERT(connectResult);
-    Q_UNUSED(connectResult);
+    mNetworkService->get(request, this, SLOT(onFinishedSchedule()), SLOT(onDownloadReadyRead()));
 }
 
 void DataServer::requestVersion()
 {
-    // workaround bug iOS - cannot reuse QNetworkAccessManager QTBUG-49751
-    // otherwise accessibility not detected if switch off and on again
-    QNetworkAccessManager* networkAccessManager = new QNetworkAccessManager(this);
-    if(networkAccessManager->networkAccessible() != QNetworkAccessManager::Accessible) {
-        if(networkAccessManager->networkAccessible() == QNetworkAccessManager::NotAccessible) {
-            qDebug() << "requestVersion NO ACCESS TO NETWORK";
-            emit versionFailed(tr("No Network Access"));
-            return;
-        }
-        qDebug() << "requestVersion NO ACCESS: The network accessibility cannot be determined.";
+    if(!mNetworkService->isNetworkAccessible()) {
+        qDebug() << "requestVersion NO ACCESS TO NETWORK";
         emit versionFailed(tr("No Network Access"));
         return;
     }
@@ -279,103 +421,147 @@ void DataServer::requestVersion()
     QString uri;
     // uri = "https://conf.qtcon.org/en/qtcon/public/schedule/version.json";
     // uri = "http://www.qtworldsummit.com/api/version/show/";
-    uri = "https://www.qtworldsummit.com/2018/api/version/show/";
+    uri = mApiBaseUrl + "version/show/";
     qDebug() << "requestVersion uri:" << uri;
 
     QNetworkRequest request(uri);
+    addValidators(request, VERSION_RESOURCE);
 
     // to avoid ssl errors:
 //    QSslConfiguration conf = request.sslConfiguration();
 //    conf.setPeerVerifyMode(QSslSocket::VerifyNone);
 //    request.setSslConfiguration(conf);
 
-    QNetworkReply* reply = networkAccessManager->get(request);
-    bool connectResult = connect(reply, SIGNAL(finished()), this, SLOT(onFinishedVersion()));
-    Q_ASSERT(connectResult);
-    Q_UNUSED(connectResult);
+    mNetworkService->get(request, this, SLOT(onFinishedVersion()));
 }
 
 void DataServer::requestSpeaker()
 {
-    // workaround bug iOS - cannot reuse QNetworkAccessManager QTBUG-49751
-    // otherwise accessibility not detected if switch off and on again
-    QNetworkAccessManager* networkAccessManager = new QNetworkAccessManager(this);
-    if(networkAccessManager->networkAccessible() != QNetworkAccessManager::Accessible) {
-        if(networkAccessManager->networkAccessible() == QNetworkAccessManager::NotAccessible) {
-            qDebug() << "requestSpeaker NO ACCESS TO NETWORK";
-            emit serverFailed(tr("No Network Access"));
-            return;
-        }
-        qDebug() << "requestSpeaker NO ACCESS: The network accessibility cannot be determined.";
-        emit serverFailed(tr("No Network Access"));
+    if(!mNetworkService->isNetworkAccessible()) {
+        qDebug() << "requestSpeaker NO ACCESS TO NETWORK";
+        requestFailed(tr("No Network Access"));
         return;
     }
 
     QString uri;
     // uri = "https://conf.qtcon.org/en/qtcon/public/speakers.json";
     // uri = "http://www.qtworldsummit.com/api/speakers/all/";
-    uri = "https://www.qtworldsummit.com/2018/api/speakers/all/";
+    uri = mApiBaseUrl + "speakers/all/";
     qDebug() << "requestSpeaker uri:" << uri;
 
     QNetworkRequest request(uri);
+    addValidators(request, "speaker.json");
+    request.setAttribute(DOWNLOAD_FILE_ATTRIBUTE, "speaker.json");
 
     // to avoid ssl errors:
     QSslConfiguration conf = request.sslConfiguration();
     conf.setPeerVerifyMode(QSslSocket::VerifyNone);
     request.setSslConfiguration(conf);
 
-    QNetworkReply* reply = networkAccessManager->get(request);
-    bool connectResult = connect(reply, SIGNAL(finished()), this, SLOT(onFinishedSpeaker()));
-    Q_ASSERT(connectResult);
-    Q_UNUSED(connectResult);
+    mNetworkService->get(request, this, SLOT(onFinishedSpeaker()), SLOT(onDownloadReadyRead()));
 }
 
 // SLOTS
-void DataServer::onFinishedSchedule()
+// reply bytes are written to a temp file while receiving
+// see finishDownload()
+void DataServer::onDownloadReadyRead()
 {
     QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
     if(!reply) {
-        qWarning() << "Schedule REPLY is NULL";
-        emit serverFailed(tr("No Network Reply"));
-        return;
-    }
-    const qint64 available = reply->bytesAvailable();
-    if(available == 0) {
-        qWarning() << "Schedule: No Bytes received";
-        emit serverFailed(tr("No Schedule Data received"));
         return;
     }
     int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
-    qDebug() << "schedule HTTP STATUS: " << httpStatusCode << " Bytes: " << available;
     if(httpStatusCode != 200) {
-        qDebug() << "Schedule Status Code not 200";
-        emit serverFailed(tr("No sucess getting Schedule from Server. Got HTTP Status ")+QString::number(httpStatusCode));
+        // 304 Not Modified or error: nothing to store
         return;
     }
-    // more schedules this year ?
-    QByteArray ba = reply->request().rawHeader("CONFERENCE_ID");
-    QString conferenceString = QString::fromUtf8(ba);
+    QSaveFile* saveFile = mDownloadFiles.value(reply);
+    if(!saveFile) {
+        const QString filePath = mConferenceDataPath + reply->request().attribute(DOWNLOAD_FILE_ATTRIBUTE).toString();
+        saveFile = new QSaveFile(filePath);
+        if (!saveFile->open(QIODevice::WriteOnly)) {
+            // data stays buffered in reply - reported from finishDownload()
+            qWarning() << "Couldn't open file to write " << filePath;
+            delete saveFile;
+            return;
+        }
+        mDownloadFiles.insert(reply, saveFile);
+    }
+    saveFile->write(reply->readAll());
+}
 
-    QString scheduleFilePath = mConferenceDataPath+"schedule_"+conferenceString+".json";
-    QFile saveFile(scheduleFilePath);
-    if (!saveFile.open(QIODevice::WriteOnly)) {
-        qWarning() << "Couldn't open file to write " << scheduleFilePath;
-        emit serverFailed(tr("Schedule Data cannot be written"));
-        return;
+// writes the rest of data and replaces the file atomically
+// returns bytes written, 0 if no data, -1 if file cannot be written
+qint64 DataServer::finishDownload(QNetworkReply* reply)
+{
+    QSaveFile* saveFile = mDownloadFiles.take(reply);
+    if(!saveFile) {
+        const QString filePath = mConferenceDataPath + reply->request().attribute(DOWNLOAD_FILE_ATTRIBUTE).toString();
+        saveFile = new QSaveFile(filePath);
+        if (!saveFile->open(QIODevice::WriteOnly)) {
+            qWarning() << "Couldn't open file to write " << filePath;
+            delete saveFile;
+            return -1;
+        }
     }
-    qint64 bytesWritten = saveFile.write(reply->readAll());
-    saveFile.close();
-    qDebug() << "Schedule Data Bytes written: " << bytesWritten << " to: " << scheduleFilePath;
+    if(reply->bytesAvailable() > 0) {
+        saveFile->write(reply->readAll());
+    }
+    qint64 bytesWritten = saveFile->size();
+    if(bytesWritten > 0 && !saveFile->commit()) {
+        qWarning() << "Couldn't commit file " << saveFile->fileName() << saveFile->errorString();
+        bytesWritten = -1;
+    }
+    // not committed: temp file is removed, current file is untouched
+    delete saveFile;
+    return bytesWritten;
+}
+
+void DataServer::discardDownload(QNetworkReply* reply)
+{
+    delete mDownloadFiles.take(reply);
+}
 
-    // more schedules this year ?
-    int conferenceId = conferenceString.toInt();
-    if(conferenceId == 201801) {
-        requestSchedule(201802);
+void DataServer::onFinishedSchedule()
+{
+    QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
+    if(!reply) {
+        qWarning() << "Schedule REPLY is NULL";
+        requestFailed(tr("No Network Reply"));
         return;
     }
+    QByteArray ba = reply->request().rawHeader("CONFERENCE_ID");
+    QString conferenceString = QString::fromUtf8(ba);
+    const QString scheduleFileName = "schedule_"+conferenceString+".json";
 
-    // now getting the speaker data
-    requestSpeaker();
+    int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(httpStatusCode == 304) {
+        // schedule file from last update is still valid
+        qDebug() << "Schedule Not Modified " << conferenceString;
+    } else {
+        qDebug() << "schedule HTTP STATUS: " << httpStatusCode;
+        if(httpStatusCode != 200) {
+            qDebug() << "Schedule Status Code not 200";
+            discardDownload(reply);
+            requestFailed(tr("No sucess getting Schedule from Server. Got HTTP Status ")+QString::number(httpStatusCode)+" "+conferenceString);
+            return;
+        }
+        qint64 bytesWritten = finishDownload(reply);
+        if(bytesWritten == 0) {
+            qWarning() << "Schedule: No Bytes received";
+            requestFailed(tr("No Schedule Data received")+" "+conferenceString);
+            return;
+        }
+        if(bytesWritten < 0) {
+            requestFailed(tr("Schedule Data cannot be written")+" "+conferenceString);
+            return;
+        }
+        qDebug() << "Schedule Data Bytes written: " << bytesWritten << " to: " << scheduleFileName;
+        mModifiedResources.insert(scheduleFileName);
+        mPendingValidators.insert(scheduleFileName, validatorsFromReply(reply));
+    }
+
+    requestFinished();
 }
 
 void DataServer::onFinishedSpeaker()
@@ -383,34 +569,38 @@ void DataServer::onFinishedSpeaker()
     QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
     if(!reply) {
         qWarning() << "Speaker REPLY is NULL";
-        emit serverFailed(tr("No Network Reply"));
+        requestFailed(tr("No Network Reply"));
         return;
     }
-    const qint64 available = reply->bytesAvailable();
-    if(available == 0) {
-        qWarning() << "Speaker No Bytes received";
-        emit serverFailed(tr("No Speaker Data received"));
+    int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(httpStatusCode == 304) {
+        // speaker file from last update is still valid
+        qDebug() << "Speaker Not Modified";
+        requestFinished();
         return;
     }
-    int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
-    qDebug() << "Speaker HTTP STATUS: " << httpStatusCode << " Bytes: " << available;
+    qDebug() << "Speaker HTTP STATUS: " << httpStatusCode;
     if(httpStatusCode != 200) {
         qDebug() << "Speaker Status Code not 200";
-        emit serverFailed(tr("No sucess getting Speaker from Server. Got HTTP Status ")+QString::number(httpStatusCode));
+        discardDownload(reply);
+        requestFailed(tr("No sucess getting Speaker from Server. Got HTTP Status ")+QString::number(httpStatusCode));
         return;
     }
-    QString speakerFilePath = mConferenceDataPath+"speaker.json";
-    QFile saveFile(speakerFilePath);
-    if (!saveFile.open(QIODevice::WriteOnly)) {
-        qWarning() << "Couldn't open file to write " << speakerFilePath;
-        emit serverFailed(tr("Speaker Data cannot be written"));
+    qint64 bytesWritten = finishDownload(reply);
+    if(bytesWritten == 0) {
+        qWarning() << "Speaker No Bytes received";
+        requestFailed(tr("No Speaker Data received"));
         return;
     }
-    qint64 bytesWritten = saveFile.write(reply->readAll());
-    saveFile.close();
-    qDebug() << "Data Bytes written: " << bytesWritten << " to: " << speakerFilePath;
+    if(bytesWritten < 0) {
+        requestFailed(tr("Speaker Data cannot be written"));
+        return;
+    }
+    qDebug() << "Data Bytes written: " << bytesWritten << " to: speaker.json";
+    mModifiedResources.insert("speaker.json");
+    mPendingValidators.insert("speaker.json", validatorsFromReply(reply));
 
-    emit serverSuccess();
+    requestFinished();
 }
 
 void DataServer::onFinishedVersion()
@@ -421,20 +611,32 @@ void DataServer::onFinishedVersion()
         emit versionFailed(tr("No Network Reply"));
         return;
     }
+    int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(httpStatusCode == 304) {
+        // same version as last time: use stored payload
+        qDebug() << "Version Not Modified";
+        emit versionSuccess(mValidators.value(VERSION_RESOURCE).toMap().value(BODY).toString().toUtf8());
+        return;
+    }
     const qint64 available = reply->bytesAvailable();
     if(available == 0) {
         qWarning() << "Version No Bytes received";
         emit versionFailed(tr("No Version Data received"));
         return;
     }
-    int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
     qDebug() << "Version HTTP STATUS: " << httpStatusCode << " Bytes: " << available;
     if(httpStatusCode != 200) {
         qDebug() << "Version Status Code not 200";
         emit versionFailed(tr("No sucess getting Version from Server. Got HTTP Status ")+QString::number(httpStatusCode));
         return;
     }
-    emit versionSuccess(reply->readAll());
+    QByteArray versionBytes = reply->readAll();
+    // nothing to process downstream: store validators immediately
+    QVariantMap validatorMap = validatorsFromReply(reply);
+    if(!validatorMap.isEmpty()) {
+        validatorMap.insert(BODY, QString::fromUtf8(versionBytes));
+        mValidators.insert(VERSION_RESOURCE, validatorMap);
+        saveValidators();
+    }
+    emit versionSuccess(versionBytes);
 }
-
-
@@ -4,6 +4,8 @@
 #include <QObject>
 
 #include "gen/DataManager.hpp"
+#include "scheduleimporter.hpp"
+#include "networkservice.hpp"
 
 #if defined (Q_OS_IOS)
 #include "ios/src/ReachabilityListener.h"
@@ -17,7 +19,11 @@
 #include <QtNetwork/qnetworkconfigmanager.h>
 #include <QtNetwork/qnetworkconfiguration.h>
 #include <qfile.h>
+#include <QSaveFile>
+#include <QHash>
 #include <QTimer>
+#include <QVariantMap>
+#include <QSet>
 
 class DataServer : public QObject
 #if defined (Q_OS_IOS)
@@ -32,6 +38,8 @@ public:
 
     void init(DataManager* dataManager);
     void setConferenceDataPath(const QString& conferenceDataPath);
+    // shared by all network requests
+    NetworkService* networkService();
 
     // ONLINE, OFFLINE, NETWORK
     Q_INVOKABLE
@@ -44,9 +52,14 @@ public:
     QString networkInfo();
     //
 
-    void requestSchedule(const int conferenceId);
+    void requestUpdate(const QList<ScheduleSource> sources);
     void requestVersion();
 
+    // false if all resources of current update were '304 Not Modified'
+    bool hasModifiedData();
+    // data of current update successfully processed: remember validators
+    void commitValidators();
+
 signals:
     // triggered if online state changed
     void onlineChanged(const bool currentState);
@@ -70,6 +83,7 @@ private slots:
     void onOnlineStableConnection();
 
     // REST
+    void onDownloadReadyRead();
     void onFinishedSchedule();
     void onFinishedSpeaker();
 
@@ -105,8 +119,32 @@ private:
 #endif
 
     // REST
-    QNetworkAccessManager* mNetworkAccessManager;
+    NetworkService* mNetworkService;
+    QString mApiBaseUrl;
+    void requestSchedule(const int conferenceId, const QString location);
     void requestSpeaker();
+    // UPDATE: all requests running in parallel
+    int mPendingRequests;
+    QStringList mUpdateFailures;
+    void requestFinished();
+    void requestFailed(const QString message);
+    // schedule and speaker data are streamed to file
+    QHash<QNetworkReply*, QSaveFile*> mDownloadFiles;
+    qint64 finishDownload(QNetworkReply* reply);
+    void discardDownload(QNetworkReply* reply);
+
+    // CONDITIONAL REQUESTS
+    // validators (ETag, Last-Modified) per resource: persisted, sent with next request
+    QVariantMap mValidators;
+    // validators received during current update - committed if data was processed
+    QVariantMap mPendingValidators;
+    // resources received with '200 OK' during current update
+    QSet<QString> mModifiedResources;
+    QString validatorsFilePath();
+    void readValidators();
+    void saveValidators();
+    void addValidators(QNetworkRequest& request, const QString& resource);
+    QVariantMap validatorsFromReply(QNetworkReply* reply);
 
 };
 
@@ -6,6 +6,12 @@
 #include <QFile>
 #include <QDir>
 #include <QImage>
+#include <QtConcurrent>
+#include <QQmlEngine>
+
+#include <algorithm>
+
+#include "startupprofiler.hpp"
 
 const QString YYYY_MM_DD = "yyyy-MM-dd";
 const QString HH_MM = "HH:mm";
@@ -13,9 +19,11 @@ const QString LOCAL_HH_MM = "hh:mm";
 const QString YYYY_MM_DD_HH_MM = "yyyy-MM-ddHH:mm";
 const QString DAYNAME = "dddd";
 const QString DAYNAME_HH_MM = "dddd, HH:mm";
-const QString DEFAULT_SPEAKER_IMAGE_URL = "https://s3-eu-west-1.amazonaws.com/qt-worldsummit/ws2016/uploads/2016/07/man-silhouette-black-gray.jpg";
-//"http://conf.qtcon.org/person_original.png";
 const QString EMPTY_TRACK = "*****";
+// max speaker images downloaded at the same time
+const int MAX_IMAGE_DOWNLOADS_IN_FLIGHT = 4;
+// max speaker applied per event loop slice while updating
+const int UPDATE_SPEAKER_SLICE = 50;
 
 DataUtil::DataUtil(QObject *parent) : QObject(parent)
 {
@@ -33,10 +41,46 @@ void DataUtil::init(DataManager* dataManager, DataServer* dataServer)
     mSessionLists = mDataManager->createSessionLists();
 
     mCurrentConference = nullptr;
+    mMyScheduleConference = -1;
+    mSpeakerSectionsBuilt = false;
+
+    mSearchResultModel = new SearchResultModel(this);
+    mSearchResultModel->init(&mSearchIndex, mDataManager);
+    mSearchIndexBuilt = false;
+
+    // parsing data from server runs on a worker thread
+    mScheduleImporter = new ScheduleImporter(this);
+    mImportWatcher = new QFutureWatcher<ScheduleImport>(this);
+    mImageDownloadScheduler = new ImageDownloadScheduler(mDataServer->networkService(), MAX_IMAGE_DOWNLOADS_IN_FLIGHT, this);
+    mHighDpiImagesPending = 0;
+    mUpdateCommitting = false;
+    mUpdateSpeakerIndex = 0;
+    mUpdateConferenceIndex = 0;
+    mUpdateDayIndex = 0;
 
     // connections
-    bool res = connect(mDataServer, SIGNAL(serverSuccess()), this,
-                       SLOT(onServerSuccess()));
+    bool res = connect(mScheduleImporter, SIGNAL(importProgress(QString)), this,
+                       SLOT(onImportProgress(QString)));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(mImageDownloadScheduler, SIGNAL(loaded(QObject*, QImage)), this,
+                  SLOT(onSpeakerImageUpdateLoaded(QObject*, QImage)));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(mImageDownloadScheduler, SIGNAL(loadingFailed(QObject*, QString)), this,
+                  SLOT(onSpeakerImageUpdateFailed(QObject*, QString)));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(mImportWatcher, SIGNAL(finished()), this,
+                  SLOT(onImportFinished()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(mDataServer, SIGNAL(serverSuccess()), this,
+                  SLOT(onServerSuccess()));
     if (!res) {
         Q_ASSERT(res);
     }
@@ -274,8 +318,23 @@ void DataUtil::reloadData() {
     // reload
     mProgressInfotext.append(tr(" Reload"));
     emit progressInfo(mProgressInfotext);
-    // DO IT
+    // all Sessions will be deleted
+    mSessionLists->clearScheduledSessions();
+    mMyScheduleConference = -1;
+    mCurrentConference = nullptr;
     mDataManager->init();
+    // all DataObjects were read again
+    resetDerivedIndexes();
+}
+
+// speaker sections, day time index and search index
+// must be built again from the new DataObjects
+void DataUtil::resetDerivedIndexes()
+{
+    mSearchIndex.clear();
+    mDayTimeIndex.clear();
+    mSpeakerSectionsBuilt = false;
+    mSearchIndexBuilt = false;
 }
 
 // creates missing dirs if preparing conference (pre-conf-stuff)
@@ -320,8 +379,13 @@ void DataUtil::prepareConference() {
         qWarning() << "cannot create directories";
         return;
     }
+    // all Sessions will be deleted
+    mSessionLists->clearScheduledSessions();
+    mMyScheduleConference = -1;
     // create some data for this specific conference
     prepareEventData();
+    // all DataObjects were deleted and created again
+    resetDerivedIndexes();
 
     qDebug() << "cache DATA";
     mDataManager->saveConferenceToCache();
@@ -356,6 +420,9 @@ void DataUtil::prepareEventData() {
         bool ok = cacheSpeakerFile.remove();
         qDebug() << "old speakers removed from cache? " << ok;
     }
+    // binary snapshots are outdated now, too
+    QFile::remove(mCacheDataPath + "cacheSpeakerImage.snapshot");
+    QFile::remove(mCacheDataPath + "cacheSpeaker.snapshot");
     // as next we copy speaker and speaker images from assets
     mDataManager->initSpeakerImageFromCache();
     mDataManager->initSpeakerFromCache();
@@ -599,29 +666,6 @@ void DataUtil::prepareBerlin201802() {
     conference->resolveRoomsKeys(rList);
 }
 
-QVariantMap DataUtil::readScheduleFile(const QString schedulePath) {
-    QVariantMap map;
-    QFile readFile(schedulePath);
-    if(!readFile.exists()) {
-        qWarning() << "Schedule Path not found " << schedulePath;
-        return map;
-    }
-    if (!readFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Couldn't open file: " << schedulePath;
-        return map;
-    }
-    QJsonDocument jda = QJsonDocument::fromJson(readFile.readAll());
-
-    readFile.close();
-    if(!jda.isObject()) {
-        qWarning() << "Couldn't create JSON from file: " << schedulePath;
-        return map;
-    }
-    qDebug() << "QJsonDocument for schedule with Object :)";
-    map = jda.toVariant().toMap();
-    return map;
-}
-
 Day* DataUtil::findDayForServerDate(const QString& dayDate, Conference* conference) {
     Day* day = nullptr;
     bool found = false;
@@ -640,17 +684,12 @@ Day* DataUtil::findDayForServerDate(const QString& dayDate, Conference* conferen
     return nullptr;
 }
 
-void DataUtil::adjustTracks(QVariantMap& sessionMap, Conference* conference, const bool isUpdate) {
+// tracks from server: name and color
+QStringList DataUtil::adjustTracks(const QList<ImportedTrack>& trackList, Conference* conference, const bool isUpdate) {
     QStringList trackKeys;
-    QVariantList trackList;
-    trackList = sessionMap.value("tracks").toList();
     for (int tnl = 0; tnl < trackList.size(); ++tnl) {
-        QVariantMap trackMap;
-        trackMap = trackList.at(tnl).toMap();
-        QString trackName;
-        trackName = trackMap.value("name").toString();
-        QString trackColor;
-        trackColor = trackMap.value("color").toString();
+        const QString& trackName = trackList.at(tnl).name;
+        const QString& trackColor = trackList.at(tnl).color;
         bool found = false;
         for (int i = 0; i < conference->tracks().size(); ++i) {
             SessionTrack* sessionTrack = conference->tracks().at(i);
@@ -670,64 +709,18 @@ void DataUtil::adjustTracks(QVariantMap& sessionMap, Conference* conference, con
             sessionTrack->setInAssets(!isUpdate);
             mDataManager->insertSessionTrack(sessionTrack);
             conference->addToTracks(sessionTrack);
+            if(isUpdate) {
+                mChangeSet.tracks.added.insert(sessionTrack->trackId());
+            }
             trackKeys.append(QString::number(sessionTrack->trackId()));
         }
     }
-    sessionMap.insert("tracks", trackKeys);
     qDebug() << "TRACK KEYS: " << trackKeys;
+    return trackKeys;
 }
 
-void DataUtil::adjustPersons(QVariantMap& sessionMap) {
-    QStringList personKeys;
-    QVariantList personsList;
-    personsList = sessionMap.value("persons").toList();
-    if (!personsList.empty()) {
-        for (int pvl = 0; pvl < personsList.size(); ++pvl) {
-            QVariantMap map = personsList.at(pvl).toMap();
-            if(map.contains("id")) {
-                personKeys.append(map.value("id").toString());
-            }
-        }
-        sessionMap.insert("persons", personKeys);
-    }
-}
-
-bool DataUtil::checkIfIgnored(SessionAPI* sessionAPI) {
-    Q_UNUSED(sessionAPI);
-    return false;
-    //    if(sessionAPI->title() == "Registration and Coffee" && sessionAPI->room() != "B02") {
-    //        qDebug() << "unwanted session: " << sessionAPI->sessionId() << " " << sessionAPI->title() << " " << sessionAPI->room();
-    //        return true;
-    //    }
-    //    if(sessionAPI->title() == "Lunch" && sessionAPI->room() != "B02") {
-    //        qDebug() << "unwanted session: " << sessionAPI->sessionId() << " " << sessionAPI->title() << " " << sessionAPI->room();
-    //        return true;
-    //    }
-    //    if(sessionAPI->title() == "Coffee break" && sessionAPI->room() != "B02") {
-    //        qDebug() << "unwanted session: " << sessionAPI->sessionId() << " " << sessionAPI->title() << " " << sessionAPI->room();
-    //        return true;
-    //    }
-    //    if(sessionAPI->title() == "Evening event" && sessionAPI->room() != "B02") {
-    //        qDebug() << "unwanted session: " << sessionAPI->sessionId() << " " << sessionAPI->title() << " " << sessionAPI->room();
-    //        return true;
-    //    }
-    //    if(sessionAPI->title() == "Welcome" && sessionAPI->room() != "C01") {
-    //        qDebug() << "unwanted session: " << sessionAPI->sessionId() << " " << sessionAPI->title() << " " << sessionAPI->room();
-    //        return true;
-    //    }
-    //    return false;
-}
-
-void DataUtil::setDuration(SessionAPI* sessionAPI, Session* session) {
-    QStringList duration;
-    duration = sessionAPI->duration().split(":");
-    int minutes = 0;
-    if(duration.length() == 2) {
-        minutes = duration.last().toInt();
-        minutes += duration.first().toInt()*60;
-    } else {
-        qWarning() << "Duration wrong: " << sessionAPI->duration() << " session ID: " << sessionAPI->sessionId();
-    }
+// minutes calculated from server duration by ScheduleImporter
+void DataUtil::setDuration(const int minutes, Session* session) {
     session->setMinutes(minutes);
     session->setEndTime(session->startTime().addSecs(minutes * 60));
 }
@@ -771,29 +764,73 @@ void DataUtil::setType(Session* session) {
     // for QtCon here we create ScheduleItems which are not part of QtWS data
 }
 
-// sessions must be cleared before for Day Track, Room, Speaker
-// always if prepare Conference, explicitely if Update Schedule
+// sessions are only rebuilt for containers touched by the change set
+// sorted order comes from mMultiSession
 void DataUtil::sortedSessionsIntoRoomDayTrackSpeaker() {
+    // clear sessions of touched containers
+    QSetIterator<int> touchedRoomsIterator(mChangeSet.touchedRooms);
+    while (touchedRoomsIterator.hasNext()) {
+        const int roomId = touchedRoomsIterator.next();
+        Room* room = mDataManager->findRoomByRoomId(roomId);
+        if(room != nullptr) {
+            room->clearSessions();
+            // nothing left to resolve
+            room->resolveSessionsKeys(QList<Session*>());
+        }
+    }
+    QSetIterator<int> touchedDaysIterator(mChangeSet.touchedDays);
+    while (touchedDaysIterator.hasNext()) {
+        const int dayId = touchedDaysIterator.next();
+        Day* day = mDataManager->findDayById(dayId);
+        if(day != nullptr) {
+            day->clearSessions();
+            day->resolveSessionsKeys(QList<Session*>());
+        }
+    }
+    QSetIterator<int> touchedTracksIterator(mChangeSet.touchedTracks);
+    while (touchedTracksIterator.hasNext()) {
+        const int trackId = touchedTracksIterator.next();
+        SessionTrack* sessionTrack = mDataManager->findSessionTrackByTrackId(trackId);
+        if(sessionTrack != nullptr) {
+            sessionTrack->clearSessions();
+            sessionTrack->resolveSessionsKeys(QList<Session*>());
+        }
+    }
+    QSetIterator<int> touchedSpeakersIterator(mChangeSet.touchedSpeakers);
+    while (touchedSpeakersIterator.hasNext()) {
+        const int speakerId = touchedSpeakersIterator.next();
+        Speaker* speaker = mDataManager->findSpeakerBySpeakerId(speakerId);
+        if(speaker != nullptr) {
+            speaker->clearSessions();
+            speaker->resolveSessionsKeys(QList<Session*>());
+        }
+    }
     QMapIterator<QString, Session*> sessionIterator(mMultiSession);
     while (sessionIterator.hasNext()) {
         sessionIterator.next();
         Session* session = sessionIterator.value();
-        mDataManager->insertSession(session);
-        Room* room = mDataManager->findRoomByRoomId(session->room());
-        if(room != nullptr) {
-            room->addToSessions(session);
-        } else {
-            qWarning() << "ROOM is NULL for Session " << session->sessionId() << " #:" << session->room();
+        if(mChangeSet.touchedRooms.contains(session->room())) {
+            Room* room = mDataManager->findRoomByRoomId(session->room());
+            if(room != nullptr) {
+                room->addToSessions(session);
+            } else {
+                qWarning() << "ROOM is NULL for Session " << session->sessionId() << " #:" << session->room();
+            }
         }
-        Day* day = mDataManager->findDayById(session->sessionDay());
-        if(day != nullptr) {
-            day->addToSessions(session);
-        } else {
-            qWarning() << "DAY is NULL for Session " << session->sessionId() << " #:" << session->sessionDay();
+        if(mChangeSet.touchedDays.contains(session->sessionDay())) {
+            Day* day = mDataManager->findDayById(session->sessionDay());
+            if(day != nullptr) {
+                day->addToSessions(session);
+            } else {
+                qWarning() << "DAY is NULL for Session " << session->sessionId() << " #:" << session->sessionDay();
+            }
         }
         for (int i = 0; i < session->sessionTracksKeys().size(); ++i) {
             int tKey = session->sessionTracksKeys().at(i).toInt();
-            SessionTrack* sessionTrack = static_cast<SessionTrack*> (mDataManager->findSessionTrackByTrackId(tKey));
+            if(!mChangeSet.touchedTracks.contains(tKey)) {
+                continue;
+            }
+            SessionTrack* sessionTrack = mDataManager->findSessionTrackByTrackId(tKey);
             if(sessionTrack != nullptr) {
                 sessionTrack->addToSessions(session);
             } else {
@@ -802,7 +839,10 @@ void DataUtil::sortedSessionsIntoRoomDayTrackSpeaker() {
         }
         for (int i = 0; i < session->presenterKeys().size(); ++i) {
             int pKey = session->presenterKeys().at(i).toInt();
-            Speaker* speaker = static_cast<Speaker*> (mDataManager->findSpeakerBySpeakerId(pKey));
+            if(!mChangeSet.touchedSpeakers.contains(pKey)) {
+                continue;
+            }
+            Speaker* speaker = mDataManager->findSpeakerBySpeakerId(pKey);
             if(speaker != nullptr) {
                 speaker->addToSessions(session);
             } else {
@@ -810,29 +850,104 @@ void DataUtil::sortedSessionsIntoRoomDayTrackSpeaker() {
             }
         } // for presenter
     } // while all sessions
+    touchedDaysIterator.toFront();
+    while (touchedDaysIterator.hasNext()) {
+        Day* day = mDataManager->findDayById(touchedDaysIterator.next());
+        if(day != nullptr) {
+            buildDayTimeIndex(day);
+        }
+    }
 }
 
-QVariantList DataUtil::readSpeakerFile(const QString speakerPath) {
-    QVariantList dataList;
-    QFile readFile(speakerPath);
-    if(!readFile.exists()) {
-        qWarning() << "Speaker Path not found " << speakerPath;
-        return dataList;
+// CHANGE SET
+
+// compares the persisted values before and after filling from server
+// SessionState doesn't contain the transient isFavorite
+// no previous state: session is new
+void DataUtil::recordSessionChanges(Session* session, const SessionState* previousState) {
+    mChangeSet.receivedSessions.insert(session->sessionId());
+    const SessionState currentState = SessionState::of(session);
+    if(previousState == nullptr) {
+        mChangeSet.sessions.added.insert(session->sessionId());
+        touchContainersOfSession(currentState);
+        return;
     }
-    if (!readFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Couldn't open file: " << speakerPath;
-        return dataList;
+    if(currentState != *previousState) {
+        mChangeSet.sessions.changed.insert(session->sessionId());
+        // old and new containers: day, room, tracks or presenter can be moved
+        touchContainersOfSession(*previousState);
+        touchContainersOfSession(currentState);
     }
-    QJsonDocument jda = QJsonDocument::fromJson(readFile.readAll());
+}
 
-    readFile.close();
-    if(!jda.isArray()) {
-        qWarning() << "Couldn't create JSON from file: " << speakerPath;
-        return dataList;
+void DataUtil::touchContainersOfSession(const SessionState& sessionState) {
+    if(sessionState.sessionDay != -1) {
+        mChangeSet.touchedDays.insert(sessionState.sessionDay);
+    }
+    if(sessionState.room != -1) {
+        mChangeSet.touchedRooms.insert(sessionState.room);
+    }
+    for (int i = 0; i < sessionState.sessionTracksKeys.size(); ++i) {
+        mChangeSet.touchedTracks.insert(sessionState.sessionTracksKeys.at(i).toInt());
+    }
+    for (int i = 0; i < sessionState.presenterKeys.size(); ++i) {
+        mChangeSet.touchedSpeakers.insert(sessionState.presenterKeys.at(i).toInt());
+    }
+}
+
+// generic sessions are created new at each update with the same ids
+// if there's already one with same id, the existing Session* is kept
+void DataUtil::addGenericSession(Session* session) {
+    Session* existingSession = mDataManager->findSessionBySessionId(session->sessionId());
+    if(existingSession == nullptr || existingSession == session) {
+        mMultiSession.insert(session->sortKey(), session);
+        recordSessionChanges(session, nullptr);
+        return;
+    }
+    const SessionState previousState = SessionState::of(existingSession);
+    const SessionState genericState = SessionState::of(session);
+    mDataManager->undoCreateSession(session);
+    if(genericState != previousState) {
+        // isFavorite not in state: stays as it is
+        genericState.applyTo(existingSession);
+    }
+    mMultiSession.insert(existingSession->sortKey(), existingSession);
+    recordSessionChanges(existingSession, &previousState);
+}
+
+// Rooms and Tracks created by an update are removed if no more sessions
+void DataUtil::removeOrphanedRoomsAndTracks() {
+    QSetIterator<int> touchedRoomsIterator(mChangeSet.touchedRooms);
+    while (touchedRoomsIterator.hasNext()) {
+        const int roomId = touchedRoomsIterator.next();
+        Room* room = mDataManager->findRoomByRoomId(roomId);
+        // 0 is the dummi room
+        if(room == nullptr || room->roomId() == 0 || room->inAssets() || room->sessionsCount() > 0) {
+            continue;
+        }
+        for (int i = 0; i < mDataManager->allConference().size(); ++i) {
+            Conference* conference = static_cast<Conference*>( mDataManager->allConference().at(i));
+            conference->removeFromRooms(room);
+        }
+        mChangeSet.rooms.removed.insert(roomId);
+        mDataManager->deleteRoom(room);
+        qDebug() << "Room removed: " << roomId;
+    }
+    QSetIterator<int> touchedTracksIterator(mChangeSet.touchedTracks);
+    while (touchedTracksIterator.hasNext()) {
+        const int trackId = touchedTracksIterator.next();
+        SessionTrack* sessionTrack = mDataManager->findSessionTrackByTrackId(trackId);
+        if(sessionTrack == nullptr || sessionTrack->inAssets() || sessionTrack->sessionsCount() > 0) {
+            continue;
+        }
+        for (int i = 0; i < mDataManager->allConference().size(); ++i) {
+            Conference* conference = static_cast<Conference*>( mDataManager->allConference().at(i));
+            conference->removeFromTracks(sessionTrack);
+        }
+        mChangeSet.tracks.removed.insert(trackId);
+        mDataManager->deleteSessionTrack(sessionTrack);
+        qDebug() << "Track removed: " << trackId;
     }
-    qDebug() << "QJsonDocument for speaker with Array :)";
-    dataList = jda.toVariant().toList();
-    return dataList;
 }
 
 QVariantList DataUtil::readRoomMappingFile(const QString path) {
@@ -858,17 +973,17 @@ QVariantList DataUtil::readRoomMappingFile(const QString path) {
     return dataList;
 }
 
-void DataUtil::calcSpeakerName(Speaker* speaker, SpeakerAPI* speakerAPI) {
-    speaker->setName(speakerAPI->firstName());
+void DataUtil::calcSpeakerName(Speaker* speaker, const ImportedSpeaker& importedSpeaker) {
+    speaker->setName(importedSpeaker.firstName);
     if(speaker->name().length() > 0) {
         speaker->setName(speaker->name()+" ");
     }
-    speaker->setName(speaker->name()+speakerAPI->lastName());
+    speaker->setName(speaker->name()+importedSpeaker.lastName);
     if(speaker->name().length() > 0) {
-        if(speakerAPI->lastName().length() > 0) {
-            speaker->setSortKey(speakerAPI->lastName().left(5).toUpper());
+        if(importedSpeaker.lastName.length() > 0) {
+            speaker->setSortKey(importedSpeaker.lastName.left(5).toUpper());
         } else {
-            speaker->setSortKey(speakerAPI->firstName().left(5).toUpper());
+            speaker->setSortKey(importedSpeaker.firstName.left(5).toUpper());
         }
         speaker->setSortGroup(speaker->sortKey().left(1));
     } else {
@@ -892,99 +1007,163 @@ void DataUtil::startUpdate()
     }
     mProgressInfotext = tr("Request Schedule and Speakers from Server");
     emit progressInfo(mProgressInfotext);
-    mDataServer->requestSchedule(201801);
+    // update compares with sessions of all conferences
+    loadAllConferences();
+    mScheduleSources = scheduleSources();
+    mDataServer->requestUpdate(mScheduleSources);
+}
+
+void DataUtil::updateFromConferenceData()
+{
+    bool dirOk = checkDirs();
+    if(!dirOk) {
+        qWarning() << "Cannot create Directories";
+        emit updateFailed(tr("startUpdate - Cannot create Directories"));
+        return;
+    }
+    loadAllConferences();
+    mScheduleSources = scheduleSources();
+    if(!isConferencePrepared()) {
+        prepareConference();
+    }
+    continueUpdate();
+}
+
+bool DataUtil::isConferencePrepared() {
+    return !isOldConference() && !mDataManager->allConference().empty() && mDataManager->settingsData()->version() >= 2018005;
+}
+
+// schedules to be requested and imported: one for each conference
+QList<ScheduleSource> DataUtil::scheduleSources() {
+    QList<ScheduleSource> sources;
+    if(!isConferencePrepared()) {
+        // conferences will be created by prepareConference() after receiving the data
+        ScheduleSource source;
+        source.conferenceId = 201801;
+        source.city = "BOSTON";
+        source.location = "Boston";
+        source.dayDates << "2018-10-29" << "2018-10-30";
+        sources.append(source);
+        source.conferenceId = 201802;
+        source.city = "BERLIN";
+        source.location = "Berlin";
+        source.dayDates.clear();
+        source.dayDates << "2018-12-05" << "2018-12-06";
+        sources.append(source);
+        return sources;
+    }
+    for (int i = 0; i < mDataManager->mAllConference.size(); ++i) {
+        Conference* conference = static_cast<Conference*>( mDataManager->mAllConference.at(i));
+        ScheduleSource source;
+        source.conferenceId = conference->id();
+        // per ex. 'Boston, MA'
+        source.location = conference->conferenceCity().split(",").first().trimmed();
+        source.city = source.location.toUpper();
+        for (int d = 0; d < conference->days().size(); ++d) {
+            Day* day = conference->days().at(d);
+            source.dayDates.append(day->conferenceDay().toString(YYYY_MM_DD));
+        }
+        sources.append(source);
+    }
+    return sources;
 }
 
 void DataUtil::continueUpdate()
 {
+    // parsing or applying the data of a previous request not finished yet
+    if(mImportWatcher->isRunning() || mUpdateCommitting) {
+        qWarning() << "Update already running";
+        return;
+    }
     mProgressInfotext = tr("Save Favorites");
     emit progressInfo(mProgressInfotext);
     // save F A V O R I T E S
     saveSessionFavorites();
-    // S P E A K E R
-    mProgressInfotext = tr("Sync Speaker");
+    // P A R S E  speaker.json, schedule_<id>.json on a worker thread
+    mImportWatcher->setFuture(QtConcurrent::run(mScheduleImporter, &ScheduleImporter::importAll, mConferenceDataPath, mScheduleSources));
+}
+
+void DataUtil::onImportProgress(const QString progressText)
+{
+    mProgressInfotext.append("\n").append(progressText);
     emit progressInfo(mProgressInfotext);
-    const QString speakersPath = mConferenceDataPath + "speaker.json";
-    qDebug() << "PREPARE SPEAKER ";
-    QVariantList dataList;
-    dataList = readSpeakerFile(speakersPath);
-    if(dataList.empty()) {
-        qWarning() << "Speaker List empty";
-        emit updateFailed(tr("Update failed. No Speaker received.\nReloading current Data"));
+}
+
+// back on GUI thread: apply the parsed data to the conference
+void DataUtil::onImportFinished()
+{
+    mImport = mImportWatcher->result();
+    if(!mImport.isValid()) {
+        emit updateFailed(mImport.errorMessage);
+        mImport = ScheduleImport();
         return;
     }
-    qDebug() << "we got speakers from server API #" << dataList.size();
-    
+    // nothing applied yet: no rollback needed
+    if(!checkImportedSchedules()) {
+        mImport = ScheduleImport();
+        return;
+    }
+    // until completeUpdate(): applied in steps, each one in its own event loop slice
+    mUpdateCommitting = true;
+    applySpeaker();
+}
+
+// all schedules are checked before anything is applied,
+// so a failing conference can't leave the others half updated
+bool DataUtil::checkImportedSchedules()
+{
+    for (int i = 0; i < mScheduleSources.size(); ++i) {
+        const ScheduleSource& source = mScheduleSources.at(i);
+        Conference* conference = mDataManager->findConferenceById(source.conferenceId);
+        if(!conference) {
+            qWarning() << "No 'conference' found in prepared data for " << source.city;
+            emit updateFailed(tr("Error: Data missed 'conference'.")+" "+source.city);
+            return false;
+        }
+        // parsed by ScheduleImporter
+        const ImportedSchedule* schedule = mImport.scheduleForConference(source.conferenceId);
+        if(!schedule) {
+            qWarning() << "No Schedule imported for " << source.city;
+            emit updateFailed(tr("Error: Received Map is empty.")+" "+source.city);
+            return false;
+        }
+        if(schedule->days.size() > conference->days().size()) {
+            qWarning() << "too many 'days' found " << source.city;
+            emit updateFailed(tr("Error: # of 'days' expected: ")+QString::number(conference->days().size())+" got: "+QString::number(schedule->days.size()));
+            return false;
+        }
+    }
+    return true;
+}
+
+void DataUtil::applySpeaker()
+{
+    // S P E A K E R
+    mProgressInfotext.append("\n").append(tr("Sync Speaker"));
+    emit progressInfo(mProgressInfotext);
+    qDebug() << "PREPARE SPEAKER ";
     mMultiSession.clear();
     mMultiSpeaker.clear();
     mMultiSpeakerImages.clear();
-    for (int i = 0; i < dataList.size(); ++i) {
-        SpeakerAPI* speakerAPI = mDataManager->createSpeakerAPI();
-        speakerAPI->fillFromForeignMap(dataList.at(i).toMap());
-
-        Speaker* speaker = mDataManager->findSpeakerBySpeakerId(speakerAPI->id());
-        if(!speaker) {
-            // NEW speaker
-            qDebug() << "NEW SPEAKER";
-            mProgressInfotext.append("+");
-            speaker = mDataManager->createSpeaker();
-            speaker->setSpeakerId(speakerAPI->id());
-        } else {
-            // update Speaker
-            qDebug() << "UPDATE SPEAKER";
-            mProgressInfotext.append(".");
-        }
-        emit progressInfo(mProgressInfotext);
-        calcSpeakerName(speaker, speakerAPI);
-        speaker->setBio(speakerAPI->bio());
-        speaker->setTitle(speakerAPI->title());
-        if(speakerAPI->avatar().length() > 0 && speakerAPI->avatar() != DEFAULT_SPEAKER_IMAGE_URL && speakerAPI->avatar() != "false") {
-            qDebug() << "Speaker has Avatar";
-            QString avatar = speakerAPI->avatar();
-            QStringList sl = avatar.split("?");
-            if(sl.size() > 1) {
-                sl.removeLast();
-                avatar = sl.join("?");
-            }
-            sl = avatar.split(".");
-            if(sl.size() < 2) {
-                qWarning() << "AVATAR wrong "+speakerAPI->avatar();
-            } else {
-                // check if modified
-                if(speaker->hasSpeakerImage()) {
-                    if(speaker->speakerImageAsDataObject()->originImageUrl() != avatar) {
-                        qDebug() << "IMAGE Changed";
-                        SpeakerImage* speakerImage = speaker->speakerImageAsDataObject();
-                        speakerImage->setOriginImageUrl(avatar);
-                        speakerImage->setSuffix(sl.last());
-                        mMultiSpeakerImages.insert(false, speakerImage);
-                    }
-                } else {
-                    SpeakerImage* speakerImage = nullptr;
-                    qDebug() << "IMAGE already in ASSETS ?";
-                    speakerImage = mDataManager->findSpeakerImageBySpeakerId(speaker->speakerId());
-                    if(!speakerImage) {
-                        qDebug() << "IMAGE NEW";
-                        speakerImage = mDataManager->createSpeakerImage();
-                        speakerImage->setSpeakerId(speaker->speakerId());
-                        speakerImage->setOriginImageUrl(avatar);
-                        speakerImage->setSuffix(sl.last());
-                        speakerImage->setInAssets(false);
-                        speaker->resolveSpeakerImageAsDataObject(speakerImage);
-                        mMultiSpeakerImages.insert(false, speakerImage);
-                    } else {
-                        qDebug() << "IMAGE found from ASSETS";
-                        speaker->resolveSpeakerImageAsDataObject(speakerImage);
-                    }
-                }
-            } // end if valid Avatar URL
-        } // end check avatar if URL && not default
-        else {
-            qDebug() << "Speaker has NO Avatar";
-        }
-        // using MultiMap to get Speakers sorted
-        mMultiSpeaker.insert(speaker->sortKey(), speaker);
-    } // for speaker from server
+    mChangeSet.clear();
+    mRemovedSessions.clear();
+    mRemovedSpeakers.clear();
+    mUpdateSpeakerIndex = 0;
+    applyNextSpeakers();
+}
+
+// a bounded number of Speaker per event loop slice
+void DataUtil::applyNextSpeakers()
+{
+    const int sliceEnd = qMin(mUpdateSpeakerIndex + UPDATE_SPEAKER_SLICE, mImport.speakers.size());
+    for (; mUpdateSpeakerIndex < sliceEnd; ++mUpdateSpeakerIndex) {
+        applyImportedSpeaker(mImport.speakers.at(mUpdateSpeakerIndex));
+    }
+    if(mUpdateSpeakerIndex < mImport.speakers.size()) {
+        QMetaObject::invokeMethod(this, "applyNextSpeakers", Qt::QueuedConnection);
+        return;
+    }
+    mChangeSet.speakerImagesChanged = !mMultiSpeakerImages.isEmpty();
     //
     qDebug() << "SPEAKERS: " << mDataManager->mAllSpeaker.size() << " --> " << mMultiSpeaker.size() << " IMG: " << mMultiSpeakerImages.size();
     mProgressInfotext.append("\n").append(tr("Sync Speaker Images"));
@@ -993,271 +1172,235 @@ void DataUtil::continueUpdate()
     updateSpeakerImages();
 }
 
+void DataUtil::applyImportedSpeaker(const ImportedSpeaker& importedSpeaker)
+{
+    Speaker* speaker = mDataManager->findSpeakerBySpeakerId(importedSpeaker.id);
+    bool isNewSpeaker = false;
+    SpeakerState previousState;
+    if(!speaker) {
+        // NEW speaker
+        qDebug() << "NEW SPEAKER";
+        mProgressInfotext.append("+");
+        speaker = mDataManager->createSpeaker();
+        speaker->setSpeakerId(importedSpeaker.id);
+        isNewSpeaker = true;
+        mChangeSet.speakers.added.insert(speaker->speakerId());
+        mChangeSet.touchedSpeakers.insert(speaker->speakerId());
+    } else {
+        // update Speaker
+        qDebug() << "UPDATE SPEAKER";
+        mProgressInfotext.append(".");
+        previousState = SpeakerState::of(speaker);
+    }
+    emit progressInfo(mProgressInfotext);
+    calcSpeakerName(speaker, importedSpeaker);
+    speaker->setBio(importedSpeaker.bio);
+    speaker->setTitle(importedSpeaker.title);
+    if(!importedSpeaker.avatar.isEmpty()) {
+        qDebug() << "Speaker has Avatar";
+        const QString& avatar = importedSpeaker.avatar;
+        // check if modified
+        if(speaker->hasSpeakerImage()) {
+            if(speaker->speakerImageAsDataObject()->originImageUrl() != avatar) {
+                qDebug() << "IMAGE Changed";
+                SpeakerImage* speakerImage = speaker->speakerImageAsDataObject();
+                speakerImage->setOriginImageUrl(avatar);
+                speakerImage->setSuffix(importedSpeaker.avatarSuffix);
+                mMultiSpeakerImages.insert(false, speakerImage);
+            }
+        } else {
+            SpeakerImage* speakerImage = nullptr;
+            qDebug() << "IMAGE already in ASSETS ?";
+            speakerImage = mDataManager->findSpeakerImageBySpeakerId(speaker->speakerId());
+            if(!speakerImage) {
+                qDebug() << "IMAGE NEW";
+                speakerImage = mDataManager->createSpeakerImage();
+                speakerImage->setSpeakerId(speaker->speakerId());
+                speakerImage->setOriginImageUrl(avatar);
+                speakerImage->setSuffix(importedSpeaker.avatarSuffix);
+                speakerImage->setInAssets(false);
+                speaker->resolveSpeakerImageAsDataObject(speakerImage);
+                mMultiSpeakerImages.insert(false, speakerImage);
+            } else {
+                qDebug() << "IMAGE found from ASSETS";
+                speaker->resolveSpeakerImageAsDataObject(speakerImage);
+            }
+        }
+    } else {
+        qDebug() << "Speaker has NO Avatar";
+    }
+    if(!isNewSpeaker && SpeakerState::of(speaker) != previousState) {
+        mChangeSet.speakers.changed.insert(speaker->speakerId());
+    }
+    mChangeSet.receivedSpeakers.insert(speaker->speakerId());
+    // using MultiMap to get Speakers sorted
+    mMultiSpeaker.insert(speaker->sortKey(), speaker);
+}
+
 void DataUtil::updateSpeakerImages() {
     if(!mMultiSpeakerImages.empty()) {
         QList<SpeakerImage*> waitingForDownload = mMultiSpeakerImages.values(false);
         if(!waitingForDownload.empty()) {
-            mProgressInfotext.append(".");
-            emit progressInfo(mProgressInfotext);
-            // DO IT
-            const QString speakerImagesPath = mConferenceDataPath + "speakerImages/";
-            SpeakerImage* speakerImage = waitingForDownload.first();
-            QString fileName;
-            fileName = "speaker_";
-            fileName.append(QString::number(speakerImage->speakerId()));
-            fileName.append('.');
-            fileName.append(speakerImage->suffix());
-            mImageLoader = new ImageLoader(speakerImage->originImageUrl(), speakerImagesPath+fileName, this);
-            bool res = connect(mImageLoader, SIGNAL(loaded(QObject*, int, int)), this,
-                               SLOT(onSpeakerImageUpdateLoaded(QObject*, int, int)));
-            if (!res) {
-                Q_ASSERT(res);
+            if(!mImageDownloadScheduler->isIdle()) {
+                // downloads in flight: each one reports back as loaded or failed
+                return;
             }
-            res = connect(mImageLoader, SIGNAL(loadingFailed(QObject*, QString)), this,
-                          SLOT(onSpeakerImageUpdateFailed(QObject*, QString)));
-            if (!res) {
-                Q_ASSERT(res);
+            // DO IT
+            // images are only decoded by the loader - stored by prepareHighDpiImages()
+            for (int i = 0; i < waitingForDownload.size(); ++i) {
+                SpeakerImage* speakerImage = waitingForDownload.at(i);
+                mImageDownloadScheduler->enqueue(speakerImage, speakerImage->originImageUrl(), QString());
             }
-            mImageLoader->loadSpeaker(speakerImage);
             return;
         } // waiting for download
     } // new images map
+    if(mHighDpiImagesPending > 0) {
+        // wait until all images are scaled and stored
+        return;
+    }
     // all speaker images done
     qDebug() << "ALL SPEAKER IMAGES DONE";
 
-    bool sessionOK = updateSessions(201801);
-    if(!sessionOK) {
+    mUpdateConferenceIndex = 0;
+    mUpdateDayIndex = 0;
+    QMetaObject::invokeMethod(this, "updateNextDay", Qt::QueuedConnection);
+}
+
+// sessions of one day per event loop slice
+void DataUtil::updateNextDay() {
+    if(mUpdateConferenceIndex >= mScheduleSources.size()) {
+        mProgressInfotext.append("\n").append(tr("Schedule and Speaker successfully synchronized :)"));
+        emit progressInfo(mProgressInfotext);
+        QMetaObject::invokeMethod(this, "finishUpdate", Qt::QueuedConnection);
         return;
     }
-    sessionOK = updateSessions(201802);
-    if(!sessionOK) {
-        return;
+    const ScheduleSource& source = mScheduleSources.at(mUpdateConferenceIndex);
+    // checked by checkImportedSchedules()
+    Conference* conference = mDataManager->findConferenceById(source.conferenceId);
+    const ImportedSchedule* schedule = mImport.scheduleForConference(source.conferenceId);
+    if(mUpdateDayIndex == 0) {
+        updateSessions(conference, schedule, source.city);
     }
-    mProgressInfotext.append("\n").append(tr("Schedule and Speaker successfully synchronized :)"));
-    emit progressInfo(mProgressInfotext);
-
-    finishUpdate();
-}
-
-bool DataUtil::updateSessions(const int conferenceId) {
-    QString city;
-    if(conferenceId == 201801) {
-        city = "BOSTON";
+    if(mUpdateDayIndex < schedule->days.size()) {
+        updateSessionsOfDay(schedule->days.at(mUpdateDayIndex), conference, source.city);
+        mUpdateDayIndex++;
     } else {
-        city = "BERLIN";
+        qDebug() << "SESSIONS: " << mDataManager->mAllSession.size() << " --> " << mMultiSession.size();
+        qDebug() << "Conference " << conference->conferenceCity() << " with days #" << conference->days().size() << " rooms #" << conference->rooms().size();
+        mProgressInfotext.append("\n").append(tr("Schedule successfully synchronized :)")).append(" ").append(source.city);
+        emit progressInfo(mProgressInfotext);
+        mUpdateConferenceIndex++;
+        mUpdateDayIndex = 0;
     }
-    mProgressInfotext.append("\n").append(tr("Sync Sessions ")).append(city);
+    QMetaObject::invokeMethod(this, "updateNextDay", Qt::QueuedConnection);
+}
 
-    Conference* conference;
-    conference = static_cast<Conference*> (mDataManager->findConferenceById(conferenceId));
-    if(!conference) {
-        qWarning() << "No 'conference' found in prepared data for " << city;
-        emit updateFailed(tr("Error: Data missed 'conference'.")+" "+city);
-        return false;
-    }
+// start of a conference, days are applied by updateSessionsOfDay()
+void DataUtil::updateSessions(Conference* conference, const ImportedSchedule* schedule, const QString& city) {
+    mProgressInfotext.append("\n").append(tr("Sync Sessions ")).append(city);
 
-    // delete old generic sessions
-    int firstGenericSession = conference->id()*100*-1;
-    int lastGenericSession = conference->lastGenericSessionId();
-    if(lastGenericSession == firstGenericSession) {
-        qDebug() << "NO GENERIC SESSIONS to be deleted";
-    } else {
-        for (int i = lastGenericSession; i < firstGenericSession; ++i) {
-            bool ok = mDataManager->deleteSessionBySessionId(i);
-            if(!ok) {
-                qDebug() << "cannot delete GENERIC SESSION " << i;
-            } else {
-                qDebug() << "GENERIC SESSION deleted " << i;
-            }
-        } // loop old generic sessions
-        // reset counter
-        conference->setLastGenericSessionId(conference->id()*100*-1);
-    } // loop delete generic sessions
+    // generic sessions are created again with same ids (see finishUpdate)
+    // unchanged ones are kept, not received ones will be removed by the change set
+    // reset counter
+    conference->setLastGenericSessionId(conference->id()*100*-1);
 
     emit progressInfo(mProgressInfotext);
 
-    const QString schedulePath = mConferenceDataPath + "schedule_"+QString::number(conferenceId)+".json";
-    QVariantMap map;
-    map = readScheduleFile(schedulePath);
-    if(map.isEmpty()) {
-        qWarning() << "Schedule is no Map for " << city;
-        emit updateFailed(tr("Error: Received Map is empty.")+" "+city);
-        return false;
-    }
-    map = map.value("conference").toMap();
-    if(map.isEmpty()) {
-        qWarning() << "No 'conference' found in server response for " << city;
-        emit updateFailed(tr("Error: Received Map missed 'conference'.")+" "+city);
-        return false;
-    }
-    QVariantList serverDayList;
-    QVariantMap allDaysMap;
-    allDaysMap = map.value("days").toMap();
-    QString myDay;
-    if(conferenceId == 201801) {
-        myDay= "2018-10-29";
-        if(allDaysMap.contains(myDay)) {
-            serverDayList.append(allDaysMap.value(myDay).toMap());
-        } else {
-            qDebug() << "Day missed in conference-days from server API " << myDay;
-        }
-        myDay = "2018-10-30";
-        if(allDaysMap.contains(myDay)) {
-            serverDayList.append(allDaysMap.value(myDay).toMap());
-        } else {
-            qDebug() << "Day missed in conference-days from server API " << myDay;
-        }
-    } else {
-        myDay= "2018-12-05";
-        if(allDaysMap.contains(myDay)) {
-            serverDayList.append(allDaysMap.value(myDay).toMap());
-        } else {
-            qDebug() << "Day missed in conference-days from server API " << myDay;
-        }
-        myDay = "2018-12-06";
-        if(allDaysMap.contains(myDay)) {
-            serverDayList.append(allDaysMap.value(myDay).toMap());
-        } else {
-            qDebug() << "Day missed in conference-days from server API " << myDay;
-        }
+    if(schedule->days.size() < conference->days().size()) {
+        qWarning() << "some 'days' missing " << city << " found " << schedule->days.size() << " expected "<< conference->days().size();
     }
+}
 
-    if(serverDayList.isEmpty()) {
-        qWarning() << "No 'days' found for" << city;
-        emit updateFailed(tr("Error: Received Map missed 'days'.")+" "+city);
-        return false;
-    }
-    if(serverDayList.size() > conference->days().size()) {
-        qWarning() << "too many 'days' found " << city;
-        emit updateFailed(tr("Error: # of 'days' expected: ")+QString::number(conference->days().size())+" got: "+QString::number(serverDayList.size()));
-        return false;
-    }
-    if(serverDayList.size() < conference->days().size()) {
-        qWarning() << "some 'days' missing " << city << " found " << serverDayList.size() << " expected "<< conference->days().size();
+void DataUtil::updateSessionsOfDay(const ImportedDay& importedDay, Conference* conference, const QString& city) {
+    const int conferenceId = conference->id();
+    const QString& dayDate = importedDay.dayDate;
+    qDebug() << "processing DATE: " << dayDate;
+    Day* day = findDayForServerDate(dayDate, conference);
+    if(!day) {
+        qWarning() << "No Day* found for " << dayDate << " " << city;
+        // emit updateFailed(tr("No Day* found for ")+dayDate+" "+city);
+        return;
     }
-    for (int i = 0; i < serverDayList.size(); ++i) {
-        QVariantMap dayMap;
-        dayMap = serverDayList.at(i).toMap();
-        if(dayMap.isEmpty()) {
-            qWarning() << "No 'DAY' found #" << i << " " << city;
-            // emit updateFailed(tr("Map for Day missed from Server")+" "+city);
-            continue;
-        }
-        QString dayDate;
-        dayDate = dayMap.value("date").toString();
-        qDebug() << "processing DATE: " << dayDate;
-        Day* day = findDayForServerDate(dayDate, conference);
-        if(!day) {
-            qWarning() << "No Day* found for " << dayDate << " " << city;
-            // emit updateFailed(tr("No Day* found for ")+dayDate+" "+city);
-            continue;
-        }
-        bool found = false;
-        QVariantMap roomMap;
-        roomMap = dayMap.value("rooms").toMap();
-        // the keys are the room names
-        QStringList roomKeys = roomMap.keys();
-        if(roomKeys.isEmpty()) {
-            qWarning() << "No 'ROOMS' found for DAY # i" << " " << city;
-            // emit updateFailed(tr("No 'ROOMS' found for DAY ") + dayDate+" "+city);
-            continue;
-        }
-        // loop thru room names
-        qDebug() << "Searching Rooms from conference #" << conference->rooms().size() << " for server room names #" << roomKeys.size();
-        for (int r = 0; r < roomKeys.size(); ++r) {
-            QVariantList sessionList;
-            sessionList = roomMap.value(roomKeys.at(r)).toList();
-            if(sessionList.isEmpty()) {
-                qWarning() << "DAY: " << dayDate << " ROOM: " << roomKeys.at(r) << " ignored - No Sessions available " << city;
-                continue;
+    bool found = false;
+    // loop thru room names
+    qDebug() << "Searching Rooms from conference #" << conference->rooms().size() << " for server room names #" << importedDay.rooms.size();
+    for (int r = 0; r < importedDay.rooms.size(); ++r) {
+        const ImportedRoom& importedRoom = importedDay.rooms.at(r);
+        Room* room = nullptr;
+        found = false;
+        for (int rl = 0; rl < conference->rooms().size(); ++rl) {
+            room = conference->rooms().at(rl);
+            if(room->roomName() == importedRoom.roomName) {
+                found = true;
+                break;
             }
-            Room* room = nullptr;
-            found = false;
-            for (int rl = 0; rl < conference->rooms().size(); ++rl) {
-                room = conference->rooms().at(rl);
-                if(room->roomName() == roomKeys.at(r)) {
-                    found = true;
-                    break;
-                }
+        }
+        if(!found) {
+            qDebug() << "Room* not found for " << dayDate << " Room: " << importedRoom.roomName;
+            if(importedRoom.roomName.isEmpty()) {
+                // use dummi room
+                room = static_cast<Room*>( mDataManager->allRoom().first());
+                qDebug() << "Room Name empty - using Room " << room->roomName() << "for " << city;
+            } else {
+                room = mDataManager->createRoom();
+                conference->setLastRoomId(conference->lastRoomId()+1);
+                room->setRoomId(conference->lastRoomId());
+                room->setInAssets(false);
+                room->setRoomName(importedRoom.roomName);
+                // caches are partitioned by conference
+                room->setConference(conference->id());
+                mDataManager->insertRoom(room);
+                conference->addToRooms(room);
+                mChangeSet.rooms.added.insert(room->roomId());
+                mProgressInfotext.append("R");
+                progressInfo(mProgressInfotext);
             }
-            if(!found) {
-                qDebug() << "Room* not found for " << dayDate << " Room: " << roomKeys.at(r);
-                if(roomKeys.at(r).isEmpty()) {
-                    // use dummi room
-                    room = static_cast<Room*>( mDataManager->allRoom().first());
-                    qDebug() << "Room Name empty - using Room " << room->roomName() << "for " << city;
-                } else {
-                    room = mDataManager->createRoom();
-                    conference->setLastRoomId(conference->lastRoomId()+1);
-                    room->setRoomId(conference->lastRoomId());
-                    room->setInAssets(false);
-                    room->setRoomName(roomKeys.at(r));
-                    mDataManager->insertRoom(room);
-                    conference->addToRooms(room);
-                    mProgressInfotext.append("R");
-                    progressInfo(mProgressInfotext);
-                }
+        }
+        for (int sl = 0; sl < importedRoom.sessions.size(); ++sl) {
+            const ImportedSession& importedSession = importedRoom.sessions.at(sl);
+            // adjust tracks (true: isUpdate == not in assets
+            const QStringList trackKeys = adjustTracks(importedSession.tracks, conference, true);
+            // ekke TODO fix generator bug (without resolving we get tracks doubled)
+            QList<SessionTrack*> tList;
+            conference->resolveTracksKeys(tList);
+
+            Session* session = mDataManager->findSessionBySessionId(importedSession.sessionId);
+            SessionState previousState;
+            const bool isNewSession = (session == nullptr);
+            if(isNewSession) {
+                // NEW
+                qDebug() << "NEW Session " << QString::number(importedSession.sessionId);
+                mProgressInfotext.append("+");
+                session = mDataManager->createSession();
+                session->setSessionId(importedSession.sessionId);
+                session->setConference(conferenceId);
+            } else {
+                // Update
+                qDebug() << "Update Session " << QString::number(importedSession.sessionId);
+                mProgressInfotext.append(".");
+                previousState = SessionState::of(session);
             }
-            for (int sl = 0; sl < sessionList.size(); ++sl) {
-                QVariantMap sessionMap;
-                sessionMap = sessionList.at(sl).toMap();
-                if(sessionMap.isEmpty()) {
-                    qWarning() << "No 'SESSION' Map DAY: " << dayDate << " ROOM: " << roomKeys.at(r) << " for " << city;
-                    continue;
-                }
-                // adjust persons
-                adjustPersons(sessionMap);
-                // adjust tracks (true: isUpdate == not in assets
-                adjustTracks(sessionMap, conference, true);
-                // ekke TODO fix generator bug (without resolving we get tracks doubled)
-                QList<SessionTrack*> tList;
-                conference->resolveTracksKeys(tList);
-
-                SessionAPI* sessionAPI = mDataManager->createSessionAPI();
-                sessionAPI->fillFromForeignMap(sessionMap);
-                // ignore unwanted Sessions
-                if (checkIfIgnored(sessionAPI)) {
-                    continue;
-                }
-
-                Session* session = mDataManager->findSessionBySessionId(sessionAPI->sessionId());
-                if(!session) {
-                    // NEW
-                    qDebug() << "NEW Session " << QString::number(sessionAPI->sessionId());
-                    mProgressInfotext.append("+");
-                    session = mDataManager->createSession();
-                    session->setSessionId(sessionAPI->sessionId());
-                } else {
-                    // Update
-                    qDebug() << "Update Session " << QString::number(sessionAPI->sessionId());
-                    mProgressInfotext.append(".");
-                }
-                emit progressInfo(mProgressInfotext);
-                session->fillFromMap(sessionAPI->toMap());
-                setDuration(sessionAPI, session);
-                // refs
-                // DAY
-                session->setSessionDay(day->id());
-                session->resolveSessionDayAsDataObject(day);
-                // ROOM
-                session->setRoom(room->roomId());
-                session->resolveRoomAsDataObject(room);
-                // TYPE SCHEDULE
-                setType(session);
-                // SessionLinks
-
-                // SORT
-                session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-                mMultiSession.insert(session->sortKey(), session);
-            } // end for sessions of a room of a day
-        } // end for rooms of a day
-    } // end for list of days from server
-
-    qDebug() << "SESSIONS: " << mDataManager->mAllSession.size() << " --> " << mMultiSession.size();
-    qDebug() << "Conference " << conference->conferenceCity() << " with days #" << conference->days().size() << " rooms #" << conference->rooms().size();
-    mProgressInfotext.append("\n").append(tr("Schedule successfully synchronized :)")).append(" ").append(city);
-    emit progressInfo(mProgressInfotext);
-    return true;
+            emit progressInfo(mProgressInfotext);
+            ScheduleImporter::fillSession(session, importedSession);
+            session->setSessionTracksKeys(trackKeys);
+            setDuration(importedSession.minutes, session);
+            // refs
+            // DAY
+            session->setSessionDay(day->id());
+            session->resolveSessionDayAsDataObject(day);
+            // ROOM
+            session->setRoom(room->roomId());
+            session->resolveRoomAsDataObject(room);
+            // TYPE SCHEDULE
+            setType(session);
+            // SessionLinks
+
+            // SORT
+            session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
+            mMultiSession.insert(session->sortKey(), session);
+            recordSessionChanges(session, isNewSession ? nullptr : &previousState);
+        } // end for sessions of a room of a day
+    } // end for rooms of a day
 }
 
 void DataUtil::addGenericSessionsBoston201801() {
@@ -1265,8 +1408,8 @@ void DataUtil::addGenericSessionsBoston201801() {
     Conference* conference;
     conference = static_cast<Conference*> (mDataManager->findConferenceById(conferenceId));
     if(!conference) {
-        qWarning() << "No 'conference' found - cannot add Generic Sessions ";
-        emit updateFailed(tr("Error: Data missed 'conference'.")+QString::number(conferenceId));
+        // not part of this update: nothing to add
+        qWarning() << "No 'conference' found - cannot add Generic Sessions " << conferenceId;
         return;
     }
     int lastGenericSession = conference->lastGenericSessionId();
@@ -1288,8 +1431,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // LUNCH
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1303,8 +1445,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1318,8 +1459,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // NETWORKING
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1333,8 +1473,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
         } else {
             // CONF DAY
             // REGISTRATION
@@ -1350,8 +1489,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK COFFEE
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1365,8 +1503,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // LUNCH
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1380,8 +1517,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1395,8 +1531,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // NETWORKING
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1410,8 +1545,7 @@ void DataUtil::addGenericSessionsBoston201801() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
         }
     }
     conference->setLastGenericSessionId(lastGenericSession);
@@ -1422,8 +1556,8 @@ void DataUtil::addGenericSessionsBerlin201802() {
     Conference* conference;
     conference = static_cast<Conference*> (mDataManager->findConferenceById(conferenceId));
     if(!conference) {
-        qWarning() << "No 'conference' found - cannot add Generic Sessions ";
-        emit updateFailed(tr("Error: Data missed 'conference'.")+QString::number(conferenceId));
+        // not part of this update: nothing to add
+        qWarning() << "No 'conference' found - cannot add Generic Sessions " << conferenceId;
         return;
     }
     int lastGenericSession = conference->lastGenericSessionId();
@@ -1445,8 +1579,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // LUNCH
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1460,8 +1593,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1475,8 +1607,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // NETWORKING
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1490,8 +1621,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
         } else {
             // CONF DAY
             // REGISTRATION
@@ -1507,8 +1637,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK COFFEE
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1522,8 +1651,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // LUNCH
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1537,8 +1665,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // BREAK
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1552,8 +1679,7 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
             // NETWORKING
             session = mDataManager->createSession();
             lastGenericSession --;
@@ -1567,136 +1693,206 @@ void DataUtil::addGenericSessionsBerlin201802() {
             session->setConference(conferenceId);
             session->setSessionDay(day->id());
             session->setSortKey(day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString(HH_MM));
-            mMultiSession.insert(session->sortKey(), session);
-            mDataManager->insertSession(session);
+            addGenericSession(session);
         }
     }
     conference->setLastGenericSessionId(lastGenericSession);
 }
 
+// apply the change set to the conference data (caches are written by saveUpdatedCaches)
+// each rebuild in its own event loop slice: generic and removed Sessions, sorted Speaker,
+// sorted Sessions, Sessions of Days Rooms Tracks Speaker, orphans
 void DataUtil::finishUpdate() {
-    mProgressInfotext.append("\n").append(tr("Now saving Conference Data to Cache"));
-    emit progressInfo(mProgressInfotext);
+    // now add Generic Sessions
+    // compared with existing ones the same way as sessions from server
+    addGenericSessionsBoston201801();
+    addGenericSessionsBerlin201802();
+    qDebug() << "FINISH: ScheduleItems added";
 
-    // Room: clear sessions for update
-    for (int r = 0; r < mDataManager->allRoom().size(); ++r) {
-        Room* room = static_cast<Room*>( mDataManager->allRoom().at(r));
-        room->clearSessions();
-    }
-    // to reset all correct
-    resolveSessionsForRooms();
-    qDebug() << "FINISH: Rooms sessions cleared";
-    // SessionTrack: clear sessions for update
-    for (int st = 0; st < mDataManager->allSessionTrack().size(); ++st) {
-        SessionTrack* track = static_cast<SessionTrack*>( mDataManager->allSessionTrack().at(st));
-        track->clearSessions();
-        qDebug() << "clear sessions for Track " << track->name();
-    }
-    // to reset all correct
-    resolveSessionsForTracks();
-    qDebug() << "FINISH: Tracks sessions cleared";
-    // Day: clear sessions for update
-    for (int d = 0; d < mDataManager->allDay().size(); ++d) {
-        Day* day = static_cast<Day*>( mDataManager->allDay().at(d));
-        day->clearSessions();
-    }
-    // to reset all correct
-    resolveSessionsForSchedule();
-    qDebug() << "FINISH: Days sessions cleared";
-    // Speaker: insert sorted Speakers, clear Sessions
-    mDataManager->mAllSpeaker.clear();
-    QMapIterator<QString, Speaker*> speakerIterator(mMultiSpeaker);
-    while (speakerIterator.hasNext()) {
-        speakerIterator.next();
-        Speaker* speaker = speakerIterator.value();
-        speaker->clearSessions();
-        resolveSessionsForSpeaker(speaker);
-        mDataManager->insertSpeaker(speaker);
-    }
-    qDebug() << "FINISH: Sorted Speakers inserted";
-
-    // Check orphans
+    // R E M O V E D  Sessions: not received from server and not generic
     for (int i = 0; i < mDataManager->mAllSession.size(); ++i) {
         Session* session = static_cast<Session*>( mDataManager->mAllSession.at(i));
-        bool sessionFound = false;
+        if(!mChangeSet.receivedSessions.contains(session->sessionId())) {
+            mChangeSet.sessions.removed.insert(session->sessionId());
+            touchContainersOfSession(SessionState::of(session));
+            mRemovedSessions.append(session);
+            qDebug() << "Session removed: " << session->sessionId();
+        }
+    }
+    // R E M O V E D  Speaker: not received from server
+    for (int i = 0; i < mDataManager->mAllSpeaker.size(); ++i) {
+        Speaker* speaker = static_cast<Speaker*>( mDataManager->mAllSpeaker.at(i));
+        if(!mChangeSet.receivedSpeakers.contains(speaker->speakerId())) {
+            mChangeSet.speakers.removed.insert(speaker->speakerId());
+            mRemovedSpeakers.append(speaker);
+            qDebug() << "Speaker removed: " << speaker->speakerId();
+        }
+    }
+    qDebug() << "FINISH: Change Set Sessions" << mChangeSet.sessions.summary() << "Speaker" << mChangeSet.speakers.summary();
+
+    QMetaObject::invokeMethod(this, "insertUpdatedSpeakers", Qt::QueuedConnection);
+}
+
+void DataUtil::insertUpdatedSpeakers() {
+    // Speaker: insert sorted Speakers (name or sortKey can be changed)
+    if(!mChangeSet.speakers.isEmpty()) {
+        mDataManager->mAllSpeaker.clear();
+        mDataManager->mSpeakerBySpeakerId.clear();
+        QMapIterator<QString, Speaker*> speakerIterator(mMultiSpeaker);
+        while (speakerIterator.hasNext()) {
+            speakerIterator.next();
+            mDataManager->insertSpeaker(speakerIterator.value());
+        }
+        qDebug() << "FINISH: Sorted Speakers inserted";
+        buildSpeakerSections();
+        emit speakerSectionsChanged();
+    }
+
+    QMetaObject::invokeMethod(this, "insertUpdatedSessions", Qt::QueuedConnection);
+}
+
+void DataUtil::insertUpdatedSessions() {
+    // Session: insert sorted Sessions
+    if(!mChangeSet.sessions.isEmpty()) {
+        mDataManager->mAllSession.clear();
+        mDataManager->mSessionBySessionId.clear();
         QMapIterator<QString, Session*> sessionIterator(mMultiSession);
         while (sessionIterator.hasNext()) {
             sessionIterator.next();
-            Session* updatedSession = sessionIterator.value();
-            if(updatedSession->sessionId() == session->sessionId()) {
-                sessionFound = true;
-                break;
-            }
-        }
-        if(!sessionFound) {
-            session->deleteLater();
-            qDebug() << "Session removed: " << session->sessionId();
+            mDataManager->insertSession(sessionIterator.value());
         }
+        qDebug() << "FINISH: Sorted Sessions inserted";
     }
-    qDebug() << "FINISH: Session orphans deleted";
 
-    // Session: insert sorted Sessions
-    // presenter, sessionLinks, day, room, track scheduleItem are updated
-    mDataManager->mAllSession.clear();
-    // now add Generic Sessions
-    addGenericSessionsBoston201801();
-    addGenericSessionsBerlin201802();
-    qDebug() << "FINISH: ScheduleItems added";
-    // now insert sorted Sessions, update sessions for Day, Room, Tracks, Speaker
+    QMetaObject::invokeMethod(this, "sortUpdatedSessions", Qt::QueuedConnection);
+}
+
+void DataUtil::sortUpdatedSessions() {
+    // update sessions for touched Day, Room, Tracks, Speaker
     sortedSessionsIntoRoomDayTrackSpeaker();
     qDebug() << "FINISH: Rooms Days Tracks Speaker Sessions sorted";
 
+    QMetaObject::invokeMethod(this, "deleteUpdateOrphans", Qt::QueuedConnection);
+}
+
+void DataUtil::deleteUpdateOrphans() {
+    // removed Sessions are no longer referenced from Days, Rooms, Tracks, Speaker
+    bool favoritesRemoved = false;
+    for (int i = 0; i < mRemovedSessions.size(); ++i) {
+        Session* session = mRemovedSessions.at(i);
+        if(mDataManager->deleteFavoriteBySessionId(session->sessionId())) {
+            favoritesRemoved = true;
+        }
+        mSessionLists->removeFromScheduledSessions(session);
+        // no longer in mAllSession: its cache partition must be written
+        mDataManager->markSessionPartitionDirty(session);
+        session->deleteLater();
+    }
+    if(favoritesRemoved) {
+        mDataManager->saveFavoriteToCache();
+    }
+    qDebug() << "FINISH: Session orphans deleted";
+
+    // removed Speaker are no longer in mAllSpeaker (rebuilt from mMultiSpeaker)
+    // remaining Sessions still presented by them get rid of the pointer
+    for (int i = 0; i < mRemovedSpeakers.size(); ++i) {
+        Speaker* speaker = mRemovedSpeakers.at(i);
+        const QString speakerKey = QString::number(speaker->speakerId());
+        QMapIterator<QString, Session*> sessionIterator(mMultiSession);
+        while (sessionIterator.hasNext()) {
+            sessionIterator.next();
+            Session* session = sessionIterator.value();
+            if(session->arePresenterKeysResolved() && session->presenterKeys().contains(speakerKey)) {
+                session->removeFromPresenter(speaker);
+            }
+        }
+        speaker->deleteLater();
+    }
+    qDebug() << "FINISH: Speaker orphans deleted";
+    mRemovedSessions.clear();
+    mRemovedSpeakers.clear();
+
+    removeOrphanedRoomsAndTracks();
+
+    QMetaObject::invokeMethod(this, "saveUpdatedCaches", Qt::QueuedConnection);
+}
+
+// only caches touched by the change set are written
+// Speaker, Speaker Images and Tracks first, then the schedule
+void DataUtil::saveUpdatedCaches() {
+    mProgressInfotext.append("\n").append(tr("Now saving Conference Data to Cache"));
+    emit progressInfo(mProgressInfotext);
+
     // SPEAKER
-    mDataManager->saveSpeakerToCache();
-    qDebug() << "FINISH: Speaker saved";
+    if(!mChangeSet.speakers.isEmpty() || !mChangeSet.touchedSpeakers.isEmpty()) {
+        mDataManager->saveSpeakerToCache();
+        qDebug() << "FINISH: Speaker saved";
+    }
 
     // insert Speaker Images
     // do NOT mDataManager->mAllSpeakerImage.clear();
     // mMultiSpeakerImages contains NEW or UPDATED Speaker Images !
-    QMapIterator<bool, SpeakerImage*> speakerImagesIterator(mMultiSpeakerImages);
-    while (speakerImagesIterator.hasNext()) {
-        speakerImagesIterator.next();
-        SpeakerImage* speakerImage = speakerImagesIterator.value();
-        if(!mDataManager->findSpeakerImageBySpeakerId(speakerImage->speakerId())) {
-            // a NEW Speaker Image
-            qDebug() << "detcted NEW Speaker Image: " << speakerImage->speakerId();
-            mDataManager->insertSpeakerImage(speakerImage);
-        } else {
-            qDebug() << "detcted UPDATED Speaker Image: " << speakerImage->speakerId();
+    if(mChangeSet.speakerImagesChanged) {
+        QMapIterator<bool, SpeakerImage*> speakerImagesIterator(mMultiSpeakerImages);
+        while (speakerImagesIterator.hasNext()) {
+            speakerImagesIterator.next();
+            SpeakerImage* speakerImage = speakerImagesIterator.value();
+            if(!mDataManager->findSpeakerImageBySpeakerId(speakerImage->speakerId())) {
+                // a NEW Speaker Image
+                qDebug() << "detcted NEW Speaker Image: " << speakerImage->speakerId();
+                mDataManager->insertSpeakerImage(speakerImage);
+            } else {
+                qDebug() << "detcted UPDATED Speaker Image: " << speakerImage->speakerId();
+            }
         }
+        mDataManager->saveSpeakerImageToCache();
+        qDebug() << "FINISH: Speaker Images saved";
     }
-    mDataManager->saveSpeakerImageToCache();
-    qDebug() << "FINISH: Speaker Images saved";
 
     // Track sort by Name
-    QMultiMap<QString, SessionTrack*> sessionTrackSortMap;
-    for (int i = 0; i < mDataManager->allSessionTrack().size(); ++i) {
-        SessionTrack* sessionTrack = static_cast<SessionTrack*>( mDataManager->allSessionTrack().at(i));
-        sessionTrackSortMap.insert(sessionTrack->name(), sessionTrack);
-    }
-    qDebug() << "FINISH: Tracks sorted by Name";
-    mDataManager->mAllSessionTrack.clear();
-    QMapIterator<QString, SessionTrack*> sessionTrackIterator(sessionTrackSortMap);
-    while (sessionTrackIterator.hasNext()) {
-        sessionTrackIterator.next();
-        SessionTrack* sessionTrack = sessionTrackIterator.value();
-        mDataManager->insertSessionTrack(sessionTrack);
+    if(mChangeSet.tracks.hasAddedOrRemoved()) {
+        QMultiMap<QString, SessionTrack*> sessionTrackSortMap;
+        for (int i = 0; i < mDataManager->allSessionTrack().size(); ++i) {
+            SessionTrack* sessionTrack = static_cast<SessionTrack*>( mDataManager->allSessionTrack().at(i));
+            sessionTrackSortMap.insert(sessionTrack->name(), sessionTrack);
+        }
+        qDebug() << "FINISH: Tracks sorted by Name";
+        mDataManager->mAllSessionTrack.clear();
+        mDataManager->mSessionTrackByTrackId.clear();
+        QMapIterator<QString, SessionTrack*> sessionTrackIterator(sessionTrackSortMap);
+        while (sessionTrackIterator.hasNext()) {
+            sessionTrackIterator.next();
+            SessionTrack* sessionTrack = sessionTrackIterator.value();
+            mDataManager->insertSessionTrack(sessionTrack);
+        }
     }
     // save all Tracks with sorted Sessions
-    mDataManager->saveSessionTrackToCache();
-    qDebug() << "FINISH: Tracks saved";
+    if(mChangeSet.tracks.hasAddedOrRemoved() || !mChangeSet.touchedTracks.isEmpty()) {
+        mDataManager->saveSessionTrackToCache();
+        qDebug() << "FINISH: Tracks saved";
+    }
 
+    QMetaObject::invokeMethod(this, "saveUpdatedSchedule", Qt::QueuedConnection);
+}
+
+void DataUtil::saveUpdatedSchedule() {
     // Day: save all days with sorted Sessions
-    mDataManager->saveDayToCache();
-    qDebug() << "FINISH: Days saved";
+    if(!mChangeSet.touchedDays.isEmpty()) {
+        mDataManager->saveDayToCache();
+        qDebug() << "FINISH: Days saved";
+    }
 
     // Rooms: save all Rooms with sorted Sessions
-    mDataManager->saveRoomToCache();
-    qDebug() << "FINISH: Rooms saved";
+    if(mChangeSet.rooms.hasAddedOrRemoved() || !mChangeSet.touchedRooms.isEmpty()) {
+        mDataManager->saveRoomToCache();
+        qDebug() << "FINISH: Rooms saved";
+    }
 
     // Sessions
-    mDataManager->saveSessionToCache();
-    qDebug() << "FINISH: Sessions saved";
+    if(!mChangeSet.sessions.isEmpty()) {
+        mDataManager->saveSessionToCache();
+        qDebug() << "FINISH: Sessions saved";
+    }
 
     // SETTINGS update API
     mDataManager->mSettingsData->setApiVersion(mNewApi);
@@ -1705,19 +1901,60 @@ void DataUtil::finishUpdate() {
     mDataManager->saveSettings();
 
     // SAVE CONFERENCES
-    mDataManager->saveConferenceToCache();
-    qDebug() << "FINISH: Conference saved";
+    // rooms, tracks and counter of generic sessions are stored in Conference
+    if(mChangeSet.rooms.hasAddedOrRemoved() || mChangeSet.tracks.hasAddedOrRemoved() || mChangeSet.sessions.hasAddedOrRemoved()) {
+        mDataManager->saveConferenceToCache();
+        qDebug() << "FINISH: Conference saved";
+    }
 
+    QMetaObject::invokeMethod(this, "completeUpdate", Qt::QueuedConnection);
+}
+
+// current conference and My Schedule follow the new data, then the search index
+void DataUtil::completeUpdate() {
     mCurrentConference = nullptr;
     mCurrentConference = currentConference();
 
+    // new, changed or deprecated Sessions
+    if(mMyScheduleConference >= 0) {
+        rebuildMySchedule();
+    }
+
+    QMetaObject::invokeMethod(this, "completeUpdateSearchIndex", Qt::QueuedConnection);
+}
+
+void DataUtil::completeUpdateSearchIndex() {
+    updateSearchIndex();
+
     //
+    mProgressInfotext.append("\n").append(tr("Sessions")).append(" ").append(mChangeSet.sessions.summary());
+    mProgressInfotext.append("\n").append(tr("Speaker")).append(" ").append(mChangeSet.speakers.summary());
     mProgressInfotext.append("\n").append(tr("All done"));
     emit progressInfo(mProgressInfotext);
+    // parsed data and pointers collected while updating no longer needed
+    mImport = ScheduleImport();
+    mMultiSession.clear();
+    mMultiSpeaker.clear();
+    mMultiSpeakerImages.clear();
+    // next update only downloads modified data
+    mDataServer->commitValidators();
+    mUpdateCommitting = false;
     qDebug() << "FINISH: All Done";
     emit updateDone();
 }
 
+// nothing to parse or to compare
+void DataUtil::finishUnmodifiedUpdate() {
+    mDataManager->mSettingsData->setApiVersion(mNewApi);
+    mDataManager->mSettingsData->setLastUpdate(QDateTime::currentDateTime());
+    mDataManager->saveSettings();
+    mProgressInfotext.append("\n").append(tr("Schedule and Speaker not modified"));
+    mProgressInfotext.append("\n").append(tr("All done"));
+    emit progressInfo(mProgressInfotext);
+    qDebug() << "FINISH: Not Modified";
+    emit updateDone();
+}
+
 //  U T I L I T Y S  to manage Conference data
 
 /**
@@ -1727,6 +1964,7 @@ void DataUtil::finishUpdate() {
  */
 void DataUtil::setSessionFavorites()
 {
+    StartupPhase phase(QStringLiteral("setSessionFavorites"));
     for (int i = 0; i < mDataManager->allFavorite().size(); ++i) {
         Favorite* favorite = static_cast<Favorite*>( mDataManager->allFavorite().at(i));
         Session* session = mDataManager->findSessionBySessionId(favorite->sessionId());
@@ -1743,15 +1981,34 @@ void DataUtil::setSessionFavorites()
  */
 void DataUtil::saveSessionFavorites()
 {
-    mDataManager->mAllFavorite.clear();
+    QList<int> favoriteSessionIds;
+    // Sessions of conferences not loaded: keep the Favorites
+    for (int i = 0; i < mDataManager->mAllFavorite.size(); ++i) {
+        Favorite* favorite = static_cast<Favorite*>( mDataManager->mAllFavorite.at(i));
+        if(!mDataManager->findSessionBySessionId(favorite->sessionId())) {
+            favoriteSessionIds.append(favorite->sessionId());
+        }
+    }
     for (int i = 0; i < mDataManager->mAllSession.size(); ++i) {
         Session* session = static_cast<Session*>( mDataManager->mAllSession.at(i));
         if(session->isFavorite()) {
-            Favorite* favorite = mDataManager->createFavorite();
-            favorite->setSessionId(session->sessionId());
-            mDataManager->insertFavorite(favorite);
+            favoriteSessionIds.append(session->sessionId());
         }
     }
+    // unchanged Favorites: keep them, so the cache won't be written again
+    bool favoritesChanged = favoriteSessionIds.size() != mDataManager->mAllFavorite.size();
+    for (int i = 0; !favoritesChanged && i < favoriteSessionIds.size(); ++i) {
+        favoritesChanged = !mDataManager->mFavoriteBySessionId.contains(favoriteSessionIds.at(i));
+    }
+    if(!favoritesChanged) {
+        return;
+    }
+    mDataManager->deleteFavorite();
+    for (int i = 0; i < favoriteSessionIds.size(); ++i) {
+        Favorite* favorite = mDataManager->createFavorite();
+        favorite->setSessionId(favoriteSessionIds.at(i));
+        mDataManager->insertFavorite(favorite);
+    }
 }
 
 /**
@@ -1761,42 +2018,191 @@ void DataUtil::saveSessionFavorites()
  * so at startup or update this will be called
  */
 void DataUtil::resolveSessionsForSchedule() {
+    StartupPhase phase(QStringLiteral("resolveSessionsForSchedule"));
     for (int i = 0; i < mDataManager->allConference().size(); ++i) {
         Conference* conference = static_cast<Conference*>( mDataManager->allConference().at(i));
-        conference->resolveDaysKeys(mDataManager->listOfDayForKeys(conference->daysKeys()));
-        for (int d = 0; d < conference->days().size(); ++d) {
-            Day* day = conference->days().at(d);
-            // cannot use my  generated method, because it's loosing the sort
-            // TODO GENERATOR bug fix
-            // day->resolveSessionsKeys(mDataManager->listOfSessionForKeys(day->sessionsKeys()));
-            day->resolveSessionsKeys(listOfSessionForSortedKeys(day->sessionsKeys()));
+        // not loaded yet: resolved by loadConference()
+        if(!mDataManager->isConferenceLoaded(conference->id())) {
+            continue;
         }
-        conference->resolveRoomsKeys(mDataManager->listOfRoomForKeys(conference->roomsKeys()));
-        conference->resolveTracksKeys(mDataManager->listOfSessionTrackForKeys(conference->tracksKeys()));
+        resolveConferenceSchedule(conference);
     }
 }
 
-// TODO remove if Generator is fixed
-QList<Session*> DataUtil::listOfSessionForSortedKeys(
-        QStringList keyList)
+void DataUtil::resolveConferenceSchedule(Conference* conference)
 {
-    QList<Session*> listOfData;
-    keyList.removeDuplicates();
-    for (int k = 0; k < keyList.size(); ++k) {
-        int theSessionId = keyList.at(k).toInt();
-        for (int i = 0; i < mDataManager->allSession().size(); ++i) {
-            Session* session;
-            session = static_cast<Session*>( mDataManager->allSession().at(i));
-            if(session->sessionId() == theSessionId) {
-                listOfData.append(session);
-                break;
+    conference->resolveDaysKeys(mDataManager->listOfDayForKeys(conference->daysKeys()));
+    for (int d = 0; d < conference->days().size(); ++d) {
+        Day* day = conference->days().at(d);
+        // listOfSessionForKeys keeps the (sorted) order of the keys
+        day->resolveSessionsKeys(mDataManager->listOfSessionForKeys(day->sessionsKeys()));
+        buildDayTimeIndex(day);
+    }
+    conference->resolveRoomsKeys(mDataManager->listOfRoomForKeys(conference->roomsKeys()));
+    conference->resolveTracksKeys(mDataManager->listOfSessionTrackForKeys(conference->tracksKeys()));
+}
+
+//  S E S S I O N   M O D E L S
+
+SessionListModel* DataUtil::sessionListModel(QObject* container)
+{
+    if(!container) {
+        return nullptr;
+    }
+    SessionListModel* model = container->findChild<SessionListModel*>(QString(), Qt::FindDirectChildrenOnly);
+    if(!model) {
+        model = new SessionListModel(container, this);
+        // deleted together with the container, not from QML garbage collection
+        QQmlEngine::setObjectOwnership(model, QQmlEngine::CppOwnership);
+    }
+    return model;
+}
+
+//  S E A R C H
+
+void DataUtil::buildSearchIndex()
+{
+    StartupPhase phase(QStringLiteral("buildSearchIndex"));
+    mSearchIndex.clear();
+    indexMissingDataObjects();
+    mSearchIndexBuilt = true;
+    qDebug() << "Search Index built - records #" << mSearchIndex.size();
+    mSearchResultModel->refresh();
+}
+
+SearchResultModel* DataUtil::searchModel()
+{
+    return mSearchResultModel;
+}
+
+// title, description, abstract + names of tracks and room
+void DataUtil::indexSession(Session* session)
+{
+    QStringList texts;
+    texts << session->title() << session->description() << session->abstractText();
+    const QStringList trackKeys = session->sessionTracksKeys();
+    for (int i = 0; i < trackKeys.size(); ++i) {
+        SessionTrack* sessionTrack = mDataManager->findSessionTrackByTrackId(trackKeys.at(i).toInt());
+        if(sessionTrack) {
+            texts << sessionTrack->name();
+        }
+    }
+    Room* room = mDataManager->findRoomByRoomId(session->room());
+    if(room) {
+        texts << room->roomName();
+    }
+    mSearchIndex.insert(SearchIndex::SessionRecord, session->sessionId(), texts);
+}
+
+// name, title (company), bio
+void DataUtil::indexSpeaker(Speaker* speaker)
+{
+    mSearchIndex.insert(SearchIndex::SpeakerRecord, speaker->speakerId(),
+                        QStringList() << speaker->name() << speaker->title() << speaker->bio());
+}
+
+// at startup all, later Sessions, Rooms, Tracks of lazy loaded conferences
+void DataUtil::indexMissingDataObjects()
+{
+    for (int i = 0; i < mDataManager->mAllSessionTrack.size(); ++i) {
+        SessionTrack* sessionTrack = static_cast<SessionTrack*>( mDataManager->mAllSessionTrack.at(i));
+        if(!mSearchIndex.contains(SearchIndex::TrackRecord, sessionTrack->trackId())) {
+            mSearchIndex.insert(SearchIndex::TrackRecord, sessionTrack->trackId(), QStringList(sessionTrack->name()));
+        }
+    }
+    for (int i = 0; i < mDataManager->mAllRoom.size(); ++i) {
+        Room* room = static_cast<Room*>( mDataManager->mAllRoom.at(i));
+        // dummy room 0 (room unknown) isn't searchable
+        if(room->roomId() > 0 && !mSearchIndex.contains(SearchIndex::RoomRecord, room->roomId())) {
+            mSearchIndex.insert(SearchIndex::RoomRecord, room->roomId(), QStringList(room->roomName()));
+        }
+    }
+    for (int i = 0; i < mDataManager->mAllSpeaker.size(); ++i) {
+        Speaker* speaker = static_cast<Speaker*>( mDataManager->mAllSpeaker.at(i));
+        if(!mSearchIndex.contains(SearchIndex::SpeakerRecord, speaker->speakerId())) {
+            indexSpeaker(speaker);
+        }
+    }
+    for (int i = 0; i < mDataManager->mAllSession.size(); ++i) {
+        Session* session = static_cast<Session*>( mDataManager->mAllSession.at(i));
+        if(!mSearchIndex.contains(SearchIndex::SessionRecord, session->sessionId())) {
+            indexSession(session);
+        }
+    }
+}
+
+// only DataObjects of the change set
+void DataUtil::updateSearchIndex()
+{
+    if(!mSearchIndexBuilt) {
+        return;
+    }
+    QSetIterator<int> removedIterator(mChangeSet.sessions.removed);
+    while (removedIterator.hasNext()) {
+        mSearchIndex.remove(SearchIndex::SessionRecord, removedIterator.next());
+    }
+    removedIterator = mChangeSet.speakers.removed;
+    while (removedIterator.hasNext()) {
+        mSearchIndex.remove(SearchIndex::SpeakerRecord, removedIterator.next());
+    }
+    removedIterator = mChangeSet.rooms.removed;
+    while (removedIterator.hasNext()) {
+        mSearchIndex.remove(SearchIndex::RoomRecord, removedIterator.next());
+    }
+    removedIterator = mChangeSet.tracks.removed;
+    while (removedIterator.hasNext()) {
+        mSearchIndex.remove(SearchIndex::TrackRecord, removedIterator.next());
+    }
+    QSetIterator<int> changedIterator(mChangeSet.sessions.changed);
+    while (changedIterator.hasNext()) {
+        Session* session = mDataManager->findSessionBySessionId(changedIterator.next());
+        if(session) {
+            indexSession(session);
+        }
+    }
+    changedIterator = mChangeSet.speakers.changed;
+    while (changedIterator.hasNext()) {
+        Speaker* speaker = mDataManager->findSpeakerBySpeakerId(changedIterator.next());
+        if(speaker) {
+            indexSpeaker(speaker);
+        }
+    }
+    // names of Tracks and Rooms are indexed with their sessions
+    changedIterator = mChangeSet.tracks.changed;
+    while (changedIterator.hasNext()) {
+        SessionTrack* sessionTrack = mDataManager->findSessionTrackByTrackId(changedIterator.next());
+        if(sessionTrack) {
+            mSearchIndex.insert(SearchIndex::TrackRecord, sessionTrack->trackId(), QStringList(sessionTrack->name()));
+        }
+    }
+    changedIterator = mChangeSet.rooms.changed;
+    while (changedIterator.hasNext()) {
+        Room* room = mDataManager->findRoomByRoomId(changedIterator.next());
+        if(room && room->roomId() > 0) {
+            mSearchIndex.insert(SearchIndex::RoomRecord, room->roomId(), QStringList(room->roomName()));
+        }
+    }
+    if(!mChangeSet.tracks.changed.isEmpty() || !mChangeSet.rooms.changed.isEmpty()) {
+        for (int i = 0; i < mDataManager->mAllSession.size(); ++i) {
+            Session* session = static_cast<Session*>( mDataManager->mAllSession.at(i));
+            // already indexed above
+            if(mChangeSet.sessions.changed.contains(session->sessionId())) {
+                continue;
+            }
+            bool containerChanged = mChangeSet.rooms.changed.contains(session->room());
+            const QStringList trackKeys = session->sessionTracksKeys();
+            for (int t = 0; t < trackKeys.size() && !containerChanged; ++t) {
+                containerChanged = mChangeSet.tracks.changed.contains(trackKeys.at(t).toInt());
+            }
+            if(containerChanged) {
+                indexSession(session);
             }
-        } // loop sessions
-    } // loop keys
-    if(listOfData.size() != keyList.size()) {
-        qDebug() << "not all found for keys";
+        }
     }
-    return listOfData;
+    // added ones
+    indexMissingDataObjects();
+    qDebug() << "Search Index updated - records #" << mSearchIndex.size();
+    mSearchResultModel->refresh();
 }
 
 /**
@@ -1806,6 +2212,7 @@ QList<Session*> DataUtil::listOfSessionForSortedKeys(
  */
 void DataUtil::resolveSessionsForTracks()
 {
+    StartupPhase phase(QStringLiteral("resolveSessionsForTracks"));
     for (int i = 0; i < mDataManager->mAllSessionTrack.size(); ++i) {
         SessionTrack* sessionTrack = static_cast<SessionTrack*>( mDataManager->mAllSessionTrack.at(i));
         sessionTrack->resolveSessionsKeys(mDataManager->listOfSessionForKeys(sessionTrack->sessionsKeys()));
@@ -1814,6 +2221,7 @@ void DataUtil::resolveSessionsForTracks()
 
 void DataUtil::resolveSessionsForRooms()
 {
+    StartupPhase phase(QStringLiteral("resolveSessionsForRooms"));
     for (int i = 0; i < mDataManager->mAllRoom.size(); ++i) {
         Room* room = static_cast<Room*>( mDataManager->mAllRoom.at(i));
         room->resolveSessionsKeys(mDataManager->listOfSessionForKeys(room->sessionsKeys()));
@@ -1834,6 +2242,8 @@ Conference* DataUtil::switchConference() {
     } else {
         mCurrentConference = static_cast<Conference*>( mDataManager->allConference().first());
     }
+    loadConference(mCurrentConference);
+    emit currentConferenceChanged();
     return mCurrentConference;
 }
 
@@ -1880,10 +2290,73 @@ Conference* DataUtil::currentConference() {
         // if currentDate > last day of first conference: use the second one
         mCurrentConference = static_cast<Conference*>( mDataManager->allConference().last());
         qDebug() << "Current Conference is last: " << mCurrentConference->conferenceCity();
+        loadConference(mCurrentConference);
+        emit currentConferenceChanged();
     }
     return mCurrentConference;
 }
 
+// per ex. before updating: Days of all conferences must be resolved
+void DataUtil::loadAllConferences()
+{
+    for (int i = 0; i < mDataManager->allConference().size(); ++i) {
+        loadConference(static_cast<Conference*>( mDataManager->allConference().at(i)));
+    }
+}
+
+// Rooms, Sessions, Tracks and Days of other conferences are loaded on demand
+// only the DataObjects read from the conference partition are resolved and indexed
+void DataUtil::loadConference(Conference* conference)
+{
+    if(mDataManager->isConferenceLoaded(conference->id())) {
+        return;
+    }
+    const int sessionsBefore = mDataManager->mAllSession.size();
+    const int roomsBefore = mDataManager->mAllRoom.size();
+    const int tracksBefore = mDataManager->mAllSessionTrack.size();
+    mDataManager->loadConference(conference->id());
+    const QList<QObject*> loadedSessions = mDataManager->mAllSession.mid(sessionsBefore);
+    const QList<QObject*> loadedRooms = mDataManager->mAllRoom.mid(roomsBefore);
+    const QList<QObject*> loadedTracks = mDataManager->mAllSessionTrack.mid(tracksBefore);
+    for (int i = 0; i < loadedSessions.size(); ++i) {
+        Session* session = static_cast<Session*>( loadedSessions.at(i));
+        if(mDataManager->mFavoriteBySessionId.contains(session->sessionId())) {
+            session->setIsFavorite(true);
+        }
+    }
+    resolveConferenceSchedule(conference);
+    for (int i = 0; i < loadedRooms.size(); ++i) {
+        Room* room = static_cast<Room*>( loadedRooms.at(i));
+        room->resolveSessionsKeys(mDataManager->listOfSessionForKeys(room->sessionsKeys()));
+    }
+    for (int i = 0; i < loadedTracks.size(); ++i) {
+        SessionTrack* sessionTrack = static_cast<SessionTrack*>( loadedTracks.at(i));
+        sessionTrack->resolveSessionsKeys(mDataManager->listOfSessionForKeys(sessionTrack->sessionsKeys()));
+    }
+    if(!mSearchIndexBuilt) {
+        return;
+    }
+    for (int i = 0; i < loadedRooms.size(); ++i) {
+        Room* room = static_cast<Room*>( loadedRooms.at(i));
+        // dummy room 0 (room unknown) isn't searchable
+        if(room->roomId() > 0 && !mSearchIndex.contains(SearchIndex::RoomRecord, room->roomId())) {
+            mSearchIndex.insert(SearchIndex::RoomRecord, room->roomId(), QStringList(room->roomName()));
+        }
+    }
+    for (int i = 0; i < loadedTracks.size(); ++i) {
+        SessionTrack* sessionTrack = static_cast<SessionTrack*>( loadedTracks.at(i));
+        if(!mSearchIndex.contains(SearchIndex::TrackRecord, sessionTrack->trackId())) {
+            mSearchIndex.insert(SearchIndex::TrackRecord, sessionTrack->trackId(), QStringList(sessionTrack->name()));
+        }
+    }
+    for (int i = 0; i < loadedSessions.size(); ++i) {
+        Session* session = static_cast<Session*>( loadedSessions.at(i));
+        if(!mSearchIndex.contains(SearchIndex::SessionRecord, session->sessionId())) {
+            indexSession(session);
+        }
+    }
+}
+
 QString DataUtil::scheduleTabName(int tabBarIndex)
 {
     if(!mCurrentConference) {
@@ -1906,23 +2379,71 @@ SessionLists *DataUtil::mySchedule()
     return mSessionLists;
 }
 
+// My Schedule order: day and start time (sortKey), then sessionId
+static bool isScheduledBefore(Session* session, Session* other)
+{
+    if(session->sortKey() != other->sortKey()) {
+        return session->sortKey() < other->sortKey();
+    }
+    return session->sessionId() < other->sessionId();
+}
+
+// nothing to do if already built for the current conference
 void DataUtil::refreshMySchedule()
 {
     if(!mCurrentConference) {
         currentConference();
     }
-    mSessionLists->clearScheduledSessions();
+    if(mCurrentConference && mMyScheduleConference != mCurrentConference->id()) {
+        rebuildMySchedule();
+    }
+    emit myScheduleRefreshed();
+}
+
+// all favorites of the current conference
+// connects all Sessions of the conference to keep the list sorted
+void DataUtil::rebuildMySchedule()
+{
+    QList<Session*> scheduledSessions;
     for (int d = 0; d < mCurrentConference->days().size(); ++d) {
         Day* day = mCurrentConference->days().at(d);
         for (int s = 0; s < day->sessions().size(); ++s) {
             Session* session = static_cast<Session*> (day->sessions().at(s));
+            bool res = connect(session, SIGNAL(isFavoriteChanged(bool)), this, SLOT(onSessionFavoriteChanged(bool)), Qt::UniqueConnection);
+            if (!res) {
+                Q_ASSERT(res);
+            }
             if(!session->isDeprecated() && session->isFavorite()) {
-                mSessionLists->addToScheduledSessions(session);
+                scheduledSessions.append(session);
             }
         }
     }
+    std::sort(scheduledSessions.begin(), scheduledSessions.end(), isScheduledBefore);
+    // unchanged Sessions keep their rows in sessionListModel(mySchedule())
+    mSessionLists->setScheduledSessions(scheduledSessions);
+    mMyScheduleConference = mCurrentConference->id();
     qDebug() << "MY SCHEDLUE #:" << mSessionLists->scheduledSessionsCount();
-    emit myScheduleRefreshed();
+}
+
+// binary search for the position, only this Session inserted or removed
+void DataUtil::onSessionFavoriteChanged(bool isFavorite)
+{
+    Session* session = qobject_cast<Session*>(sender());
+    if(!session || session->isDeprecated() || mMyScheduleConference < 0) {
+        return;
+    }
+    Day* day = mDataManager->findDayById(session->sessionDay());
+    if(!day || day->conference() != mMyScheduleConference) {
+        return;
+    }
+    const QList<Session*> scheduledSessions = mSessionLists->scheduledSessions();
+    QList<Session*>::const_iterator it = std::lower_bound(scheduledSessions.constBegin(), scheduledSessions.constEnd(), session, isScheduledBefore);
+    const bool isScheduled = it != scheduledSessions.constEnd() && *it == session;
+    if(isFavorite && !isScheduled) {
+        mSessionLists->insertIntoScheduledSessions(it - scheduledSessions.constBegin(), session);
+    } else if(!isFavorite && isScheduled) {
+        mSessionLists->removeFromScheduledSessions(session);
+    }
 }
 
 int DataUtil::findFirstSessionItem(int conferenceDayIndex, QString pickedTime)
@@ -1935,25 +2456,109 @@ int DataUtil::findFirstSessionItem(int conferenceDayIndex, QString pickedTime)
         return -1;
     }
     Day* day = static_cast<Day*> (mCurrentConference->days().at(conferenceDayIndex));
-    for (int i = 0; i < day->sessions().size(); ++i) {
-        Session* session = day->sessions().at(i);
-        QString theTime = session->sortKey().right(5);
-        if(theTime >= pickedTime) {
-            return i;
+    // pickedTime: "HH:mm" from TimePicker
+    const int minutes = pickedTime.section(':', 0, 0).toInt() * 60 + pickedTime.section(':', 1, 1).toInt();
+    return dayTimeIndex(day).firstStartingAt(minutes);
+}
+
+int DataUtil::todayDayIndex()
+{
+    if(!mCurrentConference) {
+        currentConference();
+    }
+    if(!mCurrentConference) {
+        return -1;
+    }
+    const QDate today = QDate::currentDate();
+    for (int d = 0; d < mCurrentConference->days().size(); ++d) {
+        if(mCurrentConference->days().at(d)->conferenceDay() == today) {
+            return d;
         }
     }
-    return day->sessions().size();
+    return -1;
+}
+
+int DataUtil::findCurrentSessionItem(int conferenceDayIndex)
+{
+    if(!mCurrentConference) {
+        currentConference();
+    }
+    if(conferenceDayIndex < 0 || conferenceDayIndex > (mCurrentConference->days().size()-1)) {
+        qDebug() << "Day Index wrong: conferenceDayIndex";
+        return -1;
+    }
+    Day* day = static_cast<Day*> (mCurrentConference->days().at(conferenceDayIndex));
+    return dayTimeIndex(day).firstEndingAfter(DayTimeIndex::minutesOf(QTime::currentTime()));
+}
+
+// Day::sessions() are sorted by start time
+void DataUtil::buildDayTimeIndex(Day* day)
+{
+    mDayTimeIndex[day->id()].build(day->sessions());
+}
+
+// built again if Sessions were added without sorting them into the Day
+const DayTimeIndex& DataUtil::dayTimeIndex(Day* day)
+{
+    QHash<int, DayTimeIndex>::iterator it = mDayTimeIndex.find(day->id());
+    if(it == mDayTimeIndex.end() || it.value().size() != day->sessionsCount()) {
+        buildDayTimeIndex(day);
+        it = mDayTimeIndex.find(day->id());
+    }
+    return it.value();
 }
 
 int DataUtil::findFirstSpeakerItem(QString letter)
 {
+    if(!mSpeakerSectionsBuilt) {
+        buildSpeakerSections();
+    }
+    const int firstRow = mSpeakerSectionFirstRow.value(letter, -1);
+    if(firstRow >= 0) {
+        return firstRow;
+    }
+    // no Speaker with this letter: first section after it
+    for (int i = 0; i < mSpeakerLetters.size(); ++i) {
+        if(mSpeakerLetters.at(i) >= letter) {
+            return mSpeakerSectionFirstRow.value(mSpeakerLetters.at(i));
+        }
+    }
+    return mDataManager->mAllSpeaker.size();
+}
+
+QStringList DataUtil::speakerLetters()
+{
+    if(!mSpeakerSectionsBuilt) {
+        buildSpeakerSections();
+    }
+    return mSpeakerLetters;
+}
+
+int DataUtil::speakerSectionCount(QString letter)
+{
+    if(!mSpeakerSectionsBuilt) {
+        buildSpeakerSections();
+    }
+    return mSpeakerSectionCount.value(letter, 0);
+}
+
+// mAllSpeaker is sorted by sortKey, sortGroup is the first letter of sortKey
+void DataUtil::buildSpeakerSections()
+{
+    mSpeakerLetters.clear();
+    mSpeakerSectionFirstRow.clear();
+    mSpeakerSectionCount.clear();
     for (int i = 0; i < mDataManager->mAllSpeaker.size(); ++i) {
         Speaker* speaker = static_cast<Speaker*>( mDataManager->mAllSpeaker.at(i));
-        if(speaker->sortGroup() >= letter) {
-            return i;
+        const QString letter = speaker->sortGroup();
+        if(!mSpeakerSectionFirstRow.contains(letter)) {
+            mSpeakerLetters.append(letter);
+            mSpeakerSectionFirstRow.insert(letter, i);
         }
+        mSpeakerSectionCount[letter]++;
     }
-    return mDataManager->mAllSpeaker.size();
+    mSpeakerSectionsBuilt = true;
+    qDebug() << "Speaker sections #" << mSpeakerLetters.size();
 }
 
 // Sortkey: day->conferenceDay().toString(YYYY_MM_DD)+session->startTime().toString("HH:mm")
@@ -1983,27 +2588,27 @@ QString DataUtil::apiInfo()
 
 //   DOWNLOAD   S P E A K E R I M A G E S
 // SLOT   UPDATE CONFERENCE
-void DataUtil::onSpeakerImageUpdateLoaded(QObject *dataObject, int width, int height)
+void DataUtil::onSpeakerImageUpdateLoaded(QObject *dataObject, QImage originImage)
 {
-    mImageLoader->deleteLater();
     SpeakerImage* speakerImage = static_cast<SpeakerImage*>( dataObject);
     qDebug() << "onSpeakerImage  L O A D E D ";
     speakerImage->setDownloadSuccess(true);
     speakerImage->setDownloadFailed(false);
     speakerImage->setInAssets(false);
     speakerImage->setInData(true);
-    prepareHighDpiImages(speakerImage, width, height);
+    prepareHighDpiImages(speakerImage, originImage);
     // set update flag
     int count = mMultiSpeakerImages.remove(false, speakerImage);
     if(count != 1) {
         qWarning() << "something went wrong: the SpeakerImage MUST exist in MultiMap";
     }
     mMultiSpeakerImages.insert(true, speakerImage);
+    mProgressInfotext.append(".");
+    emit progressInfo(mProgressInfotext);
     // check for more
     updateSpeakerImages();
 }
 void DataUtil::onSpeakerImageUpdateFailed(QObject *dataObject, QString message) {
-    mImageLoader->deleteLater();
     SpeakerImage* speakerImage = static_cast<SpeakerImage*>( dataObject);
     qDebug() << "UPDATE: Cannot load Speaker Image:  " << message << speakerImage->speakerId();
     speakerImage->setDownloadSuccess(false);
@@ -2016,114 +2621,59 @@ void DataUtil::onSpeakerImageUpdateFailed(QObject *dataObject, QString message)
         qWarning() << "something went wrong: the SpeakerImage MUST exist in MultiMap";
     }
     mMultiSpeakerImages.insert(true, speakerImage);
+    mProgressInfotext.append(".");
+    emit progressInfo(mProgressInfotext);
     // check for more
     updateSpeakerImages();
 }
 
-void DataUtil::prepareHighDpiImages(SpeakerImage* speakerImage, int width, int height) {
-    const QString speakerImagesPath = mConferenceDataPath + "speakerImages/";
-    QString fileName;
-    fileName = speakerImagesPath + "speaker_";
-    fileName.append(QString::number(speakerImage->speakerId()));
-    QString originFileName;
-    originFileName = fileName + "." + speakerImage->suffix();
-    const int size1 = 96;
-    const int size2 = 192;
-    const int size3 = 288;
-    const int size4 = 384;
-    if(width >= height) {
-        if(width < size1) {
-            speakerImage->setMaxScaleFactor(0);
-            return;
-        }
-        QFile originFile(originFileName);
-        if(!originFile.exists()) {
-            qWarning() << "SpeakerImage Path not found " << originFileName;
-            return;
-        }
-        if (!originFile.open(QIODevice::ReadOnly)) {
-            qWarning() << "Couldn't open file: " << originFileName;
-            return;
-        }
-        QImage originImage = QImage::fromData(originFile.readAll());
-        if(originImage.isNull()) {
-            qWarning() << "Cannot construct Image from file: " << originFileName;
-            return;
-        }
-        originImage.save(fileName+"_origin."+speakerImage->suffix());
-        QImage scaledImage;
-        if(width >= size1) {
-            scaledImage = originImage.scaledToWidth(size1);
-            scaledImage.save(originFileName);
-            speakerImage->setMaxScaleFactor(1);
-        }
-        if(width >= size2) {
-            scaledImage = originImage.scaledToWidth(size2);
-            scaledImage.save(fileName+"@2x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(2);
-        }
-        if(width >= size3) {
-            scaledImage = originImage.scaledToWidth(size3);
-            scaledImage.save(fileName+"@3x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(3);
-        }
-        if(width >= size4) {
-            scaledImage = originImage.scaledToWidth(size4);
-            scaledImage.save(fileName+"@4x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(4);
-        }
+void DataUtil::prepareHighDpiImages(SpeakerImage* speakerImage, const QImage& originImage) {
+    HighDpiImageJob job;
+    job.dataObject = speakerImage;
+    job.originImage = originImage;
+    job.fileName = mConferenceDataPath + "speakerImages/speaker_" + QString::number(speakerImage->speakerId());
+    job.suffix = speakerImage->suffix();
+    QFutureWatcher<HighDpiImageResult>* watcher = new QFutureWatcher<HighDpiImageResult>(this);
+    bool res = connect(watcher, SIGNAL(finished()), this,
+                       SLOT(onHighDpiImagesPrepared()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    mHighDpiImagesPending++;
+    watcher->setFuture(QtConcurrent::run(&HighDpiImages::prepare, job));
+}
+
+// back on GUI thread: images stored, now we know the maxScaleFactor
+void DataUtil::onHighDpiImagesPrepared() {
+    QFutureWatcher<HighDpiImageResult>* watcher = static_cast<QFutureWatcher<HighDpiImageResult>*>(sender());
+    HighDpiImageResult result = watcher->result();
+    watcher->deleteLater();
+    mHighDpiImagesPending--;
+    SpeakerImage* speakerImage = static_cast<SpeakerImage*>( result.dataObject);
+    if(result.success) {
+        speakerImage->setMaxScaleFactor(result.maxScaleFactor);
     } else {
-        if(height < size1) {
-            speakerImage->setMaxScaleFactor(0);
-            return;
-        }
-        QFile originFile(originFileName);
-        if(!originFile.exists()) {
-            qWarning() << "SpeakerImage Path not found " << originFileName;
-            return;
-        }
-        if (!originFile.open(QIODevice::ReadOnly)) {
-            qWarning() << "Couldn't open file: " << originFileName;
-            return;
-        }
-        QImage originImage = QImage::fromData(originFile.readAll());
-        if(originImage.isNull()) {
-            qWarning() << "Cannot construct Image from file: " << originFileName;
-            return;
-        }
-        originImage.save(fileName+"_origin."+speakerImage->suffix());
-        QImage scaledImage;
-        if(height >= size1) {
-            scaledImage = originImage.scaledToHeight(size1);
-            scaledImage.save(originFileName);
-            speakerImage->setMaxScaleFactor(1);
-        }
-        if(height >= size2) {
-            scaledImage = originImage.scaledToHeight(size2);
-            scaledImage.save(fileName+"@2x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(2);
-        }
-        if(height >= size3) {
-            scaledImage = originImage.scaledToHeight(size3);
-            scaledImage.save(fileName+"@3x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(3);
-        }
-        if(height >= size4) {
-            scaledImage = originImage.scaledToHeight(size4);
-            scaledImage.save(fileName+"@4x."+speakerImage->suffix());
-            speakerImage->setMaxScaleFactor(4);
-        }
+        qWarning() << "UPDATE: Cannot store Speaker Image " << speakerImage->speakerId();
+        speakerImage->setDownloadSuccess(false);
+        speakerImage->setDownloadFailed(true);
+        speakerImage->setInData(false);
     }
+    // check if all done
+    updateSpeakerImages();
 }
 
 // S L O T S
 void DataUtil::onServerSuccess()
 {
-    qDebug() << "S U C C E S S request Schedule (BOSTON, BERLIN) and Speaker";
+    qDebug() << "S U C C E S S request Schedules #" << mScheduleSources.size() << " and Speaker";
 
     // check if conference is prepared
-    if(isOldConference() || mDataManager->allConference().empty() || mDataManager->settingsData()->version() < 2018005) {
+    if(!isConferencePrepared()) {
         prepareConference();
+    } else if(!mDataServer->hasModifiedData()) {
+        // '304 Not Modified' for all: data from last update is current
+        finishUnmodifiedUpdate();
+        return;
     }
     continueUpdate();
 }
@@ -3,12 +3,23 @@
 
 #include <QObject>
 #include "gen/DataManager.hpp"
-#include "imageloader.hpp"
+#include "imagedownloadscheduler.hpp"
 #include "dataserver.hpp"
+#include "updatechangeset.hpp"
+#include "scheduleimporter.hpp"
+#include "highdpiimages.hpp"
+#include "searchindex.hpp"
+#include "searchresultmodel.hpp"
+#include "sessionlistmodel.hpp"
+#include "daytimeindex.hpp"
+
+#include <QFutureWatcher>
 
 class DataUtil : public QObject
 {
     Q_OBJECT
+    // benchmarks/datalayerbenchmark
+    friend class DataLayerBenchmark;
 public:
     explicit DataUtil(QObject *parent = nullptr);
 
@@ -22,6 +33,10 @@ public:
     Q_INVOKABLE
     void startUpdate();
 
+    // update from speaker.json, schedule_<id>.json already in conference data path
+    // without server requests
+    void updateFromConferenceData();
+
     Q_INVOKABLE
     void setSessionFavorites();
     void saveSessionFavorites();
@@ -29,6 +44,18 @@ public:
     Q_INVOKABLE
     void resolveSessionsForSchedule();
 
+    // full-text search over Sessions, Speaker, Tracks, Rooms
+    // built once after data was loaded, updated by schedule updates
+    Q_INVOKABLE
+    void buildSearchIndex();
+    SearchResultModel* searchModel();
+
+    // ListView model of the sessions of a Day, Room, SessionTrack, Speaker
+    // or of the scheduled sessions of SessionLists (My Schedule)
+    // created once per container, updated row by row
+    Q_INVOKABLE
+    SessionListModel* sessionListModel(QObject* container);
+
     Q_INVOKABLE
     void resolveSessionsForTracks();
 
@@ -44,15 +71,33 @@ public:
     Q_INVOKABLE
     SessionLists* mySchedule();
 
+    // My Schedule is built once per current conference
+    // then kept sorted while Session::isFavorite changes
     Q_INVOKABLE
     void refreshMySchedule();
 
     Q_INVOKABLE
     int findFirstSessionItem(int conferenceDayIndex, QString pickedTime);
 
+    // jump to now: index of today in current conference or -1
+    Q_INVOKABLE
+    int todayDayIndex();
+
+    // first Session of the day not finished yet
+    Q_INVOKABLE
+    int findCurrentSessionItem(int conferenceDayIndex);
+
     Q_INVOKABLE
     int findFirstSpeakerItem(QString letter);
 
+    // sections (sortGroup) of the speaker list in list order
+    // LetterPicker only shows these letters
+    Q_INVOKABLE
+    QStringList speakerLetters();
+
+    Q_INVOKABLE
+    int speakerSectionCount(QString letter);
+
     Q_INVOKABLE
     QString localWeekdayAndTime(QString sessionSortkey);
 
@@ -113,6 +158,9 @@ public:
 
 signals:
     void myScheduleRefreshed();
+    void speakerSectionsChanged();
+    // selected, switched or reloaded after update: per ex. todayDayIndex() changes
+    void currentConferenceChanged();
 
     void updateAvailable(const QString apiVersion);
     void noUpdateRequired();
@@ -124,28 +172,79 @@ signals:
     void progressInfo(const QString progressInfo);
 
 public slots:
-    void onSpeakerImageUpdateLoaded(QObject *dataObject, int width, int height);
+    void onSpeakerImageUpdateLoaded(QObject *dataObject, QImage originImage);
     void onSpeakerImageUpdateFailed(QObject *dataObject, QString message);
 
 private slots:
     void onServerSuccess();
     void onServerFailed(const QString message);
 
+    void onImportProgress(const QString progressText);
+    void onImportFinished();
+
+    void onHighDpiImagesPrepared();
+
     void onVersionSuccess(QByteArray currentVersionBytes);
     void onVersionFailed(const QString message);
 
+    void onSessionFavoriteChanged(bool isFavorite);
+
+    // update: applying the parsed data is split into event loop slices
+    void applyNextSpeakers();
+    void updateNextDay();
+    void finishUpdate();
+    void insertUpdatedSpeakers();
+    void insertUpdatedSessions();
+    void sortUpdatedSessions();
+    void deleteUpdateOrphans();
+    void saveUpdatedCaches();
+    void saveUpdatedSchedule();
+    void completeUpdate();
+    void completeUpdateSearchIndex();
+
 private:
 
     DataManager* mDataManager;
     DataServer* mDataServer;
 
     Conference* mCurrentConference;
+    void loadConference(Conference* conference);
+    void loadAllConferences();
+    void resolveConferenceSchedule(Conference* conference);
 
-    ImageLoader* mImageLoader;
+    // speaker images are downloaded in parallel
+    ImageDownloadScheduler* mImageDownloadScheduler;
 
     SessionLists* mSessionLists;
-
-    void prepareHighDpiImages(SpeakerImage *speakerImage, int width, int height);
+    // first row and number of rows of each sortGroup in mAllSpeaker
+    QStringList mSpeakerLetters;
+    QHash<QString, int> mSpeakerSectionFirstRow;
+    QHash<QString, int> mSpeakerSectionCount;
+    bool mSpeakerSectionsBuilt;
+    void buildSpeakerSections();
+
+    // key: Day id
+    QHash<int, DayTimeIndex> mDayTimeIndex;
+    void buildDayTimeIndex(Day* day);
+    const DayTimeIndex& dayTimeIndex(Day* day);
+
+    // conference of scheduled sessions, -1: must be rebuilt
+    int mMyScheduleConference;
+    void rebuildMySchedule();
+
+    SearchIndex mSearchIndex;
+    SearchResultModel* mSearchResultModel;
+    bool mSearchIndexBuilt;
+    void indexSession(Session* session);
+    void indexSpeaker(Speaker* speaker);
+    void indexMissingDataObjects();
+    void updateSearchIndex();
+    // after all DataObjects were deleted or read again
+    void resetDerivedIndexes();
+
+    // scaling speaker images runs on worker threads
+    void prepareHighDpiImages(SpeakerImage *speakerImage, const QImage& originImage);
+    int mHighDpiImagesPending;
 
     void prepareEventData();
     void prepareRooms();
@@ -160,29 +259,48 @@ private:
     QString mCacheDataPath;
 
     // UPDATE
+    bool isConferencePrepared();
+    QList<ScheduleSource> scheduleSources();
+    QList<ScheduleSource> mScheduleSources;
     void continueUpdate();
     QString mNewApi;
     QString mProgressInfotext;
     QMultiMap<QString, Session*> mMultiSession;
     QMultiMap<QString, Speaker*> mMultiSpeaker;
     QMultiMap<bool, SpeakerImage*> mMultiSpeakerImages;
-    QVariantMap readScheduleFile(const QString schedulePath);
-    QVariantList readSpeakerFile(const QString speakerPath);
+    // parsing runs on a worker thread
+    ScheduleImporter* mScheduleImporter;
+    QFutureWatcher<ScheduleImport>* mImportWatcher;
+    ScheduleImport mImport;
+    // parsed data is being applied (see onImportFinished() .. completeUpdate())
+    bool mUpdateCommitting;
+    // next Speaker of mImport, next Day of the next Conference of mScheduleSources
+    int mUpdateSpeakerIndex;
+    int mUpdateConferenceIndex;
+    int mUpdateDayIndex;
+    // not received from server: deleted by deleteUpdateOrphans()
+    QList<Session*> mRemovedSessions;
+    QList<Speaker*> mRemovedSpeakers;
+    void applySpeaker();
+    void applyImportedSpeaker(const ImportedSpeaker& importedSpeaker);
     QVariantList readRoomMappingFile(const QString path);
-    void calcSpeakerName(Speaker *speaker, SpeakerAPI *speakerAPI);
+    void calcSpeakerName(Speaker *speaker, const ImportedSpeaker& importedSpeaker);
     void updateSpeakerImages();
-    bool updateSessions(const int conferenceId);
+    bool checkImportedSchedules();
+    void updateSessions(Conference* conference, const ImportedSchedule* schedule, const QString& city);
+    void updateSessionsOfDay(const ImportedDay& importedDay, Conference* conference, const QString& city);
     Day *findDayForServerDate(const QString &dayDate, Conference *conference);
-    void adjustPersons(QVariantMap &sessionMap);
-    void adjustTracks(QVariantMap &sessionMap, Conference *conference, const bool isUpdate);
-    bool checkIfIgnored(SessionAPI *sessionAPI);
-    void setDuration(SessionAPI *sessionAPI, Session* session);
+    QStringList adjustTracks(const QList<ImportedTrack>& trackList, Conference *conference, const bool isUpdate);
+    void setDuration(const int minutes, Session* session);
     void setType(Session *session);
-    void finishUpdate();
+    void finishUnmodifiedUpdate();
     void sortedSessionsIntoRoomDayTrackSpeaker();
-
-    // helper as workaround for generator bug
-    QList<Session *> listOfSessionForSortedKeys(QStringList keyList);
+    // CHANGE SET of current update
+    UpdateChangeSet mChangeSet;
+    void recordSessionChanges(Session* session, const SessionState* previousState);
+    void touchContainersOfSession(const SessionState& sessionState);
+    void addGenericSession(Session* session);
+    void removeOrphanedRoomsAndTracks();
 };
 
 #endif // DATAUTIL_H
@@ -0,0 +1,51 @@
+#include "daytimeindex.hpp"
+
+#include <algorithm>
+
+DayTimeIndex::DayTimeIndex()
+{
+}
+
+// Sessions without start time are sorted first (sortKey without time): start of day
+int DayTimeIndex::minutesOf(const QTime& time)
+{
+    if (!time.isValid()) {
+        return 0;
+    }
+    return time.hour() * 60 + time.minute();
+}
+
+void DayTimeIndex::build(const QList<Session*>& sessions)
+{
+    mStartMinutes.resize(sessions.size());
+    mMaxEndMinutes.resize(sessions.size());
+    int maxEnd = 0;
+    for (int i = 0; i < sessions.size(); ++i) {
+        Session* session = sessions.at(i);
+        const int start = minutesOf(session->startTime());
+        int end = session->endTime().isValid() ? minutesOf(session->endTime()) : start + session->minutes();
+        // ends after midnight
+        if (end < start) {
+            end += 24 * 60;
+        }
+        maxEnd = qMax(maxEnd, end);
+        mStartMinutes[i] = start;
+        mMaxEndMinutes[i] = maxEnd;
+    }
+}
+
+int DayTimeIndex::size() const
+{
+    return mStartMinutes.size();
+}
+
+int DayTimeIndex::firstStartingAt(const int minutes) const
+{
+    return std::lower_bound(mStartMinutes.constBegin(), mStartMinutes.constEnd(), minutes) - mStartMinutes.constBegin();
+}
+
+// the first running maximum > minutes belongs to the first Session ending after minutes
+int DayTimeIndex::firstEndingAfter(const int minutes) const
+{
+    return std::upper_bound(mMaxEndMinutes.constBegin(), mMaxEndMinutes.constEnd(), minutes) - mMaxEndMinutes.constBegin();
+}
@@ -0,0 +1,39 @@
+#ifndef DAYTIMEINDEX_HPP
+#define DAYTIMEINDEX_HPP
+
+#include <QVector>
+#include <QList>
+#include <QTime>
+
+#include "gen/Session.hpp"
+
+/*
+ * start and end times of the Sessions of a Day as minutes since midnight
+ * same order as Day::sessions() (sorted by start time)
+ * built when the Sessions of a Day are resolved or sorted
+ *
+ * firstStartingAt(): first Session starting at or after the time (GoTo time picker)
+ * firstEndingAfter(): first Session not finished at the time (jump to now)
+ * both are binary searches, size() if there's no such Session
+ */
+class DayTimeIndex
+{
+public:
+    DayTimeIndex();
+
+    void build(const QList<Session*>& sessions);
+
+    int size() const;
+
+    int firstStartingAt(const int minutes) const;
+    int firstEndingAfter(const int minutes) const;
+
+    static int minutesOf(const QTime& time);
+
+private:
+    QVector<int> mStartMinutes;
+    // running maximum of end times: sorted, even if a long Session ends after the next ones
+    QVector<int> mMaxEndMinutes;
+};
+
+#endif // DAYTIMEINDEX_HPP
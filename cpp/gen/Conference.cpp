@@ -1,4 +1,5 @@
 #include "Conference.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 
@@ -48,7 +49,7 @@ static const QString roomsForeignKey = "rooms";
  * Default Constructor if Conference not initialized from QVariantMap
  */
 Conference::Conference(QObject *parent) :
-        QObject(parent), mId(-1), mConferenceName(""), mConferenceCity(""), mAddress(""), mMapAddress(""), mTimeZoneName(""), mTimeZoneOffsetSeconds(0), mHashTag(""), mHomePage(""), mCoordinate(""), mPlaceId(""), mLastRoomId(0), mLastSessionTrackId(0), mLastGenericSessionId(0)
+        QObject(parent), mIsDirty(false), mId(-1), mConferenceName(""), mConferenceCity(""), mAddress(""), mMapAddress(""), mTimeZoneName(""), mTimeZoneOffsetSeconds(0), mHashTag(""), mHomePage(""), mCoordinate(""), mPlaceId(""), mLastRoomId(0), mLastSessionTrackId(0), mLastGenericSessionId(0)
 {
 	// Date, Time or Timestamp ? construct null value
 	mConferenceFrom = QDate();
@@ -129,6 +130,8 @@ void Conference::fillFromMap(const QVariantMap& conferenceMap)
 	// mRooms must be resolved later if there are keys
 	mRoomsKeysResolved = (mRoomsKeys.size() == 0);
 	mRooms.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -186,6 +189,8 @@ void Conference::fillFromForeignMap(const QVariantMap& conferenceMap)
 	// mRooms must be resolved later if there are keys
 	mRoomsKeysResolved = (mRoomsKeys.size() == 0);
 	mRooms.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -243,6 +248,7 @@ void Conference::fillFromCacheMap(const QVariantMap& conferenceMap)
 	// mRooms must be resolved later if there are keys
 	mRoomsKeysResolved = (mRoomsKeys.size() == 0);
 	mRooms.clear();
+	mIsDirty = false;
 }
 
 void Conference::prepareNew()
@@ -430,6 +436,17 @@ QVariantMap Conference::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool Conference::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Conference::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // ATT 
 // Mandatory: id
 // Domain KEY: id
@@ -442,6 +459,7 @@ void Conference::setId(int id)
 {
 	if (id != mId) {
 		mId = id;
+		mIsDirty = true;
 		emit idChanged(id);
 	}
 }
@@ -456,6 +474,7 @@ void Conference::setConferenceName(QString conferenceName)
 {
 	if (conferenceName != mConferenceName) {
 		mConferenceName = conferenceName;
+		mIsDirty = true;
 		emit conferenceNameChanged(conferenceName);
 	}
 }
@@ -470,6 +489,7 @@ void Conference::setConferenceCity(QString conferenceCity)
 {
 	if (conferenceCity != mConferenceCity) {
 		mConferenceCity = conferenceCity;
+		mIsDirty = true;
 		emit conferenceCityChanged(conferenceCity);
 	}
 }
@@ -484,6 +504,7 @@ void Conference::setAddress(QString address)
 {
 	if (address != mAddress) {
 		mAddress = address;
+		mIsDirty = true;
 		emit addressChanged(address);
 	}
 }
@@ -498,6 +519,7 @@ void Conference::setMapAddress(QString mapAddress)
 {
 	if (mapAddress != mMapAddress) {
 		mMapAddress = mapAddress;
+		mIsDirty = true;
 		emit mapAddressChanged(mapAddress);
 	}
 }
@@ -512,6 +534,7 @@ void Conference::setTimeZoneName(QString timeZoneName)
 {
 	if (timeZoneName != mTimeZoneName) {
 		mTimeZoneName = timeZoneName;
+		mIsDirty = true;
 		emit timeZoneNameChanged(timeZoneName);
 	}
 }
@@ -526,6 +549,7 @@ void Conference::setTimeZoneOffsetSeconds(int timeZoneOffsetSeconds)
 {
 	if (timeZoneOffsetSeconds != mTimeZoneOffsetSeconds) {
 		mTimeZoneOffsetSeconds = timeZoneOffsetSeconds;
+		mIsDirty = true;
 		emit timeZoneOffsetSecondsChanged(timeZoneOffsetSeconds);
 	}
 }
@@ -548,6 +572,7 @@ void Conference::setConferenceFrom(QDate conferenceFrom)
 {
 	if (conferenceFrom != mConferenceFrom) {
 		mConferenceFrom = conferenceFrom;
+		mIsDirty = true;
 		emit conferenceFromChanged(conferenceFrom);
 	}
 }
@@ -574,6 +599,7 @@ void Conference::setConferenceTo(QDate conferenceTo)
 {
 	if (conferenceTo != mConferenceTo) {
 		mConferenceTo = conferenceTo;
+		mIsDirty = true;
 		emit conferenceToChanged(conferenceTo);
 	}
 }
@@ -592,6 +618,7 @@ void Conference::setHashTag(QString hashTag)
 {
 	if (hashTag != mHashTag) {
 		mHashTag = hashTag;
+		mIsDirty = true;
 		emit hashTagChanged(hashTag);
 	}
 }
@@ -606,6 +633,7 @@ void Conference::setHomePage(QString homePage)
 {
 	if (homePage != mHomePage) {
 		mHomePage = homePage;
+		mIsDirty = true;
 		emit homePageChanged(homePage);
 	}
 }
@@ -620,6 +648,7 @@ void Conference::setCoordinate(QString coordinate)
 {
 	if (coordinate != mCoordinate) {
 		mCoordinate = coordinate;
+		mIsDirty = true;
 		emit coordinateChanged(coordinate);
 	}
 }
@@ -634,6 +663,7 @@ void Conference::setPlaceId(QString placeId)
 {
 	if (placeId != mPlaceId) {
 		mPlaceId = placeId;
+		mIsDirty = true;
 		emit placeIdChanged(placeId);
 	}
 }
@@ -648,6 +678,7 @@ void Conference::setLastRoomId(int lastRoomId)
 {
 	if (lastRoomId != mLastRoomId) {
 		mLastRoomId = lastRoomId;
+		mIsDirty = true;
 		emit lastRoomIdChanged(lastRoomId);
 	}
 }
@@ -662,6 +693,7 @@ void Conference::setLastSessionTrackId(int lastSessionTrackId)
 {
 	if (lastSessionTrackId != mLastSessionTrackId) {
 		mLastSessionTrackId = lastSessionTrackId;
+		mIsDirty = true;
 		emit lastSessionTrackIdChanged(lastSessionTrackId);
 	}
 }
@@ -676,6 +708,7 @@ void Conference::setLastGenericSessionId(int lastGenericSessionId)
 {
 	if (lastGenericSessionId != mLastGenericSessionId) {
 		mLastGenericSessionId = lastGenericSessionId;
+		mIsDirty = true;
 		emit lastGenericSessionIdChanged(lastGenericSessionId);
 	}
 }
@@ -715,6 +748,7 @@ QVariantList Conference::daysAsForeignQVariantList()
 void Conference::addToDays(Day* day)
 {
     mDays.append(day);
+    mIsDirty = true;
     emit addedToDays(day);
     emit daysPropertyListChanged();
 }
@@ -727,6 +761,7 @@ bool Conference::removeFromDays(Day* day)
     	qDebug() << "Day* not found in days";
     	return false;
     }
+    mIsDirty = true;
     emit daysPropertyListChanged();
     // days are independent - DON'T delete them
     return true;
@@ -737,6 +772,7 @@ void Conference::clearDays()
         removeFromDays(mDays.last());
     }
     mDaysKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -769,9 +805,12 @@ void Conference::resolveDaysKeys(QList<Day*> days)
         return;
     }
     // don't clear mDays (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < days.size(); ++i) {
         addToDays(days.at(i));
     }
+    mIsDirty = wasDirty;
     mDaysKeysResolved = true;
 }
 
@@ -787,6 +826,7 @@ void Conference::setDays(QList<Day*> days)
 {
 	if (days != mDays) {
 		mDays = days;
+		mIsDirty = true;
 		emit daysChanged(days);
 		emit daysPropertyListChanged();
 	}
@@ -814,6 +854,7 @@ void Conference::appendToDaysProperty(QQmlListProperty<Day> *daysList,
     Conference *conferenceObject = qobject_cast<Conference *>(daysList->object);
     if (conferenceObject) {
         conferenceObject->mDays.append(day);
+        conferenceObject->mIsDirty = true;
         emit conferenceObject->addedToDays(day);
     } else {
         qWarning() << "cannot append Day* to days " << "Object is not of type Conference*";
@@ -849,6 +890,7 @@ void Conference::clearDaysProperty(QQmlListProperty<Day> *daysList)
     if (conference) {
         // days are independent - DON'T delete them
         conference->mDays.clear();
+        conference->mIsDirty = true;
     } else {
         qWarning() << "cannot clear days " << "Object is not of type Conference*";
     }
@@ -890,6 +932,7 @@ QVariantList Conference::tracksAsForeignQVariantList()
 void Conference::addToTracks(SessionTrack* sessionTrack)
 {
     mTracks.append(sessionTrack);
+    mIsDirty = true;
     emit addedToTracks(sessionTrack);
     emit tracksPropertyListChanged();
 }
@@ -902,6 +945,7 @@ bool Conference::removeFromTracks(SessionTrack* sessionTrack)
     	qDebug() << "SessionTrack* not found in tracks";
     	return false;
     }
+    mIsDirty = true;
     emit tracksPropertyListChanged();
     // tracks are independent - DON'T delete them
     return true;
@@ -912,6 +956,7 @@ void Conference::clearTracks()
         removeFromTracks(mTracks.last());
     }
     mTracksKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -944,9 +989,12 @@ void Conference::resolveTracksKeys(QList<SessionTrack*> tracks)
         return;
     }
     // don't clear mTracks (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < tracks.size(); ++i) {
         addToTracks(tracks.at(i));
     }
+    mIsDirty = wasDirty;
     mTracksKeysResolved = true;
 }
 
@@ -962,6 +1010,7 @@ void Conference::setTracks(QList<SessionTrack*> tracks)
 {
 	if (tracks != mTracks) {
 		mTracks = tracks;
+		mIsDirty = true;
 		emit tracksChanged(tracks);
 		emit tracksPropertyListChanged();
 	}
@@ -989,6 +1038,7 @@ void Conference::appendToTracksProperty(QQmlListProperty<SessionTrack> *tracksLi
     Conference *conferenceObject = qobject_cast<Conference *>(tracksList->object);
     if (conferenceObject) {
         conferenceObject->mTracks.append(sessionTrack);
+        conferenceObject->mIsDirty = true;
         emit conferenceObject->addedToTracks(sessionTrack);
     } else {
         qWarning() << "cannot append SessionTrack* to tracks " << "Object is not of type Conference*";
@@ -1024,6 +1074,7 @@ void Conference::clearTracksProperty(QQmlListProperty<SessionTrack> *tracksList)
     if (conference) {
         // tracks are independent - DON'T delete them
         conference->mTracks.clear();
+        conference->mIsDirty = true;
     } else {
         qWarning() << "cannot clear tracks " << "Object is not of type Conference*";
     }
@@ -1065,6 +1116,7 @@ QVariantList Conference::roomsAsForeignQVariantList()
 void Conference::addToRooms(Room* room)
 {
     mRooms.append(room);
+    mIsDirty = true;
     emit addedToRooms(room);
     emit roomsPropertyListChanged();
 }
@@ -1077,6 +1129,7 @@ bool Conference::removeFromRooms(Room* room)
     	qDebug() << "Room* not found in rooms";
     	return false;
     }
+    mIsDirty = true;
     emit roomsPropertyListChanged();
     // rooms are independent - DON'T delete them
     return true;
@@ -1087,6 +1140,7 @@ void Conference::clearRooms()
         removeFromRooms(mRooms.last());
     }
     mRoomsKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -1119,9 +1173,12 @@ void Conference::resolveRoomsKeys(QList<Room*> rooms)
         return;
     }
     // don't clear mRooms (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < rooms.size(); ++i) {
         addToRooms(rooms.at(i));
     }
+    mIsDirty = wasDirty;
     mRoomsKeysResolved = true;
 }
 
@@ -1137,6 +1194,7 @@ void Conference::setRooms(QList<Room*> rooms)
 {
 	if (rooms != mRooms) {
 		mRooms = rooms;
+		mIsDirty = true;
 		emit roomsChanged(rooms);
 		emit roomsPropertyListChanged();
 	}
@@ -1164,6 +1222,7 @@ void Conference::appendToRoomsProperty(QQmlListProperty<Room> *roomsList,
     Conference *conferenceObject = qobject_cast<Conference *>(roomsList->object);
     if (conferenceObject) {
         conferenceObject->mRooms.append(room);
+        conferenceObject->mIsDirty = true;
         emit conferenceObject->addedToRooms(room);
     } else {
         qWarning() << "cannot append Room* to rooms " << "Object is not of type Conference*";
@@ -1199,6 +1258,7 @@ void Conference::clearRoomsProperty(QQmlListProperty<Room> *roomsList)
     if (conference) {
         // rooms are independent - DON'T delete them
         conference->mRooms.clear();
+        conference->mIsDirty = true;
     } else {
         qWarning() << "cannot clear rooms " << "Object is not of type Conference*";
     }
@@ -5,6 +5,9 @@
 #include <QtQml>
 #include <QJsonObject>
 #include <QFile>
+#include <QSet>
+
+#include "../startupprofiler.hpp"
 
 
 static const QString PRODUCTION_ENVIRONMENT = "prod/";
@@ -27,9 +30,16 @@ static const QString cachePersonsAPI = "cachePersonsAPI.json";
 static const QString cacheSessionTrackAPI = "cacheSessionTrackAPI.json";
 static const QString cacheSpeakerAPI = "cacheSpeakerAPI.json";
 
+// binary snapshots of the JSON caches: cacheXYZ.json -> cacheXYZ.snapshot
+// (read and written by cpp/datamanagersnapshot.cpp)
+static const QString SNAPSHOT_SUFFIX = ".snapshot";
+// Room, Session, SessionTrack, Day not assigned to a Conference (per ex. dummy Room)
+static const int SHARED_PARTITION = 0;
+
 
 DataManager::DataManager(QObject *parent) :
-        QObject(parent)
+        QObject(parent), mConferenceCacheDirty(false), mFavoriteCacheDirty(false),
+        mSpeakerCacheDirty(false), mSpeakerImageCacheDirty(false)
 {
    // Android: HomeLocation works, iOS: not writable
     // Android: AppDataLocation works out of the box, iOS you must create the DIR first !!
@@ -76,6 +86,12 @@ DataManager::DataManager(QObject *parent) :
 #endif
     // now set the compact or indent mode for JSON Documents
     mCompactJson = mSettingsData->useCompactJsonFormat();
+    // CBOR or JSON for cache files - reading detects the format
+    if (mSettingsData->useCborCache()) {
+        mCacheFormat = CacheFormat::Cbor;
+    } else {
+        mCacheFormat = mCompactJson ? CacheFormat::JsonCompact : CacheFormat::JsonIndented;
+    }
 	isProductionEnvironment = mSettingsData->isProductionEnvironment();
 
     // ApplicationUI is parent of DataManager
@@ -126,6 +142,10 @@ QString DataManager::dataPath(const QString& fileName)
 {
     return mDataPath + (isProductionEnvironment?PRODUCTION_ENVIRONMENT:TEST_ENVIRONMENT) + fileName;
 }
+QString DataManager::snapshotPath(const QString& fileName)
+{
+    return dataPath(fileName.left(fileName.lastIndexOf(".")) + SNAPSHOT_SUFFIX);
+}
 
 bool DataManager::checkDirs()
 {
@@ -180,17 +200,16 @@ bool DataManager::checkDirs()
  */
 void DataManager::init()
 {
+    StartupPhase phase(QStringLiteral("init"));
     // get all from cache
 
     initConferenceFromCache();
-    initRoomFromCache();
-    initSessionFromCache();
+    // Room, Session, SessionTrack, Day: only current Conference
+    initConferencePartitions();
     initFavoriteFromCache();
     // SessionLists is transient - not automatically read from cache
     initSpeakerFromCache();
     initSpeakerImageFromCache();
-    initSessionTrackFromCache();
-    initDayFromCache();
     // SessionAPI is transient - not automatically read from cache
     // PersonsAPI is transient - not automatically read from cache
     // SessionTrackAPI is transient - not automatically read from cache
@@ -199,8 +218,202 @@ void DataManager::init()
 
 
 
+/*
+ * Room, Session, SessionTrack and Day are cached per Conference
+ * (cacheSession_201801.json, ...)
+ * at startup only the shared partition and the current Conference are loaded
+ * current Conference is the last one - same as DataUtil::currentConference()
+ * other Conferences are loaded on demand: loadConference()
+ */
+void DataManager::initConferencePartitions()
+{
+    StartupPhase phase(QStringLiteral("initConferencePartitions"));
+    mLoadedConferences.clear();
+    mAllRoom.clear();
+    mAllSession.clear();
+    mAllSessionTrack.clear();
+    mAllDay.clear();
+    mRoomDirtyPartitions.clear();
+    mRoomPartitionByRoomId.clear();
+    mSessionDirtyPartitions.clear();
+    mSessionPartitionBySessionId.clear();
+    mSessionTrackDirtyPartitions.clear();
+    mSessionTrackPartitionByTrackId.clear();
+    mDayDirtyPartitions.clear();
+    mDayPartitionById.clear();
+    if (migrateToConferencePartitions()) {
+        return;
+    }
+    loadConference(SHARED_PARTITION);
+    if (!mAllConference.isEmpty()) {
+        loadConference(((Conference*)mAllConference.last())->id());
+    }
+}
+
+/*
+ * former cache files contained all Conferences:
+ * read them once, write the partitions and remove them
+ * returns false if there's nothing to migrate
+ */
+bool DataManager::migrateToConferencePartitions()
+{
+    const QStringList formerCaches = QStringList() << cacheRoom << cacheSession << cacheSessionTrack << cacheDay;
+    bool formerCacheFound = false;
+    for (int i = 0; i < formerCaches.size() && !formerCacheFound; ++i) {
+        formerCacheFound = QFile::exists(dataPath(formerCaches.at(i)));
+    }
+    if (!formerCacheFound) {
+        return false;
+    }
+    qDebug() << "migrate Room, Session, SessionTrack, Day caches to Conference partitions";
+    initRoomFromCache();
+    initSessionFromCache();
+    initSessionTrackFromCache();
+    initDayFromCache();
+    mLoadedConferences.insert(SHARED_PARTITION);
+    for (int i = 0; i < mAllConference.size(); ++i) {
+        mLoadedConferences.insert(((Conference*)mAllConference.at(i))->id());
+    }
+    mRoomDirtyPartitions.unite(mLoadedConferences);
+    mSessionDirtyPartitions.unite(mLoadedConferences);
+    mSessionTrackDirtyPartitions.unite(mLoadedConferences);
+    mDayDirtyPartitions.unite(mLoadedConferences);
+    saveRoomToCache();
+    saveSessionToCache();
+    saveSessionTrackToCache();
+    saveDayToCache();
+    for (int i = 0; i < formerCaches.size(); ++i) {
+        QFile::remove(dataPath(formerCaches.at(i)));
+        QFile::remove(snapshotPath(formerCaches.at(i)));
+    }
+    return true;
+}
+
+bool DataManager::isConferenceLoaded(const int conferenceId)
+{
+    return mLoadedConferences.contains(conferenceId);
+}
+
+/*
+ * adds Room, Session, SessionTrack and Day of this Conference
+ * Days, Rooms, Tracks of the Conference must be resolved by caller
+ */
+void DataManager::loadConference(const int conferenceId)
+{
+    if (mLoadedConferences.contains(conferenceId)) {
+        return;
+    }
+    StartupPhase phase(QStringLiteral("loadConference ") + QString::number(conferenceId));
+    qDebug() << "load Conference partition" << conferenceId;
+    mLoadedConferences.insert(conferenceId);
+    const int sessionsBefore = mAllSession.size();
+    initRoomPartitionFromCache(conferenceId);
+    initSessionPartitionFromCache(conferenceId);
+    initSessionTrackPartitionFromCache(conferenceId);
+    initDayPartitionFromCache(conferenceId);
+    resolveSpeakerSessionsAgain(mAllSession.mid(sessionsBefore));
+}
+
+// cacheSession.json --> cacheSession_201801.json
+QString DataManager::partitionFileName(const QString& fileName, const int conferenceId)
+{
+    const int suffixPos = fileName.lastIndexOf(".");
+    return fileName.left(suffixPos) + "_" + QString::number(conferenceId) + fileName.mid(suffixPos);
+}
+
+// unknown Conference: shared partition
+int DataManager::partitionOf(const int conferenceId)
+{
+    if (conferenceId != SHARED_PARTITION && findConferenceById(conferenceId)) {
+        return conferenceId;
+    }
+    return SHARED_PARTITION;
+}
+
+// Sessions from server without Conference: Conference of the Day
+int DataManager::partitionOfSession(Session* session)
+{
+    if (session->conference() == SHARED_PARTITION && session->hasSessionDay()) {
+        Day* day = findDayById(session->sessionDay());
+        if (day) {
+            return partitionOf(day->conference());
+        }
+    }
+    return partitionOf(session->conference());
+}
+
+/*
+ * partitions to be written by save*ToCache():
+ * the current one and the one read from or written to
+ * (differ if the Conference or Day was changed)
+ */
+void DataManager::markRoomPartitionDirty(Room* room)
+{
+    mRoomDirtyPartitions.insert(partitionOf(room->conference()));
+    QHash<int, int>::const_iterator written = mRoomPartitionByRoomId.constFind(room->roomId());
+    if (written != mRoomPartitionByRoomId.constEnd()) {
+        mRoomDirtyPartitions.insert(written.value());
+    }
+}
+
+void DataManager::markSessionPartitionDirty(Session* session)
+{
+    mSessionDirtyPartitions.insert(partitionOfSession(session));
+    QHash<int, int>::const_iterator written = mSessionPartitionBySessionId.constFind(session->sessionId());
+    if (written != mSessionPartitionBySessionId.constEnd()) {
+        mSessionDirtyPartitions.insert(written.value());
+    }
+}
+
+void DataManager::markSessionTrackPartitionDirty(SessionTrack* sessionTrack)
+{
+    mSessionTrackDirtyPartitions.insert(partitionOf(sessionTrack->conference()));
+    QHash<int, int>::const_iterator written = mSessionTrackPartitionByTrackId.constFind(sessionTrack->trackId());
+    if (written != mSessionTrackPartitionByTrackId.constEnd()) {
+        mSessionTrackDirtyPartitions.insert(written.value());
+    }
+}
+
+void DataManager::markDayPartitionDirty(Day* day)
+{
+    mDayDirtyPartitions.insert(partitionOf(day->conference()));
+    QHash<int, int>::const_iterator written = mDayPartitionById.constFind(day->id());
+    if (written != mDayPartitionById.constEnd()) {
+        mDayDirtyPartitions.insert(written.value());
+    }
+}
+
+// Speaker can have Sessions from all Conferences:
+// only resolved Speaker with Sessions of the loaded partition are resolved again
+void DataManager::resolveSpeakerSessionsAgain(const QList<QObject*>& loadedSessions)
+{
+    if (loadedSessions.isEmpty()) {
+        return;
+    }
+    QSet<QString> loadedKeys;
+    loadedKeys.reserve(loadedSessions.size());
+    for (int i = 0; i < loadedSessions.size(); ++i) {
+        loadedKeys.insert(QString::number(((Session*)loadedSessions.at(i))->sessionId()));
+    }
+    for (int i = 0; i < mAllSpeaker.size(); ++i) {
+        Speaker* speaker = (Speaker*)mAllSpeaker.at(i);
+        if (!speaker->areSessionsKeysResolved()) {
+            continue;
+        }
+        const QStringList sessionsKeys = speaker->sessionsKeys();
+        for (int k = 0; k < sessionsKeys.size(); ++k) {
+            if (loadedKeys.contains(sessionsKeys.at(k))) {
+                speaker->markSessionsKeysUnresolved();
+                speaker->resolveSessionsKeys(listOfSessionForKeys(speaker->sessionsKeys()));
+                break;
+            }
+        }
+    }
+}
+
 void DataManager::finish()
 {
+    // only changed caches are written
     saveSettings();
     // Conference is read-only - not saved to cache
     // Room is read-only - not saved to cache
@@ -258,52 +471,59 @@ void DataManager::undoCreateSettingsData(SettingsData* settingsData)
 
 /*
  * reads Maps of Conference in from JSON cache
- * creates List of Conference*  from QVariantList
+ * creates List of Conference*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
  */
 void DataManager::initConferenceFromCache()
 {
+    StartupPhase phase(QStringLiteral("initConferenceFromCache"));
 	qDebug() << "start initConferenceFromCache";
     mAllConference.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheConference);
-    qDebug() << "read Conference from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Conference* conference = new Conference();
-        // Important: DataManager must be parent of all root DTOs
-        conference->setParent(this);
-        conference->fillFromCacheMap(cacheMap);
-        mAllConference.append(conference);
+    mConferenceCacheDirty = false;
+    if (initConferenceFromSnapshot(cacheConference)) {
+        rebuildConferenceIndex();
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Conference>(readCacheData(cacheConference), this, mAllConference)) {
+        qWarning() << "Couldn't read Conference from cache" << cacheConference;
     }
     qDebug() << "created Conference* #" << mAllConference.size();
+    rebuildConferenceIndex();
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    saveConferenceToSnapshot(cacheConference, mAllConference);
 }
 
 
 /*
  * save List of Conference* to JSON cache
- * convert list of Conference* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Conference* to QJsonArray
+ * toCacheJson stores all properties without transient values
  * Conference is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveConferenceToCache()
 {
-    QVariantList cacheList;
+    bool dirty = mConferenceCacheDirty;
+    for (int i = 0; !dirty && i < mAllConference.size(); ++i) {
+        dirty = ((Conference*)mAllConference.at(i))->isDirty();
+    }
+    if (!dirty) {
+        qDebug() << "Conference* unchanged - cache not written";
+        return;
+    }
     qDebug() << "now caching Conference* #" << mAllConference.size();
+    // JSON or CBOR as selected in SettingsData
+    writeCacheData(cacheConference, CacheFormat::encodeObjects<Conference>(mAllConference, mCacheFormat));
     for (int i = 0; i < mAllConference.size(); ++i) {
         Conference* conference;
         conference = (Conference*)mAllConference.at(i);
-        QVariantMap cacheMap;
-        cacheMap = conference->toCacheMap();
-        cacheList.append(cacheMap);
+        conference->markAsClean();
     }
-    qDebug() << "Conference* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheConference, cacheList);
+    saveConferenceToSnapshot(cacheConference, mAllConference);
+    mConferenceCacheDirty = false;
 }
 
-
-
 /**
 * converts a list of keys in to a list of DataObjects
 * per ex. used to resolve lazy arrays
@@ -312,25 +532,33 @@ QList<Conference*> DataManager::listOfConferenceForKeys(
         QStringList keyList)
 {
     QList<Conference*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllConference.size(); ++i) {
-        Conference* conference;
-        conference = (Conference*) mAllConference.at(i);
-        if (keyList.contains(QString::number(conference->id()))) {
-            listOfData.append(conference);
-            keyList.removeOne(QString::number(conference->id()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int id = keyList.at(i).toInt(&ok);
+        Conference* conference = ok ? mConferenceById.value(id, 0) : 0;
+        if (!conference) {
+            missingKeys.append(keyList.at(i));
+            continue;
+        }
+        if (resolvedKeys.contains(id)) {
+            continue;
         }
+        resolvedKeys.insert(id);
+        listOfData.append(conference);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Conference: " << keyList.join(", ");
+    qWarning() << "not all keys found for Conference: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -365,6 +593,8 @@ void DataManager::appendToConferenceProperty(
     if (dataManagerObject) {
         conference->setParent(dataManagerObject);
         dataManagerObject->mAllConference.append(conference);
+        dataManagerObject->mConferenceById.insert(conference->id(), conference);
+        dataManagerObject->mConferenceCacheDirty = true;
         emit dataManagerObject->addedToAllConference(conference);
     } else {
         qWarning() << "cannot append Conference* to mAllConference "
@@ -412,6 +642,8 @@ void DataManager::clearConferenceProperty(
             conference = 0;
         }
         dataManager->mAllConference.clear();
+        dataManager->mConferenceById.clear();
+        dataManager->mConferenceCacheDirty = true;
     } else {
         qWarning() << "cannot clear mAllConference " << "Object is not of type DataManager*";
     }
@@ -433,6 +665,8 @@ void DataManager::deleteConference()
         conference = 0;
      }
      mAllConference.clear();
+     mConferenceById.clear();
+     mConferenceCacheDirty = true;
 }
 
 /**
@@ -470,6 +704,8 @@ void DataManager::insertConference(Conference* conference)
     // Important: DataManager must be parent of all root DTOs
     conference->setParent(this);
     mAllConference.append(conference);
+    mConferenceById.insert(conference->id(), conference);
+    mConferenceCacheDirty = true;
     emit addedToAllConference(conference);
     emit conferencePropertyListChanged();
 }
@@ -485,6 +721,8 @@ void DataManager::insertConferenceFromMap(const QVariantMap& conferenceMap,
         conference->fillFromMap(conferenceMap);
     }
     mAllConference.append(conference);
+    mConferenceById.insert(conference->id(), conference);
+    mConferenceCacheDirty = true;
     emit addedToAllConference(conference);
     conferencePropertyListChanged();
 }
@@ -496,6 +734,10 @@ bool DataManager::deleteConference(Conference* conference)
     if (!ok) {
         return ok;
     }
+    mConferenceCacheDirty = true;
+    if (mConferenceById.value(conference->id()) == conference) {
+        mConferenceById.remove(conference->id());
+    }
     emit deletedFromAllConferenceById(conference->id());
     emit deletedFromAllConference(conference);
     emit conferencePropertyListChanged();
@@ -507,11 +749,16 @@ bool DataManager::deleteConference(Conference* conference)
 
 bool DataManager::deleteConferenceById(const int& id)
 {
+    if (!mConferenceById.contains(id)) {
+        return false;
+    }
     for (int i = 0; i < mAllConference.size(); ++i) {
         Conference* conference;
         conference = (Conference*) mAllConference.at(i);
         if (conference->id() == id) {
             mAllConference.removeAt(i);
+            mConferenceById.remove(id);
+            mConferenceCacheDirty = true;
             emit deletedFromAllConferenceById(id);
             emit deletedFromAllConference(conference);
             emit conferencePropertyListChanged();
@@ -526,65 +773,138 @@ bool DataManager::deleteConferenceById(const int& id)
 
 // nr is DomainKey
 Conference* DataManager::findConferenceById(const int& id){
+    Conference* conference = mConferenceById.value(id, 0);
+    if (!conference) {
+        qDebug() << "no Conference found for id " << id;
+    }
+    return conference;
+}
+
+/*
+ * rebuilds the hash index used by findConferenceById
+ * from current List of Conference*
+ */
+void DataManager::rebuildConferenceIndex()
+{
+    mConferenceById.clear();
+    mConferenceById.reserve(mAllConference.size());
     for (int i = 0; i < mAllConference.size(); ++i) {
         Conference* conference;
         conference = (Conference*)mAllConference.at(i);
-        if(conference->id() == id){
-            return conference;
-        }
+        mConferenceById.insert(conference->id(), conference);
     }
-    qDebug() << "no Conference found for id " << id;
-    return 0;
 }
 
 /*
  * reads Maps of Room in from JSON cache
- * creates List of Room*  from QVariantList
+ * creates List of Room*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
+ * Room is cached per Conference (cacheRoom_<conferenceId>.json):
+ * this reads the former cache file of all Conferences (migration)
  */
 void DataManager::initRoomFromCache()
 {
+    StartupPhase phase(QStringLiteral("initRoomFromCache"));
 	qDebug() << "start initRoomFromCache";
     mAllRoom.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheRoom);
-    qDebug() << "read Room from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Room* room = new Room();
-        // Important: DataManager must be parent of all root DTOs
-        room->setParent(this);
-        room->fillFromCacheMap(cacheMap);
-        mAllRoom.append(room);
+    mRoomDirtyPartitions.clear();
+    mRoomPartitionByRoomId.clear();
+    appendRoomFromCache(cacheRoom);
+    rebuildRoomIndex();
+}
+
+/*
+ * reads Room of one Conference (cacheRoom_<conferenceId>.json)
+ * and adds them to the Room* already loaded
+ */
+void DataManager::initRoomPartitionFromCache(const int conferenceId)
+{
+    StartupPhase phase(QStringLiteral("initRoomPartitionFromCache"));
+    const int loadedBefore = mAllRoom.size();
+    appendRoomFromCache(partitionFileName(cacheRoom, conferenceId));
+    for (int i = loadedBefore; i < mAllRoom.size(); ++i) {
+        mRoomPartitionByRoomId.insert(((Room*)mAllRoom.at(i))->roomId(), conferenceId);
+    }
+    rebuildRoomIndex();
+}
+
+/*
+ * appends Room* from binary snapshot or JSON cache file
+ */
+void DataManager::appendRoomFromCache(const QString& fileName)
+{
+    const int loadedBefore = mAllRoom.size();
+    if (initRoomFromSnapshot(fileName)) {
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Room>(readCacheData(fileName), this, mAllRoom)) {
+        qWarning() << "Couldn't read Room from cache" << fileName;
+    }
+    qDebug() << "created Room* #" << mAllRoom.size() - loadedBefore;
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    if (mAllRoom.size() > loadedBefore) {
+        saveRoomToSnapshot(fileName, mAllRoom.mid(loadedBefore));
     }
-    qDebug() << "created Room* #" << mAllRoom.size();
 }
 
 
 /*
  * save List of Room* to JSON cache
- * convert list of Room* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Room* to QJsonArray
+ * one cache file per Conference: cacheRoom_<conferenceId>.json
+ * only partitions with inserted, deleted or changed objects are written
+ * toCacheJson stores all properties without transient values
  * Room is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveRoomToCache()
 {
-    QVariantList cacheList;
-    qDebug() << "now caching Room* #" << mAllRoom.size();
     for (int i = 0; i < mAllRoom.size(); ++i) {
         Room* room;
         room = (Room*)mAllRoom.at(i);
-        QVariantMap cacheMap;
-        cacheMap = room->toCacheMap();
-        cacheList.append(cacheMap);
+        if (room->isDirty()) {
+            markRoomPartitionDirty(room);
+        }
+    }
+    if (mRoomDirtyPartitions.isEmpty()) {
+        qDebug() << "Room* unchanged - cache not written";
+        return;
+    }
+    // only changed partitions are written, without Room* they get an empty cache file
+    QMap<int, QList<QObject*> > partitions;
+    QSetIterator<int> dirtyIterator(mRoomDirtyPartitions);
+    while (dirtyIterator.hasNext()) {
+        partitions.insert(dirtyIterator.next(), QList<QObject*>());
+    }
+    for (int i = 0; i < mAllRoom.size(); ++i) {
+        Room* room;
+        room = (Room*)mAllRoom.at(i);
+        QMap<int, QList<QObject*> >::iterator partition = partitions.find(partitionOf(room->conference()));
+        if (partition != partitions.end()) {
+            partition.value().append(room);
+        }
+    }
+    qDebug() << "now caching Room* Conferences #" << partitions.size() << "of" << mLoadedConferences.size();
+    QMapIterator<int, QList<QObject*> > partitionIterator(partitions);
+    while (partitionIterator.hasNext()) {
+        partitionIterator.next();
+        const QString fileName = partitionFileName(cacheRoom, partitionIterator.key());
+        const QList<QObject*>& partition = partitionIterator.value();
+        // JSON or CBOR as selected in SettingsData
+        writeCacheData(fileName, CacheFormat::encodeObjects<Room>(partition, mCacheFormat));
+        for (int i = 0; i < partition.size(); ++i) {
+            Room* room;
+            room = (Room*)partition.at(i);
+            room->markAsClean();
+            mRoomPartitionByRoomId.insert(room->roomId(), partitionIterator.key());
+        }
+        saveRoomToSnapshot(fileName, partition);
+        mLoadedConferences.insert(partitionIterator.key());
     }
-    qDebug() << "Room* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheRoom, cacheList);
+    mRoomDirtyPartitions.clear();
 }
 
-
-
 /**
 * converts a list of keys in to a list of DataObjects
 * per ex. used to resolve lazy arrays
@@ -593,25 +913,33 @@ QList<Room*> DataManager::listOfRoomForKeys(
         QStringList keyList)
 {
     QList<Room*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllRoom.size(); ++i) {
-        Room* room;
-        room = (Room*) mAllRoom.at(i);
-        if (keyList.contains(QString::number(room->roomId()))) {
-            listOfData.append(room);
-            keyList.removeOne(QString::number(room->roomId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int roomId = keyList.at(i).toInt(&ok);
+        Room* room = ok ? mRoomByRoomId.value(roomId, 0) : 0;
+        if (!room) {
+            missingKeys.append(keyList.at(i));
+            continue;
+        }
+        if (resolvedKeys.contains(roomId)) {
+            continue;
         }
+        resolvedKeys.insert(roomId);
+        listOfData.append(room);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Room: " << keyList.join(", ");
+    qWarning() << "not all keys found for Room: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -646,6 +974,8 @@ void DataManager::appendToRoomProperty(
     if (dataManagerObject) {
         room->setParent(dataManagerObject);
         dataManagerObject->mAllRoom.append(room);
+        dataManagerObject->mRoomByRoomId.insert(room->roomId(), room);
+        dataManagerObject->markRoomPartitionDirty(room);
         emit dataManagerObject->addedToAllRoom(room);
     } else {
         qWarning() << "cannot append Room* to mAllRoom "
@@ -693,6 +1023,8 @@ void DataManager::clearRoomProperty(
             room = 0;
         }
         dataManager->mAllRoom.clear();
+        dataManager->mRoomByRoomId.clear();
+        dataManager->mRoomDirtyPartitions.unite(dataManager->mLoadedConferences);
     } else {
         qWarning() << "cannot clear mAllRoom " << "Object is not of type DataManager*";
     }
@@ -714,6 +1046,8 @@ void DataManager::deleteRoom()
         room = 0;
      }
      mAllRoom.clear();
+     mRoomByRoomId.clear();
+     mRoomDirtyPartitions.unite(mLoadedConferences);
 }
 
 /**
@@ -751,6 +1085,8 @@ void DataManager::insertRoom(Room* room)
     // Important: DataManager must be parent of all root DTOs
     room->setParent(this);
     mAllRoom.append(room);
+    mRoomByRoomId.insert(room->roomId(), room);
+    markRoomPartitionDirty(room);
     emit addedToAllRoom(room);
     emit roomPropertyListChanged();
 }
@@ -766,6 +1102,8 @@ void DataManager::insertRoomFromMap(const QVariantMap& roomMap,
         room->fillFromMap(roomMap);
     }
     mAllRoom.append(room);
+    mRoomByRoomId.insert(room->roomId(), room);
+    markRoomPartitionDirty(room);
     emit addedToAllRoom(room);
     roomPropertyListChanged();
 }
@@ -777,6 +1115,10 @@ bool DataManager::deleteRoom(Room* room)
     if (!ok) {
         return ok;
     }
+    markRoomPartitionDirty(room);
+    if (mRoomByRoomId.value(room->roomId()) == room) {
+        mRoomByRoomId.remove(room->roomId());
+    }
     emit deletedFromAllRoomByRoomId(room->roomId());
     emit deletedFromAllRoom(room);
     emit roomPropertyListChanged();
@@ -788,11 +1130,16 @@ bool DataManager::deleteRoom(Room* room)
 
 bool DataManager::deleteRoomByRoomId(const int& roomId)
 {
+    if (!mRoomByRoomId.contains(roomId)) {
+        return false;
+    }
     for (int i = 0; i < mAllRoom.size(); ++i) {
         Room* room;
         room = (Room*) mAllRoom.at(i);
         if (room->roomId() == roomId) {
             mAllRoom.removeAt(i);
+            mRoomByRoomId.remove(roomId);
+            markRoomPartitionDirty(room);
             emit deletedFromAllRoomByRoomId(roomId);
             emit deletedFromAllRoom(room);
             emit roomPropertyListChanged();
@@ -807,64 +1154,138 @@ bool DataManager::deleteRoomByRoomId(const int& roomId)
 
 // nr is DomainKey
 Room* DataManager::findRoomByRoomId(const int& roomId){
+    Room* room = mRoomByRoomId.value(roomId, 0);
+    if (!room) {
+        qDebug() << "no Room found for roomId " << roomId;
+    }
+    return room;
+}
+
+/*
+ * rebuilds the hash index used by findRoomByRoomId
+ * from current List of Room*
+ */
+void DataManager::rebuildRoomIndex()
+{
+    mRoomByRoomId.clear();
+    mRoomByRoomId.reserve(mAllRoom.size());
     for (int i = 0; i < mAllRoom.size(); ++i) {
         Room* room;
         room = (Room*)mAllRoom.at(i);
-        if(room->roomId() == roomId){
-            return room;
-        }
+        mRoomByRoomId.insert(room->roomId(), room);
     }
-    qDebug() << "no Room found for roomId " << roomId;
-    return 0;
 }
 
 /*
  * reads Maps of Session in from JSON cache
- * creates List of Session*  from QVariantList
+ * creates List of Session*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
+ * Session is cached per Conference (cacheSession_<conferenceId>.json):
+ * this reads the former cache file of all Conferences (migration)
  */
 void DataManager::initSessionFromCache()
 {
+    StartupPhase phase(QStringLiteral("initSessionFromCache"));
 	qDebug() << "start initSessionFromCache";
     mAllSession.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheSession);
-    qDebug() << "read Session from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Session* session = new Session();
-        // Important: DataManager must be parent of all root DTOs
-        session->setParent(this);
-        session->fillFromCacheMap(cacheMap);
-        mAllSession.append(session);
+    mSessionDirtyPartitions.clear();
+    mSessionPartitionBySessionId.clear();
+    appendSessionFromCache(cacheSession);
+    rebuildSessionIndex();
+}
+
+/*
+ * reads Session of one Conference (cacheSession_<conferenceId>.json)
+ * and adds them to the Session* already loaded
+ */
+void DataManager::initSessionPartitionFromCache(const int conferenceId)
+{
+    StartupPhase phase(QStringLiteral("initSessionPartitionFromCache"));
+    const int loadedBefore = mAllSession.size();
+    appendSessionFromCache(partitionFileName(cacheSession, conferenceId));
+    for (int i = loadedBefore; i < mAllSession.size(); ++i) {
+        mSessionPartitionBySessionId.insert(((Session*)mAllSession.at(i))->sessionId(), conferenceId);
+    }
+    rebuildSessionIndex();
+}
+
+/*
+ * appends Session* from binary snapshot or JSON cache file
+ */
+void DataManager::appendSessionFromCache(const QString& fileName)
+{
+    const int loadedBefore = mAllSession.size();
+    if (initSessionFromSnapshot(fileName)) {
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Session>(readCacheData(fileName), this, mAllSession)) {
+        qWarning() << "Couldn't read Session from cache" << fileName;
+    }
+    qDebug() << "created Session* #" << mAllSession.size() - loadedBefore;
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    if (mAllSession.size() > loadedBefore) {
+        saveSessionToSnapshot(fileName, mAllSession.mid(loadedBefore));
     }
-    qDebug() << "created Session* #" << mAllSession.size();
 }
 
 
 /*
  * save List of Session* to JSON cache
- * convert list of Session* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Session* to QJsonArray
+ * one cache file per Conference: cacheSession_<conferenceId>.json
+ * only partitions with inserted, deleted or changed objects are written
+ * toCacheJson stores all properties without transient values
  * Session is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveSessionToCache()
 {
-    QVariantList cacheList;
-    qDebug() << "now caching Session* #" << mAllSession.size();
     for (int i = 0; i < mAllSession.size(); ++i) {
         Session* session;
         session = (Session*)mAllSession.at(i);
-        QVariantMap cacheMap;
-        cacheMap = session->toCacheMap();
-        cacheList.append(cacheMap);
+        if (session->isDirty()) {
+            markSessionPartitionDirty(session);
+        }
     }
-    qDebug() << "Session* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheSession, cacheList);
+    if (mSessionDirtyPartitions.isEmpty()) {
+        qDebug() << "Session* unchanged - cache not written";
+        return;
+    }
+    // only changed partitions are written, without Session* they get an empty cache file
+    QMap<int, QList<QObject*> > partitions;
+    QSetIterator<int> dirtyIterator(mSessionDirtyPartitions);
+    while (dirtyIterator.hasNext()) {
+        partitions.insert(dirtyIterator.next(), QList<QObject*>());
+    }
+    for (int i = 0; i < mAllSession.size(); ++i) {
+        Session* session;
+        session = (Session*)mAllSession.at(i);
+        QMap<int, QList<QObject*> >::iterator partition = partitions.find(partitionOfSession(session));
+        if (partition != partitions.end()) {
+            partition.value().append(session);
+        }
+    }
+    qDebug() << "now caching Session* Conferences #" << partitions.size() << "of" << mLoadedConferences.size();
+    QMapIterator<int, QList<QObject*> > partitionIterator(partitions);
+    while (partitionIterator.hasNext()) {
+        partitionIterator.next();
+        const QString fileName = partitionFileName(cacheSession, partitionIterator.key());
+        const QList<QObject*>& partition = partitionIterator.value();
+        // JSON or CBOR as selected in SettingsData
+        writeCacheData(fileName, CacheFormat::encodeObjects<Session>(partition, mCacheFormat));
+        for (int i = 0; i < partition.size(); ++i) {
+            Session* session;
+            session = (Session*)partition.at(i);
+            session->markAsClean();
+            mSessionPartitionBySessionId.insert(session->sessionId(), partitionIterator.key());
+        }
+        saveSessionToSnapshot(fileName, partition);
+        mLoadedConferences.insert(partitionIterator.key());
+    }
+    mSessionDirtyPartitions.clear();
 }
 
-
 void DataManager::resolveSessionReferences(Session* session)
 {
 	if (!session) {
@@ -907,6 +1328,7 @@ void DataManager::resolveSessionReferences(Session* session)
 
 void DataManager::resolveReferencesForAllSession()
 {
+    StartupPhase phase(QStringLiteral("resolveReferencesForAllSession"));
     for (int i = 0; i < mAllSession.size(); ++i) {
         Session* session;
         session = (Session*)mAllSession.at(i);
@@ -923,25 +1345,33 @@ QList<Session*> DataManager::listOfSessionForKeys(
         QStringList keyList)
 {
     QList<Session*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllSession.size(); ++i) {
-        Session* session;
-        session = (Session*) mAllSession.at(i);
-        if (keyList.contains(QString::number(session->sessionId()))) {
-            listOfData.append(session);
-            keyList.removeOne(QString::number(session->sessionId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int sessionId = keyList.at(i).toInt(&ok);
+        Session* session = ok ? mSessionBySessionId.value(sessionId, 0) : 0;
+        if (!session) {
+            missingKeys.append(keyList.at(i));
+            continue;
         }
+        if (resolvedKeys.contains(sessionId)) {
+            continue;
+        }
+        resolvedKeys.insert(sessionId);
+        listOfData.append(session);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Session: " << keyList.join(", ");
+    qWarning() << "not all keys found for Session: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -976,6 +1406,8 @@ void DataManager::appendToSessionProperty(
     if (dataManagerObject) {
         session->setParent(dataManagerObject);
         dataManagerObject->mAllSession.append(session);
+        dataManagerObject->mSessionBySessionId.insert(session->sessionId(), session);
+        dataManagerObject->markSessionPartitionDirty(session);
         emit dataManagerObject->addedToAllSession(session);
     } else {
         qWarning() << "cannot append Session* to mAllSession "
@@ -1023,6 +1455,8 @@ void DataManager::clearSessionProperty(
             session = 0;
         }
         dataManager->mAllSession.clear();
+        dataManager->mSessionBySessionId.clear();
+        dataManager->mSessionDirtyPartitions.unite(dataManager->mLoadedConferences);
     } else {
         qWarning() << "cannot clear mAllSession " << "Object is not of type DataManager*";
     }
@@ -1044,6 +1478,8 @@ void DataManager::deleteSession()
         session = 0;
      }
      mAllSession.clear();
+     mSessionBySessionId.clear();
+     mSessionDirtyPartitions.unite(mLoadedConferences);
 }
 
 /**
@@ -1081,6 +1517,8 @@ void DataManager::insertSession(Session* session)
     // Important: DataManager must be parent of all root DTOs
     session->setParent(this);
     mAllSession.append(session);
+    mSessionBySessionId.insert(session->sessionId(), session);
+    markSessionPartitionDirty(session);
     emit addedToAllSession(session);
     emit sessionPropertyListChanged();
 }
@@ -1096,6 +1534,8 @@ void DataManager::insertSessionFromMap(const QVariantMap& sessionMap,
         session->fillFromMap(sessionMap);
     }
     mAllSession.append(session);
+    mSessionBySessionId.insert(session->sessionId(), session);
+    markSessionPartitionDirty(session);
     emit addedToAllSession(session);
     sessionPropertyListChanged();
 }
@@ -1107,6 +1547,10 @@ bool DataManager::deleteSession(Session* session)
     if (!ok) {
         return ok;
     }
+    markSessionPartitionDirty(session);
+    if (mSessionBySessionId.value(session->sessionId()) == session) {
+        mSessionBySessionId.remove(session->sessionId());
+    }
     emit deletedFromAllSessionBySessionId(session->sessionId());
     emit deletedFromAllSession(session);
     emit sessionPropertyListChanged();
@@ -1118,11 +1562,16 @@ bool DataManager::deleteSession(Session* session)
 
 bool DataManager::deleteSessionBySessionId(const int& sessionId)
 {
+    if (!mSessionBySessionId.contains(sessionId)) {
+        return false;
+    }
     for (int i = 0; i < mAllSession.size(); ++i) {
         Session* session;
         session = (Session*) mAllSession.at(i);
         if (session->sessionId() == sessionId) {
             mAllSession.removeAt(i);
+            mSessionBySessionId.remove(sessionId);
+            markSessionPartitionDirty(session);
             emit deletedFromAllSessionBySessionId(sessionId);
             emit deletedFromAllSession(session);
             emit sessionPropertyListChanged();
@@ -1137,63 +1586,82 @@ bool DataManager::deleteSessionBySessionId(const int& sessionId)
 
 // nr is DomainKey
 Session* DataManager::findSessionBySessionId(const int& sessionId){
+    Session* session = mSessionBySessionId.value(sessionId, 0);
+    if (!session) {
+        qDebug() << "no Session found for sessionId " << sessionId;
+    }
+    return session;
+}
+
+/*
+ * rebuilds the hash index used by findSessionBySessionId
+ * from current List of Session*
+ */
+void DataManager::rebuildSessionIndex()
+{
+    mSessionBySessionId.clear();
+    mSessionBySessionId.reserve(mAllSession.size());
     for (int i = 0; i < mAllSession.size(); ++i) {
         Session* session;
         session = (Session*)mAllSession.at(i);
-        if(session->sessionId() == sessionId){
-            return session;
-        }
+        mSessionBySessionId.insert(session->sessionId(), session);
     }
-    qDebug() << "no Session found for sessionId " << sessionId;
-    return 0;
 }
 
 /*
  * reads Maps of Favorite in from JSON cache
- * creates List of Favorite*  from QVariantList
+ * creates List of Favorite*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
  */
 void DataManager::initFavoriteFromCache()
 {
+    StartupPhase phase(QStringLiteral("initFavoriteFromCache"));
 	qDebug() << "start initFavoriteFromCache";
     mAllFavorite.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheFavorite);
-    qDebug() << "read Favorite from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Favorite* favorite = new Favorite();
-        // Important: DataManager must be parent of all root DTOs
-        favorite->setParent(this);
-        favorite->fillFromCacheMap(cacheMap);
-        mAllFavorite.append(favorite);
+    mFavoriteCacheDirty = false;
+    if (initFavoriteFromSnapshot(cacheFavorite)) {
+        rebuildFavoriteIndex();
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Favorite>(readCacheData(cacheFavorite), this, mAllFavorite)) {
+        qWarning() << "Couldn't read Favorite from cache" << cacheFavorite;
     }
     qDebug() << "created Favorite* #" << mAllFavorite.size();
+    rebuildFavoriteIndex();
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    saveFavoriteToSnapshot(cacheFavorite, mAllFavorite);
 }
 
 
 /*
  * save List of Favorite* to JSON cache
- * convert list of Favorite* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Favorite* to QJsonArray
+ * toCacheJson stores all properties without transient values
  */
 void DataManager::saveFavoriteToCache()
 {
-    QVariantList cacheList;
+    bool dirty = mFavoriteCacheDirty;
+    for (int i = 0; !dirty && i < mAllFavorite.size(); ++i) {
+        dirty = ((Favorite*)mAllFavorite.at(i))->isDirty();
+    }
+    if (!dirty) {
+        qDebug() << "Favorite* unchanged - cache not written";
+        return;
+    }
     qDebug() << "now caching Favorite* #" << mAllFavorite.size();
+    // JSON or CBOR as selected in SettingsData
+    writeCacheData(cacheFavorite, CacheFormat::encodeObjects<Favorite>(mAllFavorite, mCacheFormat));
     for (int i = 0; i < mAllFavorite.size(); ++i) {
         Favorite* favorite;
         favorite = (Favorite*)mAllFavorite.at(i);
-        QVariantMap cacheMap;
-        cacheMap = favorite->toCacheMap();
-        cacheList.append(cacheMap);
+        favorite->markAsClean();
     }
-    qDebug() << "Favorite* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheFavorite, cacheList);
+    saveFavoriteToSnapshot(cacheFavorite, mAllFavorite);
+    mFavoriteCacheDirty = false;
 }
 
-
 void DataManager::resolveFavoriteReferences(Favorite* favorite)
 {
 	if (!favorite) {
@@ -1234,25 +1702,33 @@ QList<Favorite*> DataManager::listOfFavoriteForKeys(
         QStringList keyList)
 {
     QList<Favorite*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllFavorite.size(); ++i) {
-        Favorite* favorite;
-        favorite = (Favorite*) mAllFavorite.at(i);
-        if (keyList.contains(QString::number(favorite->sessionId()))) {
-            listOfData.append(favorite);
-            keyList.removeOne(QString::number(favorite->sessionId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int sessionId = keyList.at(i).toInt(&ok);
+        Favorite* favorite = ok ? mFavoriteBySessionId.value(sessionId, 0) : 0;
+        if (!favorite) {
+            missingKeys.append(keyList.at(i));
+            continue;
+        }
+        if (resolvedKeys.contains(sessionId)) {
+            continue;
         }
+        resolvedKeys.insert(sessionId);
+        listOfData.append(favorite);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Favorite: " << keyList.join(", ");
+    qWarning() << "not all keys found for Favorite: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -1287,6 +1763,8 @@ void DataManager::appendToFavoriteProperty(
     if (dataManagerObject) {
         favorite->setParent(dataManagerObject);
         dataManagerObject->mAllFavorite.append(favorite);
+        dataManagerObject->mFavoriteBySessionId.insert(favorite->sessionId(), favorite);
+        dataManagerObject->mFavoriteCacheDirty = true;
         emit dataManagerObject->addedToAllFavorite(favorite);
     } else {
         qWarning() << "cannot append Favorite* to mAllFavorite "
@@ -1334,6 +1812,8 @@ void DataManager::clearFavoriteProperty(
             favorite = 0;
         }
         dataManager->mAllFavorite.clear();
+        dataManager->mFavoriteBySessionId.clear();
+        dataManager->mFavoriteCacheDirty = true;
     } else {
         qWarning() << "cannot clear mAllFavorite " << "Object is not of type DataManager*";
     }
@@ -1355,6 +1835,8 @@ void DataManager::deleteFavorite()
         favorite = 0;
      }
      mAllFavorite.clear();
+     mFavoriteBySessionId.clear();
+     mFavoriteCacheDirty = true;
 }
 
 /**
@@ -1392,6 +1874,8 @@ void DataManager::insertFavorite(Favorite* favorite)
     // Important: DataManager must be parent of all root DTOs
     favorite->setParent(this);
     mAllFavorite.append(favorite);
+    mFavoriteBySessionId.insert(favorite->sessionId(), favorite);
+    mFavoriteCacheDirty = true;
     emit addedToAllFavorite(favorite);
     emit favoritePropertyListChanged();
 }
@@ -1407,6 +1891,8 @@ void DataManager::insertFavoriteFromMap(const QVariantMap& favoriteMap,
         favorite->fillFromMap(favoriteMap);
     }
     mAllFavorite.append(favorite);
+    mFavoriteBySessionId.insert(favorite->sessionId(), favorite);
+    mFavoriteCacheDirty = true;
     emit addedToAllFavorite(favorite);
     favoritePropertyListChanged();
 }
@@ -1418,6 +1904,10 @@ bool DataManager::deleteFavorite(Favorite* favorite)
     if (!ok) {
         return ok;
     }
+    mFavoriteCacheDirty = true;
+    if (mFavoriteBySessionId.value(favorite->sessionId()) == favorite) {
+        mFavoriteBySessionId.remove(favorite->sessionId());
+    }
     emit deletedFromAllFavoriteBySessionId(favorite->sessionId());
     emit deletedFromAllFavorite(favorite);
     emit favoritePropertyListChanged();
@@ -1429,11 +1919,16 @@ bool DataManager::deleteFavorite(Favorite* favorite)
 
 bool DataManager::deleteFavoriteBySessionId(const int& sessionId)
 {
+    if (!mFavoriteBySessionId.contains(sessionId)) {
+        return false;
+    }
     for (int i = 0; i < mAllFavorite.size(); ++i) {
         Favorite* favorite;
         favorite = (Favorite*) mAllFavorite.at(i);
         if (favorite->sessionId() == sessionId) {
             mAllFavorite.removeAt(i);
+            mFavoriteBySessionId.remove(sessionId);
+            mFavoriteCacheDirty = true;
             emit deletedFromAllFavoriteBySessionId(sessionId);
             emit deletedFromAllFavorite(favorite);
             emit favoritePropertyListChanged();
@@ -1448,37 +1943,41 @@ bool DataManager::deleteFavoriteBySessionId(const int& sessionId)
 
 // nr is DomainKey
 Favorite* DataManager::findFavoriteBySessionId(const int& sessionId){
+    Favorite* favorite = mFavoriteBySessionId.value(sessionId, 0);
+    if (!favorite) {
+        qDebug() << "no Favorite found for sessionId " << sessionId;
+    }
+    return favorite;
+}
+
+/*
+ * rebuilds the hash index used by findFavoriteBySessionId
+ * from current List of Favorite*
+ */
+void DataManager::rebuildFavoriteIndex()
+{
+    mFavoriteBySessionId.clear();
+    mFavoriteBySessionId.reserve(mAllFavorite.size());
     for (int i = 0; i < mAllFavorite.size(); ++i) {
         Favorite* favorite;
         favorite = (Favorite*)mAllFavorite.at(i);
-        if(favorite->sessionId() == sessionId){
-            return favorite;
-        }
+        mFavoriteBySessionId.insert(favorite->sessionId(), favorite);
     }
-    qDebug() << "no Favorite found for sessionId " << sessionId;
-    return 0;
 }
 
 /*
  * reads Maps of SessionLists in from JSON cache
- * creates List of SessionLists*  from QVariantList
+ * creates List of SessionLists*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
  */
 void DataManager::initSessionListsFromCache()
 {
 	qDebug() << "start initSessionListsFromCache";
     mAllSessionLists.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheSessionLists);
-    qDebug() << "read SessionLists from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        SessionLists* sessionLists = new SessionLists();
-        // Important: DataManager must be parent of all root DTOs
-        sessionLists->setParent(this);
-        sessionLists->fillFromCacheMap(cacheMap);
-        mAllSessionLists.append(sessionLists);
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<SessionLists>(readCacheData(cacheSessionLists), this, mAllSessionLists)) {
+        qWarning() << "Couldn't read SessionLists from cache" << cacheSessionLists;
     }
     qDebug() << "created SessionLists* #" << mAllSessionLists.size();
 }
@@ -1486,23 +1985,15 @@ void DataManager::initSessionListsFromCache()
 
 /*
  * save List of SessionLists* to JSON cache
- * convert list of SessionLists* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of SessionLists* to QJsonArray
+ * toCacheJson stores all properties without transient values
  * SessionLists is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveSessionListsToCache()
 {
-    QVariantList cacheList;
     qDebug() << "now caching SessionLists* #" << mAllSessionLists.size();
-    for (int i = 0; i < mAllSessionLists.size(); ++i) {
-        SessionLists* sessionLists;
-        sessionLists = (SessionLists*)mAllSessionLists.at(i);
-        QVariantMap cacheMap;
-        cacheMap = sessionLists->toCacheMap();
-        cacheList.append(cacheMap);
-    }
-    qDebug() << "SessionLists* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheSessionLists, cacheList);
+    // JSON or CBOR as selected in SettingsData
+    writeCacheData(cacheSessionLists, CacheFormat::encodeObjects<SessionLists>(mAllSessionLists, mCacheFormat));
 }
 
 
@@ -1749,51 +2240,59 @@ SessionLists* DataManager::findSessionListsByUuid(const QString& uuid){
 
 /*
  * reads Maps of Speaker in from JSON cache
- * creates List of Speaker*  from QVariantList
+ * creates List of Speaker*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
  */
 void DataManager::initSpeakerFromCache()
 {
+    StartupPhase phase(QStringLiteral("initSpeakerFromCache"));
 	qDebug() << "start initSpeakerFromCache";
     mAllSpeaker.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheSpeaker);
-    qDebug() << "read Speaker from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Speaker* speaker = new Speaker();
-        // Important: DataManager must be parent of all root DTOs
-        speaker->setParent(this);
-        speaker->fillFromCacheMap(cacheMap);
-        mAllSpeaker.append(speaker);
+    mSpeakerCacheDirty = false;
+    if (initSpeakerFromSnapshot(cacheSpeaker)) {
+        rebuildSpeakerIndex();
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Speaker>(readCacheData(cacheSpeaker), this, mAllSpeaker)) {
+        qWarning() << "Couldn't read Speaker from cache" << cacheSpeaker;
     }
     qDebug() << "created Speaker* #" << mAllSpeaker.size();
+    rebuildSpeakerIndex();
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    saveSpeakerToSnapshot(cacheSpeaker, mAllSpeaker);
 }
 
 
 /*
  * save List of Speaker* to JSON cache
- * convert list of Speaker* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Speaker* to QJsonArray
+ * toCacheJson stores all properties without transient values
  * Speaker is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveSpeakerToCache()
 {
-    QVariantList cacheList;
+    bool dirty = mSpeakerCacheDirty;
+    for (int i = 0; !dirty && i < mAllSpeaker.size(); ++i) {
+        dirty = ((Speaker*)mAllSpeaker.at(i))->isDirty();
+    }
+    if (!dirty) {
+        qDebug() << "Speaker* unchanged - cache not written";
+        return;
+    }
     qDebug() << "now caching Speaker* #" << mAllSpeaker.size();
+    // JSON or CBOR as selected in SettingsData
+    writeCacheData(cacheSpeaker, CacheFormat::encodeObjects<Speaker>(mAllSpeaker, mCacheFormat));
     for (int i = 0; i < mAllSpeaker.size(); ++i) {
         Speaker* speaker;
         speaker = (Speaker*)mAllSpeaker.at(i);
-        QVariantMap cacheMap;
-        cacheMap = speaker->toCacheMap();
-        cacheList.append(cacheMap);
+        speaker->markAsClean();
     }
-    qDebug() << "Speaker* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheSpeaker, cacheList);
+    saveSpeakerToSnapshot(cacheSpeaker, mAllSpeaker);
+    mSpeakerCacheDirty = false;
 }
 
-
 void DataManager::resolveSpeakerReferences(Speaker* speaker)
 {
 	if (!speaker) {
@@ -1826,6 +2325,7 @@ void DataManager::resolveSpeakerReferences(Speaker* speaker)
 
 void DataManager::resolveReferencesForAllSpeaker()
 {
+    StartupPhase phase(QStringLiteral("resolveReferencesForAllSpeaker"));
     for (int i = 0; i < mAllSpeaker.size(); ++i) {
         Speaker* speaker;
         speaker = (Speaker*)mAllSpeaker.at(i);
@@ -1842,25 +2342,33 @@ QList<Speaker*> DataManager::listOfSpeakerForKeys(
         QStringList keyList)
 {
     QList<Speaker*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllSpeaker.size(); ++i) {
-        Speaker* speaker;
-        speaker = (Speaker*) mAllSpeaker.at(i);
-        if (keyList.contains(QString::number(speaker->speakerId()))) {
-            listOfData.append(speaker);
-            keyList.removeOne(QString::number(speaker->speakerId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int speakerId = keyList.at(i).toInt(&ok);
+        Speaker* speaker = ok ? mSpeakerBySpeakerId.value(speakerId, 0) : 0;
+        if (!speaker) {
+            missingKeys.append(keyList.at(i));
+            continue;
         }
+        if (resolvedKeys.contains(speakerId)) {
+            continue;
+        }
+        resolvedKeys.insert(speakerId);
+        listOfData.append(speaker);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Speaker: " << keyList.join(", ");
+    qWarning() << "not all keys found for Speaker: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -1895,6 +2403,8 @@ void DataManager::appendToSpeakerProperty(
     if (dataManagerObject) {
         speaker->setParent(dataManagerObject);
         dataManagerObject->mAllSpeaker.append(speaker);
+        dataManagerObject->mSpeakerBySpeakerId.insert(speaker->speakerId(), speaker);
+        dataManagerObject->mSpeakerCacheDirty = true;
         emit dataManagerObject->addedToAllSpeaker(speaker);
     } else {
         qWarning() << "cannot append Speaker* to mAllSpeaker "
@@ -1942,6 +2452,8 @@ void DataManager::clearSpeakerProperty(
             speaker = 0;
         }
         dataManager->mAllSpeaker.clear();
+        dataManager->mSpeakerBySpeakerId.clear();
+        dataManager->mSpeakerCacheDirty = true;
     } else {
         qWarning() << "cannot clear mAllSpeaker " << "Object is not of type DataManager*";
     }
@@ -1963,6 +2475,8 @@ void DataManager::deleteSpeaker()
         speaker = 0;
      }
      mAllSpeaker.clear();
+     mSpeakerBySpeakerId.clear();
+     mSpeakerCacheDirty = true;
 }
 
 /**
@@ -2000,6 +2514,8 @@ void DataManager::insertSpeaker(Speaker* speaker)
     // Important: DataManager must be parent of all root DTOs
     speaker->setParent(this);
     mAllSpeaker.append(speaker);
+    mSpeakerBySpeakerId.insert(speaker->speakerId(), speaker);
+    mSpeakerCacheDirty = true;
     emit addedToAllSpeaker(speaker);
     emit speakerPropertyListChanged();
 }
@@ -2015,6 +2531,8 @@ void DataManager::insertSpeakerFromMap(const QVariantMap& speakerMap,
         speaker->fillFromMap(speakerMap);
     }
     mAllSpeaker.append(speaker);
+    mSpeakerBySpeakerId.insert(speaker->speakerId(), speaker);
+    mSpeakerCacheDirty = true;
     emit addedToAllSpeaker(speaker);
     speakerPropertyListChanged();
 }
@@ -2026,6 +2544,10 @@ bool DataManager::deleteSpeaker(Speaker* speaker)
     if (!ok) {
         return ok;
     }
+    mSpeakerCacheDirty = true;
+    if (mSpeakerBySpeakerId.value(speaker->speakerId()) == speaker) {
+        mSpeakerBySpeakerId.remove(speaker->speakerId());
+    }
     emit deletedFromAllSpeakerBySpeakerId(speaker->speakerId());
     emit deletedFromAllSpeaker(speaker);
     emit speakerPropertyListChanged();
@@ -2037,11 +2559,16 @@ bool DataManager::deleteSpeaker(Speaker* speaker)
 
 bool DataManager::deleteSpeakerBySpeakerId(const int& speakerId)
 {
+    if (!mSpeakerBySpeakerId.contains(speakerId)) {
+        return false;
+    }
     for (int i = 0; i < mAllSpeaker.size(); ++i) {
         Speaker* speaker;
         speaker = (Speaker*) mAllSpeaker.at(i);
         if (speaker->speakerId() == speakerId) {
             mAllSpeaker.removeAt(i);
+            mSpeakerBySpeakerId.remove(speakerId);
+            mSpeakerCacheDirty = true;
             emit deletedFromAllSpeakerBySpeakerId(speakerId);
             emit deletedFromAllSpeaker(speaker);
             emit speakerPropertyListChanged();
@@ -2056,65 +2583,83 @@ bool DataManager::deleteSpeakerBySpeakerId(const int& speakerId)
 
 // nr is DomainKey
 Speaker* DataManager::findSpeakerBySpeakerId(const int& speakerId){
+    Speaker* speaker = mSpeakerBySpeakerId.value(speakerId, 0);
+    if (!speaker) {
+        qDebug() << "no Speaker found for speakerId " << speakerId;
+    }
+    return speaker;
+}
+
+/*
+ * rebuilds the hash index used by findSpeakerBySpeakerId
+ * from current List of Speaker*
+ */
+void DataManager::rebuildSpeakerIndex()
+{
+    mSpeakerBySpeakerId.clear();
+    mSpeakerBySpeakerId.reserve(mAllSpeaker.size());
     for (int i = 0; i < mAllSpeaker.size(); ++i) {
         Speaker* speaker;
         speaker = (Speaker*)mAllSpeaker.at(i);
-        if(speaker->speakerId() == speakerId){
-            return speaker;
-        }
+        mSpeakerBySpeakerId.insert(speaker->speakerId(), speaker);
     }
-    qDebug() << "no Speaker found for speakerId " << speakerId;
-    return 0;
 }
 
 /*
  * reads Maps of SpeakerImage in from JSON cache
- * creates List of SpeakerImage*  from QVariantList
+ * creates List of SpeakerImage*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
  */
 void DataManager::initSpeakerImageFromCache()
 {
+    StartupPhase phase(QStringLiteral("initSpeakerImageFromCache"));
 	qDebug() << "start initSpeakerImageFromCache";
     mAllSpeakerImage.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheSpeakerImage);
-    qDebug() << "read SpeakerImage from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        SpeakerImage* speakerImage = new SpeakerImage();
-        // Important: DataManager must be parent of all root DTOs
-        speakerImage->setParent(this);
-        speakerImage->fillFromCacheMap(cacheMap);
-        mAllSpeakerImage.append(speakerImage);
+    mSpeakerImageCacheDirty = false;
+    if (initSpeakerImageFromSnapshot(cacheSpeakerImage)) {
+        rebuildSpeakerImageIndex();
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<SpeakerImage>(readCacheData(cacheSpeakerImage), this, mAllSpeakerImage)) {
+        qWarning() << "Couldn't read SpeakerImage from cache" << cacheSpeakerImage;
     }
     qDebug() << "created SpeakerImage* #" << mAllSpeakerImage.size();
+    rebuildSpeakerImageIndex();
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    saveSpeakerImageToSnapshot(cacheSpeakerImage, mAllSpeakerImage);
 }
 
 
 /*
  * save List of SpeakerImage* to JSON cache
- * convert list of SpeakerImage* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of SpeakerImage* to QJsonArray
+ * toCacheJson stores all properties without transient values
  * SpeakerImage is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveSpeakerImageToCache()
 {
-    QVariantList cacheList;
+    bool dirty = mSpeakerImageCacheDirty;
+    for (int i = 0; !dirty && i < mAllSpeakerImage.size(); ++i) {
+        dirty = ((SpeakerImage*)mAllSpeakerImage.at(i))->isDirty();
+    }
+    if (!dirty) {
+        qDebug() << "SpeakerImage* unchanged - cache not written";
+        return;
+    }
     qDebug() << "now caching SpeakerImage* #" << mAllSpeakerImage.size();
+    // JSON or CBOR as selected in SettingsData
+    writeCacheData(cacheSpeakerImage, CacheFormat::encodeObjects<SpeakerImage>(mAllSpeakerImage, mCacheFormat));
     for (int i = 0; i < mAllSpeakerImage.size(); ++i) {
         SpeakerImage* speakerImage;
         speakerImage = (SpeakerImage*)mAllSpeakerImage.at(i);
-        QVariantMap cacheMap;
-        cacheMap = speakerImage->toCacheMap();
-        cacheList.append(cacheMap);
+        speakerImage->markAsClean();
     }
-    qDebug() << "SpeakerImage* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheSpeakerImage, cacheList);
+    saveSpeakerImageToSnapshot(cacheSpeakerImage, mAllSpeakerImage);
+    mSpeakerImageCacheDirty = false;
 }
 
-
-
 /**
 * converts a list of keys in to a list of DataObjects
 * per ex. used to resolve lazy arrays
@@ -2123,25 +2668,33 @@ QList<SpeakerImage*> DataManager::listOfSpeakerImageForKeys(
         QStringList keyList)
 {
     QList<SpeakerImage*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllSpeakerImage.size(); ++i) {
-        SpeakerImage* speakerImage;
-        speakerImage = (SpeakerImage*) mAllSpeakerImage.at(i);
-        if (keyList.contains(QString::number(speakerImage->speakerId()))) {
-            listOfData.append(speakerImage);
-            keyList.removeOne(QString::number(speakerImage->speakerId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int speakerId = keyList.at(i).toInt(&ok);
+        SpeakerImage* speakerImage = ok ? mSpeakerImageBySpeakerId.value(speakerId, 0) : 0;
+        if (!speakerImage) {
+            missingKeys.append(keyList.at(i));
+            continue;
         }
+        if (resolvedKeys.contains(speakerId)) {
+            continue;
+        }
+        resolvedKeys.insert(speakerId);
+        listOfData.append(speakerImage);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for SpeakerImage: " << keyList.join(", ");
+    qWarning() << "not all keys found for SpeakerImage: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -2176,6 +2729,8 @@ void DataManager::appendToSpeakerImageProperty(
     if (dataManagerObject) {
         speakerImage->setParent(dataManagerObject);
         dataManagerObject->mAllSpeakerImage.append(speakerImage);
+        dataManagerObject->mSpeakerImageBySpeakerId.insert(speakerImage->speakerId(), speakerImage);
+        dataManagerObject->mSpeakerImageCacheDirty = true;
         emit dataManagerObject->addedToAllSpeakerImage(speakerImage);
     } else {
         qWarning() << "cannot append SpeakerImage* to mAllSpeakerImage "
@@ -2223,6 +2778,8 @@ void DataManager::clearSpeakerImageProperty(
             speakerImage = 0;
         }
         dataManager->mAllSpeakerImage.clear();
+        dataManager->mSpeakerImageBySpeakerId.clear();
+        dataManager->mSpeakerImageCacheDirty = true;
     } else {
         qWarning() << "cannot clear mAllSpeakerImage " << "Object is not of type DataManager*";
     }
@@ -2244,6 +2801,8 @@ void DataManager::deleteSpeakerImage()
         speakerImage = 0;
      }
      mAllSpeakerImage.clear();
+     mSpeakerImageBySpeakerId.clear();
+     mSpeakerImageCacheDirty = true;
 }
 
 /**
@@ -2281,6 +2840,8 @@ void DataManager::insertSpeakerImage(SpeakerImage* speakerImage)
     // Important: DataManager must be parent of all root DTOs
     speakerImage->setParent(this);
     mAllSpeakerImage.append(speakerImage);
+    mSpeakerImageBySpeakerId.insert(speakerImage->speakerId(), speakerImage);
+    mSpeakerImageCacheDirty = true;
     emit addedToAllSpeakerImage(speakerImage);
     emit speakerImagePropertyListChanged();
 }
@@ -2296,6 +2857,8 @@ void DataManager::insertSpeakerImageFromMap(const QVariantMap& speakerImageMap,
         speakerImage->fillFromMap(speakerImageMap);
     }
     mAllSpeakerImage.append(speakerImage);
+    mSpeakerImageBySpeakerId.insert(speakerImage->speakerId(), speakerImage);
+    mSpeakerImageCacheDirty = true;
     emit addedToAllSpeakerImage(speakerImage);
     speakerImagePropertyListChanged();
 }
@@ -2307,6 +2870,10 @@ bool DataManager::deleteSpeakerImage(SpeakerImage* speakerImage)
     if (!ok) {
         return ok;
     }
+    mSpeakerImageCacheDirty = true;
+    if (mSpeakerImageBySpeakerId.value(speakerImage->speakerId()) == speakerImage) {
+        mSpeakerImageBySpeakerId.remove(speakerImage->speakerId());
+    }
     emit deletedFromAllSpeakerImageBySpeakerId(speakerImage->speakerId());
     emit deletedFromAllSpeakerImage(speakerImage);
     emit speakerImagePropertyListChanged();
@@ -2318,11 +2885,16 @@ bool DataManager::deleteSpeakerImage(SpeakerImage* speakerImage)
 
 bool DataManager::deleteSpeakerImageBySpeakerId(const int& speakerId)
 {
+    if (!mSpeakerImageBySpeakerId.contains(speakerId)) {
+        return false;
+    }
     for (int i = 0; i < mAllSpeakerImage.size(); ++i) {
         SpeakerImage* speakerImage;
         speakerImage = (SpeakerImage*) mAllSpeakerImage.at(i);
         if (speakerImage->speakerId() == speakerId) {
             mAllSpeakerImage.removeAt(i);
+            mSpeakerImageBySpeakerId.remove(speakerId);
+            mSpeakerImageCacheDirty = true;
             emit deletedFromAllSpeakerImageBySpeakerId(speakerId);
             emit deletedFromAllSpeakerImage(speakerImage);
             emit speakerImagePropertyListChanged();
@@ -2337,65 +2909,138 @@ bool DataManager::deleteSpeakerImageBySpeakerId(const int& speakerId)
 
 // nr is DomainKey
 SpeakerImage* DataManager::findSpeakerImageBySpeakerId(const int& speakerId){
+    SpeakerImage* speakerImage = mSpeakerImageBySpeakerId.value(speakerId, 0);
+    if (!speakerImage) {
+        qDebug() << "no SpeakerImage found for speakerId " << speakerId;
+    }
+    return speakerImage;
+}
+
+/*
+ * rebuilds the hash index used by findSpeakerImageBySpeakerId
+ * from current List of SpeakerImage*
+ */
+void DataManager::rebuildSpeakerImageIndex()
+{
+    mSpeakerImageBySpeakerId.clear();
+    mSpeakerImageBySpeakerId.reserve(mAllSpeakerImage.size());
     for (int i = 0; i < mAllSpeakerImage.size(); ++i) {
         SpeakerImage* speakerImage;
         speakerImage = (SpeakerImage*)mAllSpeakerImage.at(i);
-        if(speakerImage->speakerId() == speakerId){
-            return speakerImage;
-        }
+        mSpeakerImageBySpeakerId.insert(speakerImage->speakerId(), speakerImage);
     }
-    qDebug() << "no SpeakerImage found for speakerId " << speakerId;
-    return 0;
 }
 
 /*
  * reads Maps of SessionTrack in from JSON cache
- * creates List of SessionTrack*  from QVariantList
+ * creates List of SessionTrack*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
+ * SessionTrack is cached per Conference (cacheSessionTrack_<conferenceId>.json):
+ * this reads the former cache file of all Conferences (migration)
  */
 void DataManager::initSessionTrackFromCache()
 {
+    StartupPhase phase(QStringLiteral("initSessionTrackFromCache"));
 	qDebug() << "start initSessionTrackFromCache";
     mAllSessionTrack.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheSessionTrack);
-    qDebug() << "read SessionTrack from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        SessionTrack* sessionTrack = new SessionTrack();
-        // Important: DataManager must be parent of all root DTOs
-        sessionTrack->setParent(this);
-        sessionTrack->fillFromCacheMap(cacheMap);
-        mAllSessionTrack.append(sessionTrack);
+    mSessionTrackDirtyPartitions.clear();
+    mSessionTrackPartitionByTrackId.clear();
+    appendSessionTrackFromCache(cacheSessionTrack);
+    rebuildSessionTrackIndex();
+}
+
+/*
+ * reads SessionTrack of one Conference (cacheSessionTrack_<conferenceId>.json)
+ * and adds them to the SessionTrack* already loaded
+ */
+void DataManager::initSessionTrackPartitionFromCache(const int conferenceId)
+{
+    StartupPhase phase(QStringLiteral("initSessionTrackPartitionFromCache"));
+    const int loadedBefore = mAllSessionTrack.size();
+    appendSessionTrackFromCache(partitionFileName(cacheSessionTrack, conferenceId));
+    for (int i = loadedBefore; i < mAllSessionTrack.size(); ++i) {
+        mSessionTrackPartitionByTrackId.insert(((SessionTrack*)mAllSessionTrack.at(i))->trackId(), conferenceId);
+    }
+    rebuildSessionTrackIndex();
+}
+
+/*
+ * appends SessionTrack* from binary snapshot or JSON cache file
+ */
+void DataManager::appendSessionTrackFromCache(const QString& fileName)
+{
+    const int loadedBefore = mAllSessionTrack.size();
+    if (initSessionTrackFromSnapshot(fileName)) {
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<SessionTrack>(readCacheData(fileName), this, mAllSessionTrack)) {
+        qWarning() << "Couldn't read SessionTrack from cache" << fileName;
+    }
+    qDebug() << "created SessionTrack* #" << mAllSessionTrack.size() - loadedBefore;
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    if (mAllSessionTrack.size() > loadedBefore) {
+        saveSessionTrackToSnapshot(fileName, mAllSessionTrack.mid(loadedBefore));
     }
-    qDebug() << "created SessionTrack* #" << mAllSessionTrack.size();
 }
 
 
 /*
  * save List of SessionTrack* to JSON cache
- * convert list of SessionTrack* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of SessionTrack* to QJsonArray
+ * one cache file per Conference: cacheSessionTrack_<conferenceId>.json
+ * only partitions with inserted, deleted or changed objects are written
+ * toCacheJson stores all properties without transient values
  * SessionTrack is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveSessionTrackToCache()
 {
-    QVariantList cacheList;
-    qDebug() << "now caching SessionTrack* #" << mAllSessionTrack.size();
     for (int i = 0; i < mAllSessionTrack.size(); ++i) {
         SessionTrack* sessionTrack;
         sessionTrack = (SessionTrack*)mAllSessionTrack.at(i);
-        QVariantMap cacheMap;
-        cacheMap = sessionTrack->toCacheMap();
-        cacheList.append(cacheMap);
+        if (sessionTrack->isDirty()) {
+            markSessionTrackPartitionDirty(sessionTrack);
+        }
+    }
+    if (mSessionTrackDirtyPartitions.isEmpty()) {
+        qDebug() << "SessionTrack* unchanged - cache not written";
+        return;
+    }
+    // only changed partitions are written, without SessionTrack* they get an empty cache file
+    QMap<int, QList<QObject*> > partitions;
+    QSetIterator<int> dirtyIterator(mSessionTrackDirtyPartitions);
+    while (dirtyIterator.hasNext()) {
+        partitions.insert(dirtyIterator.next(), QList<QObject*>());
+    }
+    for (int i = 0; i < mAllSessionTrack.size(); ++i) {
+        SessionTrack* sessionTrack;
+        sessionTrack = (SessionTrack*)mAllSessionTrack.at(i);
+        QMap<int, QList<QObject*> >::iterator partition = partitions.find(partitionOf(sessionTrack->conference()));
+        if (partition != partitions.end()) {
+            partition.value().append(sessionTrack);
+        }
+    }
+    qDebug() << "now caching SessionTrack* Conferences #" << partitions.size() << "of" << mLoadedConferences.size();
+    QMapIterator<int, QList<QObject*> > partitionIterator(partitions);
+    while (partitionIterator.hasNext()) {
+        partitionIterator.next();
+        const QString fileName = partitionFileName(cacheSessionTrack, partitionIterator.key());
+        const QList<QObject*>& partition = partitionIterator.value();
+        // JSON or CBOR as selected in SettingsData
+        writeCacheData(fileName, CacheFormat::encodeObjects<SessionTrack>(partition, mCacheFormat));
+        for (int i = 0; i < partition.size(); ++i) {
+            SessionTrack* sessionTrack;
+            sessionTrack = (SessionTrack*)partition.at(i);
+            sessionTrack->markAsClean();
+            mSessionTrackPartitionByTrackId.insert(sessionTrack->trackId(), partitionIterator.key());
+        }
+        saveSessionTrackToSnapshot(fileName, partition);
+        mLoadedConferences.insert(partitionIterator.key());
     }
-    qDebug() << "SessionTrack* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheSessionTrack, cacheList);
+    mSessionTrackDirtyPartitions.clear();
 }
 
-
-
 /**
 * converts a list of keys in to a list of DataObjects
 * per ex. used to resolve lazy arrays
@@ -2404,25 +3049,33 @@ QList<SessionTrack*> DataManager::listOfSessionTrackForKeys(
         QStringList keyList)
 {
     QList<SessionTrack*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllSessionTrack.size(); ++i) {
-        SessionTrack* sessionTrack;
-        sessionTrack = (SessionTrack*) mAllSessionTrack.at(i);
-        if (keyList.contains(QString::number(sessionTrack->trackId()))) {
-            listOfData.append(sessionTrack);
-            keyList.removeOne(QString::number(sessionTrack->trackId()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int trackId = keyList.at(i).toInt(&ok);
+        SessionTrack* sessionTrack = ok ? mSessionTrackByTrackId.value(trackId, 0) : 0;
+        if (!sessionTrack) {
+            missingKeys.append(keyList.at(i));
+            continue;
+        }
+        if (resolvedKeys.contains(trackId)) {
+            continue;
         }
+        resolvedKeys.insert(trackId);
+        listOfData.append(sessionTrack);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for SessionTrack: " << keyList.join(", ");
+    qWarning() << "not all keys found for SessionTrack: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -2457,6 +3110,8 @@ void DataManager::appendToSessionTrackProperty(
     if (dataManagerObject) {
         sessionTrack->setParent(dataManagerObject);
         dataManagerObject->mAllSessionTrack.append(sessionTrack);
+        dataManagerObject->mSessionTrackByTrackId.insert(sessionTrack->trackId(), sessionTrack);
+        dataManagerObject->markSessionTrackPartitionDirty(sessionTrack);
         emit dataManagerObject->addedToAllSessionTrack(sessionTrack);
     } else {
         qWarning() << "cannot append SessionTrack* to mAllSessionTrack "
@@ -2504,6 +3159,8 @@ void DataManager::clearSessionTrackProperty(
             sessionTrack = 0;
         }
         dataManager->mAllSessionTrack.clear();
+        dataManager->mSessionTrackByTrackId.clear();
+        dataManager->mSessionTrackDirtyPartitions.unite(dataManager->mLoadedConferences);
     } else {
         qWarning() << "cannot clear mAllSessionTrack " << "Object is not of type DataManager*";
     }
@@ -2525,6 +3182,8 @@ void DataManager::deleteSessionTrack()
         sessionTrack = 0;
      }
      mAllSessionTrack.clear();
+     mSessionTrackByTrackId.clear();
+     mSessionTrackDirtyPartitions.unite(mLoadedConferences);
 }
 
 /**
@@ -2562,6 +3221,8 @@ void DataManager::insertSessionTrack(SessionTrack* sessionTrack)
     // Important: DataManager must be parent of all root DTOs
     sessionTrack->setParent(this);
     mAllSessionTrack.append(sessionTrack);
+    mSessionTrackByTrackId.insert(sessionTrack->trackId(), sessionTrack);
+    markSessionTrackPartitionDirty(sessionTrack);
     emit addedToAllSessionTrack(sessionTrack);
     emit sessionTrackPropertyListChanged();
 }
@@ -2577,6 +3238,8 @@ void DataManager::insertSessionTrackFromMap(const QVariantMap& sessionTrackMap,
         sessionTrack->fillFromMap(sessionTrackMap);
     }
     mAllSessionTrack.append(sessionTrack);
+    mSessionTrackByTrackId.insert(sessionTrack->trackId(), sessionTrack);
+    markSessionTrackPartitionDirty(sessionTrack);
     emit addedToAllSessionTrack(sessionTrack);
     sessionTrackPropertyListChanged();
 }
@@ -2588,6 +3251,10 @@ bool DataManager::deleteSessionTrack(SessionTrack* sessionTrack)
     if (!ok) {
         return ok;
     }
+    markSessionTrackPartitionDirty(sessionTrack);
+    if (mSessionTrackByTrackId.value(sessionTrack->trackId()) == sessionTrack) {
+        mSessionTrackByTrackId.remove(sessionTrack->trackId());
+    }
     emit deletedFromAllSessionTrackByTrackId(sessionTrack->trackId());
     emit deletedFromAllSessionTrack(sessionTrack);
     emit sessionTrackPropertyListChanged();
@@ -2599,11 +3266,16 @@ bool DataManager::deleteSessionTrack(SessionTrack* sessionTrack)
 
 bool DataManager::deleteSessionTrackByTrackId(const int& trackId)
 {
+    if (!mSessionTrackByTrackId.contains(trackId)) {
+        return false;
+    }
     for (int i = 0; i < mAllSessionTrack.size(); ++i) {
         SessionTrack* sessionTrack;
         sessionTrack = (SessionTrack*) mAllSessionTrack.at(i);
         if (sessionTrack->trackId() == trackId) {
             mAllSessionTrack.removeAt(i);
+            mSessionTrackByTrackId.remove(trackId);
+            markSessionTrackPartitionDirty(sessionTrack);
             emit deletedFromAllSessionTrackByTrackId(trackId);
             emit deletedFromAllSessionTrack(sessionTrack);
             emit sessionTrackPropertyListChanged();
@@ -2618,65 +3290,138 @@ bool DataManager::deleteSessionTrackByTrackId(const int& trackId)
 
 // nr is DomainKey
 SessionTrack* DataManager::findSessionTrackByTrackId(const int& trackId){
+    SessionTrack* sessionTrack = mSessionTrackByTrackId.value(trackId, 0);
+    if (!sessionTrack) {
+        qDebug() << "no SessionTrack found for trackId " << trackId;
+    }
+    return sessionTrack;
+}
+
+/*
+ * rebuilds the hash index used by findSessionTrackByTrackId
+ * from current List of SessionTrack*
+ */
+void DataManager::rebuildSessionTrackIndex()
+{
+    mSessionTrackByTrackId.clear();
+    mSessionTrackByTrackId.reserve(mAllSessionTrack.size());
     for (int i = 0; i < mAllSessionTrack.size(); ++i) {
         SessionTrack* sessionTrack;
         sessionTrack = (SessionTrack*)mAllSessionTrack.at(i);
-        if(sessionTrack->trackId() == trackId){
-            return sessionTrack;
-        }
+        mSessionTrackByTrackId.insert(sessionTrack->trackId(), sessionTrack);
     }
-    qDebug() << "no SessionTrack found for trackId " << trackId;
-    return 0;
 }
 
 /*
  * reads Maps of Day in from JSON cache
- * creates List of Day*  from QVariantList
+ * creates List of Day*  from QJsonArray
  * List declared as list of QObject* - only way to use in GroupDataModel
+ * Day is cached per Conference (cacheDay_<conferenceId>.json):
+ * this reads the former cache file of all Conferences (migration)
  */
 void DataManager::initDayFromCache()
 {
+    StartupPhase phase(QStringLiteral("initDayFromCache"));
 	qDebug() << "start initDayFromCache";
     mAllDay.clear();
-    QVariantList cacheList;
-    cacheList = readFromCache(cacheDay);
-    qDebug() << "read Day from cache #" << cacheList.size();
-    for (int i = 0; i < cacheList.size(); ++i) {
-        QVariantMap cacheMap;
-        cacheMap = cacheList.at(i).toMap();
-        Day* day = new Day();
-        // Important: DataManager must be parent of all root DTOs
-        day->setParent(this);
-        day->fillFromCacheMap(cacheMap);
-        mAllDay.append(day);
+    mDayDirtyPartitions.clear();
+    mDayPartitionById.clear();
+    appendDayFromCache(cacheDay);
+    rebuildDayIndex();
+}
+
+/*
+ * reads Day of one Conference (cacheDay_<conferenceId>.json)
+ * and adds them to the Day* already loaded
+ */
+void DataManager::initDayPartitionFromCache(const int conferenceId)
+{
+    StartupPhase phase(QStringLiteral("initDayPartitionFromCache"));
+    const int loadedBefore = mAllDay.size();
+    appendDayFromCache(partitionFileName(cacheDay, conferenceId));
+    for (int i = loadedBefore; i < mAllDay.size(); ++i) {
+        mDayPartitionById.insert(((Day*)mAllDay.at(i))->id(), conferenceId);
+    }
+    rebuildDayIndex();
+}
+
+/*
+ * appends Day* from binary snapshot or JSON cache file
+ */
+void DataManager::appendDayFromCache(const QString& fileName)
+{
+    const int loadedBefore = mAllDay.size();
+    if (initDayFromSnapshot(fileName)) {
+        return;
+    }
+    // JSON or CBOR (streamed into the typed fields)
+    // Important: DataManager must be parent of all root DTOs
+    if (!CacheFormat::decodeObjects<Day>(readCacheData(fileName), this, mAllDay)) {
+        qWarning() << "Couldn't read Day from cache" << fileName;
+    }
+    qDebug() << "created Day* #" << mAllDay.size() - loadedBefore;
+    // migrate existing JSON cache: next time the binary snapshot will be used
+    if (mAllDay.size() > loadedBefore) {
+        saveDayToSnapshot(fileName, mAllDay.mid(loadedBefore));
     }
-    qDebug() << "created Day* #" << mAllDay.size();
 }
 
 
 /*
  * save List of Day* to JSON cache
- * convert list of Day* to QVariantList
- * toCacheMap stores all properties without transient values
+ * convert list of Day* to QJsonArray
+ * one cache file per Conference: cacheDay_<conferenceId>.json
+ * only partitions with inserted, deleted or changed objects are written
+ * toCacheJson stores all properties without transient values
  * Day is read-only Cache - so it's not saved automatically at exit
  */
 void DataManager::saveDayToCache()
 {
-    QVariantList cacheList;
-    qDebug() << "now caching Day* #" << mAllDay.size();
     for (int i = 0; i < mAllDay.size(); ++i) {
         Day* day;
         day = (Day*)mAllDay.at(i);
-        QVariantMap cacheMap;
-        cacheMap = day->toCacheMap();
-        cacheList.append(cacheMap);
+        if (day->isDirty()) {
+            markDayPartitionDirty(day);
+        }
+    }
+    if (mDayDirtyPartitions.isEmpty()) {
+        qDebug() << "Day* unchanged - cache not written";
+        return;
+    }
+    // only changed partitions are written, without Day* they get an empty cache file
+    QMap<int, QList<QObject*> > partitions;
+    QSetIterator<int> dirtyIterator(mDayDirtyPartitions);
+    while (dirtyIterator.hasNext()) {
+        partitions.insert(dirtyIterator.next(), QList<QObject*>());
+    }
+    for (int i = 0; i < mAllDay.size(); ++i) {
+        Day* day;
+        day = (Day*)mAllDay.at(i);
+        QMap<int, QList<QObject*> >::iterator partition = partitions.find(partitionOf(day->conference()));
+        if (partition != partitions.end()) {
+            partition.value().append(day);
+        }
+    }
+    qDebug() << "now caching Day* Conferences #" << partitions.size() << "of" << mLoadedConferences.size();
+    QMapIterator<int, QList<QObject*> > partitionIterator(partitions);
+    while (partitionIterator.hasNext()) {
+        partitionIterator.next();
+        const QString fileName = partitionFileName(cacheDay, partitionIterator.key());
+        const QList<QObject*>& partition = partitionIterator.value();
+        // JSON or CBOR as selected in SettingsData
+        writeCacheData(fileName, CacheFormat::encodeObjects<Day>(partition, mCacheFormat));
+        for (int i = 0; i < partition.size(); ++i) {
+            Day* day;
+            day = (Day*)partition.at(i);
+            day->markAsClean();
+            mDayPartitionById.insert(day->id(), partitionIterator.key());
+        }
+        saveDayToSnapshot(fileName, partition);
+        mLoadedConferences.insert(partitionIterator.key());
     }
-    qDebug() << "Day* converted to JSON cache #" << cacheList.size();
-    writeToCache(cacheDay, cacheList);
+    mDayDirtyPartitions.clear();
 }
 
-
-
 /**
 * converts a list of keys in to a list of DataObjects
 * per ex. used to resolve lazy arrays
@@ -2685,25 +3430,33 @@ QList<Day*> DataManager::listOfDayForKeys(
         QStringList keyList)
 {
     QList<Day*> listOfData;
-    keyList.removeDuplicates();
     if (keyList.isEmpty()) {
         return listOfData;
     }
-    for (int i = 0; i < mAllDay.size(); ++i) {
-        Day* day;
-        day = (Day*) mAllDay.at(i);
-        if (keyList.contains(QString::number(day->id()))) {
-            listOfData.append(day);
-            keyList.removeOne(QString::number(day->id()));
-            if(keyList.isEmpty()){
-                break;
-            }
+    // each key parsed only once, resolved from hash index
+    // keeps the order of keyList, duplicates are skipped
+    listOfData.reserve(keyList.size());
+    QSet<int> resolvedKeys;
+    resolvedKeys.reserve(keyList.size());
+    QStringList missingKeys;
+    for (int i = 0; i < keyList.size(); ++i) {
+        bool ok = false;
+        int id = keyList.at(i).toInt(&ok);
+        Day* day = ok ? mDayById.value(id, 0) : 0;
+        if (!day) {
+            missingKeys.append(keyList.at(i));
+            continue;
         }
+        if (resolvedKeys.contains(id)) {
+            continue;
+        }
+        resolvedKeys.insert(id);
+        listOfData.append(day);
     }
-    if (keyList.isEmpty()) {
+    if (missingKeys.isEmpty()) {
         return listOfData;
     }
-    qWarning() << "not all keys found for Day: " << keyList.join(", ");
+    qWarning() << "not all keys found for Day: " << missingKeys.join(", ");
     return listOfData;
 }
 
@@ -2738,6 +3491,8 @@ void DataManager::appendToDayProperty(
     if (dataManagerObject) {
         day->setParent(dataManagerObject);
         dataManagerObject->mAllDay.append(day);
+        dataManagerObject->mDayById.insert(day->id(), day);
+        dataManagerObject->markDayPartitionDirty(day);
         emit dataManagerObject->addedToAllDay(day);
     } else {
         qWarning() << "cannot append Day* to mAllDay "
@@ -2785,6 +3540,8 @@ void DataManager::clearDayProperty(
             day = 0;
         }
         dataManager->mAllDay.clear();
+        dataManager->mDayById.clear();
+        dataManager->mDayDirtyPartitions.unite(dataManager->mLoadedConferences);
     } else {
         qWarning() << "cannot clear mAllDay " << "Object is not of type DataManager*";
     }
@@ -2806,6 +3563,8 @@ void DataManager::deleteDay()
         day = 0;
      }
      mAllDay.clear();
+     mDayById.clear();
+     mDayDirtyPartitions.unite(mLoadedConferences);
 }
 
 /**
@@ -2843,6 +3602,8 @@ void DataManager::insertDay(Day* day)
     // Important: DataManager must be parent of all root DTOs
     day->setParent(this);
     mAllDay.append(day);
+    mDayById.insert(day->id(), day);
+    markDayPartitionDirty(day);
     emit addedToAllDay(day);
     emit dayPropertyListChanged();
 }
@@ -2858,6 +3619,8 @@ void DataManager::insertDayFromMap(const QVariantMap& dayMap,
         day->fillFromMap(dayMap);
     }
     mAllDay.append(day);
+    mDayById.insert(day->id(), day);
+    markDayPartitionDirty(day);
     emit addedToAllDay(day);
     dayPropertyListChanged();
 }
@@ -2869,6 +3632,10 @@ bool DataManager::deleteDay(Day* day)
     if (!ok) {
         return ok;
     }
+    markDayPartitionDirty(day);
+    if (mDayById.value(day->id()) == day) {
+        mDayById.remove(day->id());
+    }
     emit deletedFromAllDayById(day->id());
     emit deletedFromAllDay(day);
     emit dayPropertyListChanged();
@@ -2880,11 +3647,16 @@ bool DataManager::deleteDay(Day* day)
 
 bool DataManager::deleteDayById(const int& id)
 {
+    if (!mDayById.contains(id)) {
+        return false;
+    }
     for (int i = 0; i < mAllDay.size(); ++i) {
         Day* day;
         day = (Day*) mAllDay.at(i);
         if (day->id() == id) {
             mAllDay.removeAt(i);
+            mDayById.remove(id);
+            markDayPartitionDirty(day);
             emit deletedFromAllDayById(id);
             emit deletedFromAllDay(day);
             emit dayPropertyListChanged();
@@ -2899,15 +3671,26 @@ bool DataManager::deleteDayById(const int& id)
 
 // nr is DomainKey
 Day* DataManager::findDayById(const int& id){
+    Day* day = mDayById.value(id, 0);
+    if (!day) {
+        qDebug() << "no Day found for id " << id;
+    }
+    return day;
+}
+
+/*
+ * rebuilds the hash index used by findDayById
+ * from current List of Day*
+ */
+void DataManager::rebuildDayIndex()
+{
+    mDayById.clear();
+    mDayById.reserve(mAllDay.size());
     for (int i = 0; i < mAllDay.size(); ++i) {
         Day* day;
         day = (Day*)mAllDay.at(i);
-        if(day->id() == id){
-            return day;
-        }
+        mDayById.insert(day->id(), day);
     }
-    qDebug() << "no Day found for id " << id;
-    return 0;
 }
 
 /*
@@ -4050,6 +4833,7 @@ SettingsData* DataManager::settingsData()
 
 void DataManager::readSettings()
 {
+    StartupPhase phase(QStringLiteral("readSettings"));
     qDebug() << "Read the Settings File";
     mSettingsData = new SettingsData();
     mSettingsData->setParent(this);
@@ -4094,12 +4878,18 @@ void DataManager::readSettings()
     }
     // create SettingsData* from JSON
     mSettingsData->fillFromMap(jda.toVariant().toMap());
+    // same as settings file
+    mSettingsData->markAsClean();
     isProductionEnvironment = mSettingsData->isProductionEnvironment();
     qDebug() << "Settings* created";
 }
 
 void DataManager::saveSettings()
 {
+    if (!mSettingsData->isDirty() && QFile::exists(mSettingsPath)) {
+        qDebug() << "Settings unchanged - not saved";
+        return;
+    }
     qDebug() << "Save the Settings";
     // convert Settings* into JSONDocument and store to app data
     QJsonDocument jda = QJsonDocument::fromVariant(mSettingsData->toMap());
@@ -4112,16 +4902,17 @@ void DataManager::saveSettings()
     qint64 bytesWritten = saveFile.write(jda.toJson());
     saveFile.close();
     qDebug() << "SettingsData Bytes written: " << bytesWritten;
+    mSettingsData->markAsClean();
 }
 
 /*
- * reads data in from stored cache
+ * reads content of stored cache (JSON or CBOR)
  * if no cache found tries to get data from assets/datamodel
+ * empty if there's nothing cached
  */
-QVariantList DataManager::readFromCache(const QString& fileName)
+QByteArray DataManager::readCacheData(const QString& fileName)
 {
-    QJsonDocument jda;
-    QVariantList cacheList;
+    QByteArray cacheData;
     QString cacheFilePath = dataPath(fileName);
     QFile dataFile(cacheFilePath);
     // check if already something cached
@@ -4136,7 +4927,7 @@ QVariantList DataManager::readFromCache(const QString& fileName)
             bool copyOk = dataAssetsFile.copy(cacheFilePath);
             if (!copyOk) {
                 qDebug() << "cannot copy " << dataAssetsFilePath << " to " << cacheFilePath;
-                return cacheList;
+                return cacheData;
             }
             if(!mSettingsData->hasPublicCache()) {
                 // IMPORTANT !!! copying from RESOURCES ":/data-assets/" to AppDataLocation
@@ -4145,39 +4936,75 @@ QVariantList DataManager::readFromCache(const QString& fileName)
                 copyOk = dataFile.setPermissions(QFileDevice::ReadUser | QFileDevice::WriteUser);
                 if (!copyOk) {
                     qDebug() << "cannot set Permissions to read / write settings";
-                    return cacheList;
+                    return cacheData;
                 }
             }
         } else {
             // no cache, no prefilled data-assets - empty list
-            return cacheList;
+            return cacheData;
         }
     }
     if (!dataFile.open(QIODevice::ReadOnly)) {
         qWarning() << "Couldn't open file: " << cacheFilePath;
-        return cacheList;
+        return cacheData;
     }
-    jda = QJsonDocument::fromJson(dataFile.readAll());
+    cacheData = dataFile.readAll();
     dataFile.close();
-    if(!jda.isArray()) {
-        qWarning() << "Couldn't create JSON Array from file: " << cacheFilePath;
-        return cacheList;
+    return cacheData;
+}
+
+/*
+ * reads data in from stored cache
+ * typed access: no conversion into QVariantList
+ */
+QJsonArray DataManager::readJsonArrayFromCache(const QString& fileName)
+{
+    const QByteArray cacheData = readCacheData(fileName);
+    if (cacheData.isEmpty()) {
+        return QJsonArray();
+    }
+    // JSON or CBOR - detected from content
+    bool ok = false;
+    const QJsonArray cacheArray = CacheFormat::decode(cacheData, &ok);
+    if(!ok) {
+        qWarning() << "Couldn't create Array from file: " << dataPath(fileName);
     }
-    cacheList = jda.toVariant().toList();
-    return cacheList;
+    return cacheArray;
+}
+
+/*
+ * reads data in from stored cache as QVariantList
+ */
+QVariantList DataManager::readFromCache(const QString& fileName)
+{
+    return readJsonArrayFromCache(fileName).toVariantList();
 }
 
 void DataManager::writeToCache(const QString& fileName, QVariantList& data)
+{
+    writeJsonArrayToCache(fileName, QJsonArray::fromVariantList(data));
+}
+
+/*
+ * writes JSON (compact or indented) or CBOR
+ * as selected in SettingsData
+ */
+void DataManager::writeJsonArrayToCache(const QString& fileName, const QJsonArray& data)
+{
+    writeCacheData(fileName, CacheFormat::encode(data, mCacheFormat));
+}
+
+// content already encoded: CacheFormat::encode() or encodeObjects()
+void DataManager::writeCacheData(const QString& fileName, const QByteArray& data)
 {
     QString cacheFilePath = dataPath(fileName);
-    QJsonDocument jda = QJsonDocument::fromVariant(data);
 
     QFile saveFile(cacheFilePath);
     if (!saveFile.open(QIODevice::WriteOnly)) {
         qWarning() << "Couldn't open file to write " << cacheFilePath;
         return;
     }
-    qint64 bytesWritten = saveFile.write(jda.toJson(mCompactJson?QJsonDocument::Compact:QJsonDocument::Indented));
+    qint64 bytesWritten = saveFile.write(data);
     saveFile.close();
     qDebug() << "Data Bytes written: " << bytesWritten << " to: " << cacheFilePath;
 }
@@ -4,7 +4,11 @@
 #include <qobject.h>
 #include <QQmlListProperty>
 #include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QJsonArray>
 
+#include "../cacheformat.hpp"
 #include "SettingsData.hpp"
 #include "Conference.hpp"
 #include "Room.hpp"
@@ -44,10 +48,21 @@ public:
 	
 	friend class DataUtil;
 	friend class DataServer;
+	// benchmarks/datalayerbenchmark
+	friend class DataLayerBenchmark;
 	
     virtual ~DataManager();
     Q_INVOKABLE
     void init();
+
+    // Room, Session, SessionTrack and Day are cached per Conference
+    // and loaded lazily: at startup only the current Conference
+    Q_INVOKABLE
+    bool isConferenceLoaded(const int conferenceId);
+
+    Q_INVOKABLE
+    void loadConference(const int conferenceId);
+
 	bool checkDirs();
 
 	
@@ -590,13 +605,17 @@ public:
 
     void initConferenceFromCache();
     void initRoomFromCache();
+    void initRoomPartitionFromCache(const int conferenceId);
     void initSessionFromCache();
+    void initSessionPartitionFromCache(const int conferenceId);
     void initFavoriteFromCache();
     void initSessionListsFromCache();
     void initSpeakerFromCache();
     void initSpeakerImageFromCache();
     void initSessionTrackFromCache();
+    void initSessionTrackPartitionFromCache(const int conferenceId);
     void initDayFromCache();
+    void initDayPartitionFromCache(const int conferenceId);
     void initSessionAPIFromCache();
     void initPersonsAPIFromCache();
     void initSessionTrackAPIFromCache();
@@ -670,15 +689,22 @@ private:
 	QString mDataAssetsPath;
 	QString dataAssetsPath(const QString& fileName);
 	QString dataPath(const QString& fileName);
+	QString snapshotPath(const QString& fileName);
 
 	SettingsData* mSettingsData;
 	void readSettings();
 	void saveSettings();
 	bool mCompactJson;
+	CacheFormat::Format mCacheFormat;
 	// DataObject stored in List of QObject*
 	// GroupDataModel only supports QObject*
     	
     QList<QObject*> mAllConference;
+    // hash index: domain key -> Conference* (must not change after insert)
+    QHash<int, Conference*> mConferenceById;
+    void rebuildConferenceIndex();
+    // cache file must be written: list of Conference* was changed
+    bool mConferenceCacheDirty;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Conference*
     static void appendToConferenceProperty(
@@ -692,6 +718,14 @@ private:
     	QQmlListProperty<Conference> *conferenceList);
     	
     QList<QObject*> mAllRoom;
+    // hash index: domain key -> Room* (must not change after insert)
+    QHash<int, Room*> mRoomByRoomId;
+    void rebuildRoomIndex();
+    void appendRoomFromCache(const QString& fileName);
+    // partitions (Conference ids) to be written: Room* inserted, deleted or changed
+    QSet<int> mRoomDirtyPartitions;
+    // partition each Room* was read from or written to
+    QHash<int, int> mRoomPartitionByRoomId;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Room*
     static void appendToRoomProperty(
@@ -705,6 +739,14 @@ private:
     	QQmlListProperty<Room> *roomList);
     	
     QList<QObject*> mAllSession;
+    // hash index: domain key -> Session* (must not change after insert)
+    QHash<int, Session*> mSessionBySessionId;
+    void rebuildSessionIndex();
+    void appendSessionFromCache(const QString& fileName);
+    // partitions (Conference ids) to be written: Session* inserted, deleted or changed
+    QSet<int> mSessionDirtyPartitions;
+    // partition each Session* was read from or written to
+    QHash<int, int> mSessionPartitionBySessionId;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Session*
     static void appendToSessionProperty(
@@ -718,6 +760,11 @@ private:
     	QQmlListProperty<Session> *sessionList);
     	
     QList<QObject*> mAllFavorite;
+    // hash index: domain key -> Favorite* (must not change after insert)
+    QHash<int, Favorite*> mFavoriteBySessionId;
+    void rebuildFavoriteIndex();
+    // cache file must be written: list of Favorite* was changed
+    bool mFavoriteCacheDirty;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Favorite*
     static void appendToFavoriteProperty(
@@ -744,6 +791,11 @@ private:
     	QQmlListProperty<SessionLists> *sessionListsList);
     	
     QList<QObject*> mAllSpeaker;
+    // hash index: domain key -> Speaker* (must not change after insert)
+    QHash<int, Speaker*> mSpeakerBySpeakerId;
+    void rebuildSpeakerIndex();
+    // cache file must be written: list of Speaker* was changed
+    bool mSpeakerCacheDirty;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Speaker*
     static void appendToSpeakerProperty(
@@ -757,6 +809,11 @@ private:
     	QQmlListProperty<Speaker> *speakerList);
     	
     QList<QObject*> mAllSpeakerImage;
+    // hash index: domain key -> SpeakerImage* (must not change after insert)
+    QHash<int, SpeakerImage*> mSpeakerImageBySpeakerId;
+    void rebuildSpeakerImageIndex();
+    // cache file must be written: list of SpeakerImage* was changed
+    bool mSpeakerImageCacheDirty;
     // implementation for QQmlListProperty to use
     // QML functions for List of All SpeakerImage*
     static void appendToSpeakerImageProperty(
@@ -770,6 +827,14 @@ private:
     	QQmlListProperty<SpeakerImage> *speakerImageList);
     	
     QList<QObject*> mAllSessionTrack;
+    // hash index: domain key -> SessionTrack* (must not change after insert)
+    QHash<int, SessionTrack*> mSessionTrackByTrackId;
+    void rebuildSessionTrackIndex();
+    void appendSessionTrackFromCache(const QString& fileName);
+    // partitions (Conference ids) to be written: SessionTrack* inserted, deleted or changed
+    QSet<int> mSessionTrackDirtyPartitions;
+    // partition each SessionTrack* was read from or written to
+    QHash<int, int> mSessionTrackPartitionByTrackId;
     // implementation for QQmlListProperty to use
     // QML functions for List of All SessionTrack*
     static void appendToSessionTrackProperty(
@@ -783,6 +848,14 @@ private:
     	QQmlListProperty<SessionTrack> *sessionTrackList);
     	
     QList<QObject*> mAllDay;
+    // hash index: domain key -> Day* (must not change after insert)
+    QHash<int, Day*> mDayById;
+    void rebuildDayIndex();
+    void appendDayFromCache(const QString& fileName);
+    // partitions (Conference ids) to be written: Day* inserted, deleted or changed
+    QSet<int> mDayDirtyPartitions;
+    // partition each Day* was read from or written to
+    QHash<int, int> mDayPartitionById;
     // implementation for QQmlListProperty to use
     // QML functions for List of All Day*
     static void appendToDayProperty(
@@ -863,8 +936,50 @@ private:
     void saveSpeakerAPIToCache();
 
 
+    // binary snapshots of cached DTOs (memory mapped, without QVariantMaps)
+    // init: appends to mAllXYZ, false if there's no valid snapshot of the cache file
+    // save: must be called after the cache file was written
+    // not generated: implemented in cpp/datamanagersnapshot.cpp
+    bool initConferenceFromSnapshot(const QString& fileName);
+    void saveConferenceToSnapshot(const QString& fileName, const QList<QObject*>& conferences);
+    bool initRoomFromSnapshot(const QString& fileName);
+    void saveRoomToSnapshot(const QString& fileName, const QList<QObject*>& rooms);
+    bool initSessionFromSnapshot(const QString& fileName);
+    void saveSessionToSnapshot(const QString& fileName, const QList<QObject*>& sessions);
+    bool initFavoriteFromSnapshot(const QString& fileName);
+    void saveFavoriteToSnapshot(const QString& fileName, const QList<QObject*>& favorites);
+    bool initSpeakerFromSnapshot(const QString& fileName);
+    void saveSpeakerToSnapshot(const QString& fileName, const QList<QObject*>& speakers);
+    bool initSpeakerImageFromSnapshot(const QString& fileName);
+    void saveSpeakerImageToSnapshot(const QString& fileName, const QList<QObject*>& speakerImages);
+    bool initSessionTrackFromSnapshot(const QString& fileName);
+    void saveSessionTrackToSnapshot(const QString& fileName, const QList<QObject*>& sessionTracks);
+    bool initDayFromSnapshot(const QString& fileName);
+    void saveDayToSnapshot(const QString& fileName, const QList<QObject*>& days);
+
 	QVariantList readFromCache(const QString& fileName);
 	void writeToCache(const QString& fileName, QVariantList& data);
+
+    // not generated: dirty tracking and partitions are hand-maintained, see gen-model/README.md
+    // Conferences with Room, Session, SessionTrack, Day in memory
+    // (partition 0: not assigned to a Conference, always loaded)
+    QSet<int> mLoadedConferences;
+    void initConferencePartitions();
+    bool migrateToConferencePartitions();
+    QString partitionFileName(const QString& fileName, const int conferenceId);
+    int partitionOf(const int conferenceId);
+    int partitionOfSession(Session* session);
+    void markRoomPartitionDirty(Room* room);
+    void markSessionPartitionDirty(Session* session);
+    void markSessionTrackPartitionDirty(SessionTrack* sessionTrack);
+    void markDayPartitionDirty(Day* day);
+    void resolveSpeakerSessionsAgain(const QList<QObject*>& loadedSessions);
+
+	QJsonArray readJsonArrayFromCache(const QString& fileName);
+	void writeJsonArrayToCache(const QString& fileName, const QJsonArray& data);
+	// raw file content: decoded / encoded by CacheFormat
+	QByteArray readCacheData(const QString& fileName);
+	void writeCacheData(const QString& fileName, const QByteArray& data);
 };
 
 #endif /* DATAMANAGER_HPP_ */
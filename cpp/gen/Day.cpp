@@ -1,4 +1,5 @@
 #include "Day.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 // target also references to this
@@ -22,7 +23,7 @@ static const QString sessionsForeignKey = "sessions";
  * Default Constructor if Day not initialized from QVariantMap
  */
 Day::Day(QObject *parent) :
-        QObject(parent), mId(-1), mConference(0), mWeekDay(0)
+        QObject(parent), mIsDirty(false), mId(-1), mConference(0), mWeekDay(0)
 {
 	// Date, Time or Timestamp ? construct null value
 	mConferenceDay = QDate();
@@ -64,6 +65,8 @@ void Day::fillFromMap(const QVariantMap& dayMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -91,6 +94,8 @@ void Day::fillFromForeignMap(const QVariantMap& dayMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -118,6 +123,7 @@ void Day::fillFromCacheMap(const QVariantMap& dayMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	mIsDirty = false;
 }
 
 void Day::prepareNew()
@@ -213,6 +219,17 @@ QVariantMap Day::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool Day::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Day::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // ATT 
 // Mandatory: id
 // Domain KEY: id
@@ -225,6 +242,7 @@ void Day::setId(int id)
 {
 	if (id != mId) {
 		mId = id;
+		mIsDirty = true;
 		emit idChanged(id);
 	}
 }
@@ -239,6 +257,7 @@ void Day::setConference(int conference)
 {
 	if (conference != mConference) {
 		mConference = conference;
+		mIsDirty = true;
 		emit conferenceChanged(conference);
 	}
 }
@@ -253,6 +272,7 @@ void Day::setWeekDay(int weekDay)
 {
 	if (weekDay != mWeekDay) {
 		mWeekDay = weekDay;
+		mIsDirty = true;
 		emit weekDayChanged(weekDay);
 	}
 }
@@ -275,6 +295,7 @@ void Day::setConferenceDay(QDate conferenceDay)
 {
 	if (conferenceDay != mConferenceDay) {
 		mConferenceDay = conferenceDay;
+		mIsDirty = true;
 		emit conferenceDayChanged(conferenceDay);
 	}
 }
@@ -318,6 +339,7 @@ QVariantList Day::sessionsAsForeignQVariantList()
 void Day::addToSessions(Session* session)
 {
     mSessions.append(session);
+    mIsDirty = true;
     emit addedToSessions(session);
     emit sessionsPropertyListChanged();
 }
@@ -330,6 +352,7 @@ bool Day::removeFromSessions(Session* session)
     	qDebug() << "Session* not found in sessions";
     	return false;
     }
+    mIsDirty = true;
     emit sessionsPropertyListChanged();
     // sessions are independent - DON'T delete them
     return true;
@@ -340,6 +363,7 @@ void Day::clearSessions()
         removeFromSessions(mSessions.last());
     }
     mSessionsKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -372,9 +396,12 @@ void Day::resolveSessionsKeys(QList<Session*> sessions)
         return;
     }
     // don't clear mSessions (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < sessions.size(); ++i) {
         addToSessions(sessions.at(i));
     }
+    mIsDirty = wasDirty;
     mSessionsKeysResolved = true;
 }
 
@@ -390,6 +417,7 @@ void Day::setSessions(QList<Session*> sessions)
 {
 	if (sessions != mSessions) {
 		mSessions = sessions;
+		mIsDirty = true;
 		emit sessionsChanged(sessions);
 		emit sessionsPropertyListChanged();
 	}
@@ -417,6 +445,7 @@ void Day::appendToSessionsProperty(QQmlListProperty<Session> *sessionsList,
     Day *dayObject = qobject_cast<Day *>(sessionsList->object);
     if (dayObject) {
         dayObject->mSessions.append(session);
+        dayObject->mIsDirty = true;
         emit dayObject->addedToSessions(session);
     } else {
         qWarning() << "cannot append Session* to sessions " << "Object is not of type Day*";
@@ -452,6 +481,7 @@ void Day::clearSessionsProperty(QQmlListProperty<Session> *sessionsList)
     if (day) {
         // sessions are independent - DON'T delete them
         day->mSessions.clear();
+        day->mIsDirty = true;
     } else {
         qWarning() << "cannot clear sessions " << "Object is not of type Day*";
     }
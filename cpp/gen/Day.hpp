@@ -2,7 +2,11 @@
 #define DAY_HPP_
 
 #include <QObject>
+#include <QJsonObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
 #include <qvariant.h>
+#include <QDataStream>
 #include <QQmlListProperty>
 #include <QStringList>
 #include <QDate>
@@ -43,6 +47,24 @@ public:
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
 
+	// binary cache snapshot
+	// not generated: implemented in cpp/cachedatastream.cpp
+	void fillFromSnapshot(QDataStream& in);
+	void toSnapshot(QDataStream& out);
+	// typed JSON cache without QVariantMap
+	// not generated: implemented in cpp/cachejson.cpp
+	void fillFromCacheJson(const QJsonObject& dayObject);
+	QJsonObject toCacheJson();
+	// CBOR cache streamed into / from the typed fields
+	// not generated: implemented in cpp/cachecbor.cpp
+	void fillFromCacheCbor(QCborStreamReader& reader);
+	void toCacheCbor(QCborStreamWriter& writer);
+
+	// dirty: a persisted property was changed since read from or written to cache
+	// not generated: hand-maintained hooks, see gen-model/README.md
+	bool isDirty() const;
+	void markAsClean();
+
 	int id() const;
 	void setId(int id);
 	int conference() const;
@@ -111,6 +133,7 @@ public:
 
 private:
 
+	bool mIsDirty;
 	int mId;
 	int mConference;
 	int mWeekDay;
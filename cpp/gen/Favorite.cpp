@@ -1,4 +1,5 @@
 #include "Favorite.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 
@@ -16,7 +17,7 @@ static const QString sessionForeignKey = "session";
  * Default Constructor if Favorite not initialized from QVariantMap
  */
 Favorite::Favorite(QObject *parent) :
-        QObject(parent), mSessionId(-1), mConference(0)
+        QObject(parent), mIsDirty(false), mSessionId(-1), mConference(0)
 {
 	// lazy references:
 	mSession = -1;
@@ -50,6 +51,8 @@ void Favorite::fillFromMap(const QVariantMap& favoriteMap)
 			// resolve the corresponding Data Object on demand from DataManager
 		}
 	}
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -69,6 +72,8 @@ void Favorite::fillFromForeignMap(const QVariantMap& favoriteMap)
 			// resolve the corresponding Data Object on demand from DataManager
 		}
 	}
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -88,6 +93,7 @@ void Favorite::fillFromCacheMap(const QVariantMap& favoriteMap)
 			// resolve the corresponding Data Object on demand from DataManager
 		}
 	}
+	mIsDirty = false;
 }
 
 void Favorite::prepareNew()
@@ -155,6 +161,17 @@ QVariantMap Favorite::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool Favorite::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Favorite::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // REF
 // Lazy: session
 // Mandatory: session
@@ -178,6 +195,7 @@ void Favorite::setSession(int session)
         // set the new lazy reference
         mSession = session;
         mSessionInvalid = false;
+        mIsDirty = true;
         emit sessionChanged(session);
         if (session != -1) {
             // resolve the corresponding Data Object on demand from DataManager
@@ -234,6 +252,7 @@ void Favorite::setSessionId(int sessionId)
 {
 	if (sessionId != mSessionId) {
 		mSessionId = sessionId;
+		mIsDirty = true;
 		emit sessionIdChanged(sessionId);
 	}
 }
@@ -248,6 +267,7 @@ void Favorite::setConference(int conference)
 {
 	if (conference != mConference) {
 		mConference = conference;
+		mIsDirty = true;
 		emit conferenceChanged(conference);
 	}
 }
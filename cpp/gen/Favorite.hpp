@@ -2,7 +2,11 @@
 #define FAVORITE_HPP_
 
 #include <QObject>
+#include <QJsonObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
 #include <qvariant.h>
+#include <QDataStream>
 
 
 #include "Session.hpp"
@@ -38,6 +42,24 @@ public:
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
 
+	// binary cache snapshot
+	// not generated: implemented in cpp/cachedatastream.cpp
+	void fillFromSnapshot(QDataStream& in);
+	void toSnapshot(QDataStream& out);
+	// typed JSON cache without QVariantMap
+	// not generated: implemented in cpp/cachejson.cpp
+	void fillFromCacheJson(const QJsonObject& favoriteObject);
+	QJsonObject toCacheJson();
+	// CBOR cache streamed into / from the typed fields
+	// not generated: implemented in cpp/cachecbor.cpp
+	void fillFromCacheCbor(QCborStreamReader& reader);
+	void toCacheCbor(QCborStreamWriter& writer);
+
+	// dirty: a persisted property was changed since read from or written to cache
+	// not generated: hand-maintained hooks, see gen-model/README.md
+	bool isDirty() const;
+	void markAsClean();
+
 	int sessionId() const;
 	void setSessionId(int sessionId);
 	int conference() const;
@@ -78,6 +100,7 @@ public:
 
 private:
 
+	bool mIsDirty;
 	int mSessionId;
 	int mConference;
 	int mSession;
@@ -1,4 +1,5 @@
 #include "Room.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 // target also references to this
@@ -22,7 +23,7 @@ static const QString sessionsForeignKey = "sessions";
  * Default Constructor if Room not initialized from QVariantMap
  */
 Room::Room(QObject *parent) :
-        QObject(parent), mRoomId(-1), mConference(0), mRoomName(""), mInAssets(false)
+        QObject(parent), mIsDirty(false), mRoomId(-1), mConference(0), mRoomName(""), mInAssets(false)
 {
 		// lazy Arrays where only keys are persisted
 		mSessionsKeysResolved = false;
@@ -54,6 +55,8 @@ void Room::fillFromMap(const QVariantMap& roomMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -73,6 +76,8 @@ void Room::fillFromForeignMap(const QVariantMap& roomMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -92,6 +97,7 @@ void Room::fillFromCacheMap(const QVariantMap& roomMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	mIsDirty = false;
 }
 
 void Room::prepareNew()
@@ -183,6 +189,17 @@ QVariantMap Room::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool Room::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Room::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // ATT 
 // Mandatory: roomId
 // Domain KEY: roomId
@@ -195,6 +212,7 @@ void Room::setRoomId(int roomId)
 {
 	if (roomId != mRoomId) {
 		mRoomId = roomId;
+		mIsDirty = true;
 		emit roomIdChanged(roomId);
 	}
 }
@@ -209,6 +227,7 @@ void Room::setConference(int conference)
 {
 	if (conference != mConference) {
 		mConference = conference;
+		mIsDirty = true;
 		emit conferenceChanged(conference);
 	}
 }
@@ -223,6 +242,7 @@ void Room::setRoomName(QString roomName)
 {
 	if (roomName != mRoomName) {
 		mRoomName = roomName;
+		mIsDirty = true;
 		emit roomNameChanged(roomName);
 	}
 }
@@ -237,6 +257,7 @@ void Room::setInAssets(bool inAssets)
 {
 	if (inAssets != mInAssets) {
 		mInAssets = inAssets;
+		mIsDirty = true;
 		emit inAssetsChanged(inAssets);
 	}
 }
@@ -276,6 +297,7 @@ QVariantList Room::sessionsAsForeignQVariantList()
 void Room::addToSessions(Session* session)
 {
     mSessions.append(session);
+    mIsDirty = true;
     emit addedToSessions(session);
     emit sessionsPropertyListChanged();
 }
@@ -288,6 +310,7 @@ bool Room::removeFromSessions(Session* session)
     	qDebug() << "Session* not found in sessions";
     	return false;
     }
+    mIsDirty = true;
     emit sessionsPropertyListChanged();
     // sessions are independent - DON'T delete them
     return true;
@@ -298,6 +321,7 @@ void Room::clearSessions()
         removeFromSessions(mSessions.last());
     }
     mSessionsKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -330,9 +354,12 @@ void Room::resolveSessionsKeys(QList<Session*> sessions)
         return;
     }
     // don't clear mSessions (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < sessions.size(); ++i) {
         addToSessions(sessions.at(i));
     }
+    mIsDirty = wasDirty;
     mSessionsKeysResolved = true;
 }
 
@@ -348,6 +375,7 @@ void Room::setSessions(QList<Session*> sessions)
 {
 	if (sessions != mSessions) {
 		mSessions = sessions;
+		mIsDirty = true;
 		emit sessionsChanged(sessions);
 		emit sessionsPropertyListChanged();
 	}
@@ -375,6 +403,7 @@ void Room::appendToSessionsProperty(QQmlListProperty<Session> *sessionsList,
     Room *roomObject = qobject_cast<Room *>(sessionsList->object);
     if (roomObject) {
         roomObject->mSessions.append(session);
+        roomObject->mIsDirty = true;
         emit roomObject->addedToSessions(session);
     } else {
         qWarning() << "cannot append Session* to sessions " << "Object is not of type Room*";
@@ -410,6 +439,7 @@ void Room::clearSessionsProperty(QQmlListProperty<Session> *sessionsList)
     if (room) {
         // sessions are independent - DON'T delete them
         room->mSessions.clear();
+        room->mIsDirty = true;
     } else {
         qWarning() << "cannot clear sessions " << "Object is not of type Room*";
     }
@@ -1,4 +1,5 @@
 #include "Session.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 // target also references to this
@@ -74,7 +75,7 @@ static const QString roomForeignKey = "room";
  * Default Constructor if Session not initialized from QVariantMap
  */
 Session::Session(QObject *parent) :
-        QObject(parent), mSessionId(-1), mConference(0), mIsDeprecated(false), mSortKey(""), mIsTraining(false), mIsLightning(false), mIsKeynote(false), mIsSession(false), mIsCommunity(false), mIsUnconference(false), mIsMeeting(false), mIsGenericScheduleSession(false), mIsBreak(false), mIsLunch(false), mIsEvent(false), mIsRegistration(false), mTitle(""), mDescription(""), mSessionType(""), mMinutes(0), mAbstractText(""), mIsFavorite(false)
+        QObject(parent), mIsDirty(false), mSessionId(-1), mConference(0), mIsDeprecated(false), mSortKey(""), mIsTraining(false), mIsLightning(false), mIsKeynote(false), mIsSession(false), mIsCommunity(false), mIsUnconference(false), mIsMeeting(false), mIsGenericScheduleSession(false), mIsBreak(false), mIsLunch(false), mIsEvent(false), mIsRegistration(false), mTitle(""), mDescription(""), mSessionType(""), mMinutes(0), mAbstractText(""), mIsFavorite(false)
 {
 	// lazy references:
 	mSessionDay = -1;
@@ -186,6 +187,8 @@ void Session::fillFromMap(const QVariantMap& sessionMap)
 	// mSessionTracks must be resolved later if there are keys
 	mSessionTracksKeysResolved = (mSessionTracksKeys.size() == 0);
 	mSessionTracks.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -263,6 +266,8 @@ void Session::fillFromForeignMap(const QVariantMap& sessionMap)
 	// mSessionTracks must be resolved later if there are keys
 	mSessionTracksKeysResolved = (mSessionTracksKeys.size() == 0);
 	mSessionTracks.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -337,6 +342,7 @@ void Session::fillFromCacheMap(const QVariantMap& sessionMap)
 	// mSessionTracks must be resolved later if there are keys
 	mSessionTracksKeysResolved = (mSessionTracksKeys.size() == 0);
 	mSessionTracks.clear();
+	mIsDirty = false;
 }
 
 void Session::prepareNew()
@@ -595,6 +601,17 @@ QVariantMap Session::toCacheMap()
 	// excluded: mIsFavorite
 	return sessionMap;
 }
+
+bool Session::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Session::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // REF
 // Lazy: sessionDay
 // Mandatory: sessionDay
@@ -618,6 +635,7 @@ void Session::setSessionDay(int sessionDay)
         // set the new lazy reference
         mSessionDay = sessionDay;
         mSessionDayInvalid = false;
+        mIsDirty = true;
         emit sessionDayChanged(sessionDay);
         if (sessionDay != -1) {
             // resolve the corresponding Data Object on demand from DataManager
@@ -685,6 +703,7 @@ void Session::setRoom(int room)
         // set the new lazy reference
         mRoom = room;
         mRoomInvalid = false;
+        mIsDirty = true;
         emit roomChanged(room);
         if (room != -1) {
             // resolve the corresponding Data Object on demand from DataManager
@@ -741,6 +760,7 @@ void Session::setSessionId(int sessionId)
 {
 	if (sessionId != mSessionId) {
 		mSessionId = sessionId;
+		mIsDirty = true;
 		emit sessionIdChanged(sessionId);
 	}
 }
@@ -755,6 +775,7 @@ void Session::setConference(int conference)
 {
 	if (conference != mConference) {
 		mConference = conference;
+		mIsDirty = true;
 		emit conferenceChanged(conference);
 	}
 }
@@ -769,6 +790,7 @@ void Session::setIsDeprecated(bool isDeprecated)
 {
 	if (isDeprecated != mIsDeprecated) {
 		mIsDeprecated = isDeprecated;
+		mIsDirty = true;
 		emit isDeprecatedChanged(isDeprecated);
 	}
 }
@@ -783,6 +805,7 @@ void Session::setSortKey(QString sortKey)
 {
 	if (sortKey != mSortKey) {
 		mSortKey = sortKey;
+		mIsDirty = true;
 		emit sortKeyChanged(sortKey);
 	}
 }
@@ -797,6 +820,7 @@ void Session::setIsTraining(bool isTraining)
 {
 	if (isTraining != mIsTraining) {
 		mIsTraining = isTraining;
+		mIsDirty = true;
 		emit isTrainingChanged(isTraining);
 	}
 }
@@ -811,6 +835,7 @@ void Session::setIsLightning(bool isLightning)
 {
 	if (isLightning != mIsLightning) {
 		mIsLightning = isLightning;
+		mIsDirty = true;
 		emit isLightningChanged(isLightning);
 	}
 }
@@ -825,6 +850,7 @@ void Session::setIsKeynote(bool isKeynote)
 {
 	if (isKeynote != mIsKeynote) {
 		mIsKeynote = isKeynote;
+		mIsDirty = true;
 		emit isKeynoteChanged(isKeynote);
 	}
 }
@@ -839,6 +865,7 @@ void Session::setIsSession(bool isSession)
 {
 	if (isSession != mIsSession) {
 		mIsSession = isSession;
+		mIsDirty = true;
 		emit isSessionChanged(isSession);
 	}
 }
@@ -853,6 +880,7 @@ void Session::setIsCommunity(bool isCommunity)
 {
 	if (isCommunity != mIsCommunity) {
 		mIsCommunity = isCommunity;
+		mIsDirty = true;
 		emit isCommunityChanged(isCommunity);
 	}
 }
@@ -867,6 +895,7 @@ void Session::setIsUnconference(bool isUnconference)
 {
 	if (isUnconference != mIsUnconference) {
 		mIsUnconference = isUnconference;
+		mIsDirty = true;
 		emit isUnconferenceChanged(isUnconference);
 	}
 }
@@ -881,6 +910,7 @@ void Session::setIsMeeting(bool isMeeting)
 {
 	if (isMeeting != mIsMeeting) {
 		mIsMeeting = isMeeting;
+		mIsDirty = true;
 		emit isMeetingChanged(isMeeting);
 	}
 }
@@ -895,6 +925,7 @@ void Session::setIsGenericScheduleSession(bool isGenericScheduleSession)
 {
 	if (isGenericScheduleSession != mIsGenericScheduleSession) {
 		mIsGenericScheduleSession = isGenericScheduleSession;
+		mIsDirty = true;
 		emit isGenericScheduleSessionChanged(isGenericScheduleSession);
 	}
 }
@@ -909,6 +940,7 @@ void Session::setIsBreak(bool isBreak)
 {
 	if (isBreak != mIsBreak) {
 		mIsBreak = isBreak;
+		mIsDirty = true;
 		emit isBreakChanged(isBreak);
 	}
 }
@@ -923,6 +955,7 @@ void Session::setIsLunch(bool isLunch)
 {
 	if (isLunch != mIsLunch) {
 		mIsLunch = isLunch;
+		mIsDirty = true;
 		emit isLunchChanged(isLunch);
 	}
 }
@@ -937,6 +970,7 @@ void Session::setIsEvent(bool isEvent)
 {
 	if (isEvent != mIsEvent) {
 		mIsEvent = isEvent;
+		mIsDirty = true;
 		emit isEventChanged(isEvent);
 	}
 }
@@ -951,6 +985,7 @@ void Session::setIsRegistration(bool isRegistration)
 {
 	if (isRegistration != mIsRegistration) {
 		mIsRegistration = isRegistration;
+		mIsDirty = true;
 		emit isRegistrationChanged(isRegistration);
 	}
 }
@@ -965,6 +1000,7 @@ void Session::setTitle(QString title)
 {
 	if (title != mTitle) {
 		mTitle = title;
+		mIsDirty = true;
 		emit titleChanged(title);
 	}
 }
@@ -979,6 +1015,7 @@ void Session::setDescription(QString description)
 {
 	if (description != mDescription) {
 		mDescription = description;
+		mIsDirty = true;
 		emit descriptionChanged(description);
 	}
 }
@@ -993,6 +1030,7 @@ void Session::setSessionType(QString sessionType)
 {
 	if (sessionType != mSessionType) {
 		mSessionType = sessionType;
+		mIsDirty = true;
 		emit sessionTypeChanged(sessionType);
 	}
 }
@@ -1011,6 +1049,7 @@ void Session::setStartTime(QTime startTime)
 {
 	if (startTime != mStartTime) {
 		mStartTime = startTime;
+		mIsDirty = true;
 		emit startTimeChanged(startTime);
 	}
 }
@@ -1024,6 +1063,7 @@ void Session::setStartTimeFromPickerValue(QString startTimeValue)
     QTime startTime = QTime::fromString(startTimeValue.left(8), "HH:mm:ss");
     if (startTime != mStartTime) {
         mStartTime = startTime;
+        mIsDirty = true;
         emit startTimeChanged(startTime);
     }
 }
@@ -1046,6 +1086,7 @@ void Session::setEndTime(QTime endTime)
 {
 	if (endTime != mEndTime) {
 		mEndTime = endTime;
+		mIsDirty = true;
 		emit endTimeChanged(endTime);
 	}
 }
@@ -1059,6 +1100,7 @@ void Session::setEndTimeFromPickerValue(QString endTimeValue)
     QTime endTime = QTime::fromString(endTimeValue.left(8), "HH:mm:ss");
     if (endTime != mEndTime) {
         mEndTime = endTime;
+        mIsDirty = true;
         emit endTimeChanged(endTime);
     }
 }
@@ -1077,6 +1119,7 @@ void Session::setMinutes(int minutes)
 {
 	if (minutes != mMinutes) {
 		mMinutes = minutes;
+		mIsDirty = true;
 		emit minutesChanged(minutes);
 	}
 }
@@ -1091,6 +1134,7 @@ void Session::setAbstractText(QString abstractText)
 {
 	if (abstractText != mAbstractText) {
 		mAbstractText = abstractText;
+		mIsDirty = true;
 		emit abstractTextChanged(abstractText);
 	}
 }
@@ -1144,6 +1188,7 @@ QVariantList Session::presenterAsForeignQVariantList()
 void Session::addToPresenter(Speaker* speaker)
 {
     mPresenter.append(speaker);
+    mIsDirty = true;
     emit addedToPresenter(speaker);
     emit presenterPropertyListChanged();
 }
@@ -1156,6 +1201,7 @@ bool Session::removeFromPresenter(Speaker* speaker)
     	qDebug() << "Speaker* not found in presenter";
     	return false;
     }
+    mIsDirty = true;
     emit presenterPropertyListChanged();
     // presenter are independent - DON'T delete them
     return true;
@@ -1166,6 +1212,7 @@ void Session::clearPresenter()
         removeFromPresenter(mPresenter.last());
     }
     mPresenterKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -1198,12 +1245,39 @@ void Session::resolvePresenterKeys(QList<Speaker*> presenter)
         return;
     }
     // don't clear mPresenter (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < presenter.size(); ++i) {
         addToPresenter(presenter.at(i));
     }
+    mIsDirty = wasDirty;
     mPresenterKeysResolved = true;
 }
 
+/**
+ * per ex. data from server: keys are known, objects not (yet)
+ * to be resolved later by resolvePresenterKeys()
+ */
+void Session::setPresenterKeys(const QStringList& presenterKeys)
+{
+	if (mPresenterKeysResolved) {
+		QStringList currentKeys;
+		for (int i = 0; i < mPresenter.size(); ++i) {
+			currentKeys << QString::number(mPresenter.at(i)->speakerId());
+		}
+		if (currentKeys == presenterKeys) {
+			return;
+		}
+	} else if (mPresenterKeys == presenterKeys) {
+		return;
+	}
+	mPresenter.clear();
+	mPresenterKeys = presenterKeys;
+	// must be resolved later if there are keys
+	mPresenterKeysResolved = (mPresenterKeys.size() == 0);
+	mIsDirty = true;
+}
+
 int Session::presenterCount()
 {
     return mPresenter.size();
@@ -1216,6 +1290,7 @@ void Session::setPresenter(QList<Speaker*> presenter)
 {
 	if (presenter != mPresenter) {
 		mPresenter = presenter;
+		mIsDirty = true;
 		emit presenterChanged(presenter);
 		emit presenterPropertyListChanged();
 	}
@@ -1243,6 +1318,7 @@ void Session::appendToPresenterProperty(QQmlListProperty<Speaker> *presenterList
     Session *sessionObject = qobject_cast<Session *>(presenterList->object);
     if (sessionObject) {
         sessionObject->mPresenter.append(speaker);
+        sessionObject->mIsDirty = true;
         emit sessionObject->addedToPresenter(speaker);
     } else {
         qWarning() << "cannot append Speaker* to presenter " << "Object is not of type Session*";
@@ -1278,6 +1354,7 @@ void Session::clearPresenterProperty(QQmlListProperty<Speaker> *presenterList)
     if (session) {
         // presenter are independent - DON'T delete them
         session->mPresenter.clear();
+        session->mIsDirty = true;
     } else {
         qWarning() << "cannot clear presenter " << "Object is not of type Session*";
     }
@@ -1319,6 +1396,7 @@ QVariantList Session::sessionTracksAsForeignQVariantList()
 void Session::addToSessionTracks(SessionTrack* sessionTrack)
 {
     mSessionTracks.append(sessionTrack);
+    mIsDirty = true;
     emit addedToSessionTracks(sessionTrack);
     emit sessionTracksPropertyListChanged();
 }
@@ -1331,6 +1409,7 @@ bool Session::removeFromSessionTracks(SessionTrack* sessionTrack)
     	qDebug() << "SessionTrack* not found in sessionTracks";
     	return false;
     }
+    mIsDirty = true;
     emit sessionTracksPropertyListChanged();
     // sessionTracks are independent - DON'T delete them
     return true;
@@ -1341,6 +1420,7 @@ void Session::clearSessionTracks()
         removeFromSessionTracks(mSessionTracks.last());
     }
     mSessionTracksKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -1373,12 +1453,39 @@ void Session::resolveSessionTracksKeys(QList<SessionTrack*> sessionTracks)
         return;
     }
     // don't clear mSessionTracks (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < sessionTracks.size(); ++i) {
         addToSessionTracks(sessionTracks.at(i));
     }
+    mIsDirty = wasDirty;
     mSessionTracksKeysResolved = true;
 }
 
+/**
+ * per ex. data from server: keys are known, objects not (yet)
+ * to be resolved later by resolveSessionTracksKeys()
+ */
+void Session::setSessionTracksKeys(const QStringList& sessionTracksKeys)
+{
+	if (mSessionTracksKeysResolved) {
+		QStringList currentKeys;
+		for (int i = 0; i < mSessionTracks.size(); ++i) {
+			currentKeys << QString::number(mSessionTracks.at(i)->trackId());
+		}
+		if (currentKeys == sessionTracksKeys) {
+			return;
+		}
+	} else if (mSessionTracksKeys == sessionTracksKeys) {
+		return;
+	}
+	mSessionTracks.clear();
+	mSessionTracksKeys = sessionTracksKeys;
+	// must be resolved later if there are keys
+	mSessionTracksKeysResolved = (mSessionTracksKeys.size() == 0);
+	mIsDirty = true;
+}
+
 int Session::sessionTracksCount()
 {
     return mSessionTracks.size();
@@ -1391,6 +1498,7 @@ void Session::setSessionTracks(QList<SessionTrack*> sessionTracks)
 {
 	if (sessionTracks != mSessionTracks) {
 		mSessionTracks = sessionTracks;
+		mIsDirty = true;
 		emit sessionTracksChanged(sessionTracks);
 		emit sessionTracksPropertyListChanged();
 	}
@@ -1418,6 +1526,7 @@ void Session::appendToSessionTracksProperty(QQmlListProperty<SessionTrack> *sess
     Session *sessionObject = qobject_cast<Session *>(sessionTracksList->object);
     if (sessionObject) {
         sessionObject->mSessionTracks.append(sessionTrack);
+        sessionObject->mIsDirty = true;
         emit sessionObject->addedToSessionTracks(sessionTrack);
     } else {
         qWarning() << "cannot append SessionTrack* to sessionTracks " << "Object is not of type Session*";
@@ -1453,6 +1562,7 @@ void Session::clearSessionTracksProperty(QQmlListProperty<SessionTrack> *session
     if (session) {
         // sessionTracks are independent - DON'T delete them
         session->mSessionTracks.clear();
+        session->mIsDirty = true;
     } else {
         qWarning() << "cannot clear sessionTracks " << "Object is not of type Session*";
     }
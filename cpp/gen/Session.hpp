@@ -2,7 +2,11 @@
 #define SESSION_HPP_
 
 #include <QObject>
+#include <QJsonObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
 #include <qvariant.h>
+#include <QDataStream>
 #include <QQmlListProperty>
 #include <QStringList>
 #include <QTime>
@@ -77,6 +81,24 @@ public:
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
 
+	// binary cache snapshot
+	// not generated: implemented in cpp/cachedatastream.cpp
+	void fillFromSnapshot(QDataStream& in);
+	void toSnapshot(QDataStream& out);
+	// typed JSON cache without QVariantMap
+	// not generated: implemented in cpp/cachejson.cpp
+	void fillFromCacheJson(const QJsonObject& sessionObject);
+	QJsonObject toCacheJson();
+	// CBOR cache streamed into / from the typed fields
+	// not generated: implemented in cpp/cachecbor.cpp
+	void fillFromCacheCbor(QCborStreamReader& reader);
+	void toCacheCbor(QCborStreamWriter& writer);
+
+	// dirty: a persisted property was changed since read from or written to cache
+	// not generated: hand-maintained hooks, see gen-model/README.md
+	bool isDirty() const;
+	void markAsClean();
+
 	int sessionId() const;
 	void setSessionId(int sessionId);
 	int conference() const;
@@ -207,6 +229,9 @@ public:
 
 	Q_INVOKABLE
 	void resolvePresenterKeys(QList<Speaker*> presenter);
+
+	// replaces the keys - objects must be resolved later
+	void setPresenterKeys(const QStringList& presenterKeys);
 	
 	Q_INVOKABLE
 	int presenterCount();
@@ -245,6 +270,9 @@ public:
 
 	Q_INVOKABLE
 	void resolveSessionTracksKeys(QList<SessionTrack*> sessionTracks);
+
+	// replaces the keys - objects must be resolved later
+	void setSessionTracksKeys(const QStringList& sessionTracksKeys);
 	
 	Q_INVOKABLE
 	int sessionTracksCount();
@@ -302,6 +330,7 @@ public:
 
 private:
 
+	bool mIsDirty;
 	int mSessionId;
 	int mConference;
 	bool mIsDeprecated;
@@ -1,4 +1,5 @@
 #include "SessionLists.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 
@@ -238,6 +239,7 @@ QVariantMap SessionLists::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
 // ATT 
 // Mandatory: uuid
 // Domain KEY: uuid
@@ -319,6 +321,13 @@ bool SessionLists::removeFromScheduledSessions(Session* session)
     // scheduledSessions are independent - DON'T delete them
     return true;
 }
+
+void SessionLists::insertIntoScheduledSessions(int index, Session* session)
+{
+    mScheduledSessions.insert(index, session);
+    emit addedToScheduledSessions(session);
+    emit scheduledSessionsPropertyListChanged();
+}
 void SessionLists::clearScheduledSessions()
 {
     for (int i = mScheduledSessions.size(); i > 0; --i) {
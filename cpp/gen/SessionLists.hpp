@@ -2,6 +2,9 @@
 #define SESSIONLISTS_HPP_
 
 #include <QObject>
+#include <QJsonObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
 #include <qvariant.h>
 #include <QQmlListProperty>
 #include <QStringList>
@@ -41,6 +44,14 @@ public:
 	QVariantMap toMap();
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
+	// typed JSON cache without QVariantMap
+	// not generated: implemented in cpp/cachejson.cpp
+	void fillFromCacheJson(const QJsonObject& sessionListsObject);
+	QJsonObject toCacheJson();
+	// CBOR cache streamed into / from the typed fields
+	// not generated: implemented in cpp/cachecbor.cpp
+	void fillFromCacheCbor(QCborStreamReader& reader);
+	void toCacheCbor(QCborStreamWriter& writer);
 
 	QString uuid() const;
 	void setUuid(QString uuid);
@@ -64,6 +75,9 @@ public:
 	Q_INVOKABLE
 	bool removeFromScheduledSessions(Session* session);
 
+	// keeps a sorted list sorted
+	void insertIntoScheduledSessions(int index, Session* session);
+
 	Q_INVOKABLE
 	void clearScheduledSessions();
 
@@ -1,4 +1,5 @@
 #include "SessionTrack.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 // target also references to this
@@ -24,7 +25,7 @@ static const QString sessionsForeignKey = "sessions";
  * Default Constructor if SessionTrack not initialized from QVariantMap
  */
 SessionTrack::SessionTrack(QObject *parent) :
-        QObject(parent), mTrackId(-1), mConference(0), mName(""), mColor(""), mInAssets(false)
+        QObject(parent), mIsDirty(false), mTrackId(-1), mConference(0), mName(""), mColor(""), mInAssets(false)
 {
 		// lazy Arrays where only keys are persisted
 		mSessionsKeysResolved = false;
@@ -57,6 +58,8 @@ void SessionTrack::fillFromMap(const QVariantMap& sessionTrackMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -77,6 +80,8 @@ void SessionTrack::fillFromForeignMap(const QVariantMap& sessionTrackMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -97,6 +102,7 @@ void SessionTrack::fillFromCacheMap(const QVariantMap& sessionTrackMap)
 	// mSessions must be resolved later if there are keys
 	mSessionsKeysResolved = (mSessionsKeys.size() == 0);
 	mSessions.clear();
+	mIsDirty = false;
 }
 
 void SessionTrack::prepareNew()
@@ -190,6 +196,17 @@ QVariantMap SessionTrack::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool SessionTrack::isDirty() const
+{
+	return mIsDirty;
+}
+
+void SessionTrack::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // ATT 
 // Mandatory: trackId
 // Domain KEY: trackId
@@ -202,6 +219,7 @@ void SessionTrack::setTrackId(int trackId)
 {
 	if (trackId != mTrackId) {
 		mTrackId = trackId;
+		mIsDirty = true;
 		emit trackIdChanged(trackId);
 	}
 }
@@ -216,6 +234,7 @@ void SessionTrack::setConference(int conference)
 {
 	if (conference != mConference) {
 		mConference = conference;
+		mIsDirty = true;
 		emit conferenceChanged(conference);
 	}
 }
@@ -230,6 +249,7 @@ void SessionTrack::setName(QString name)
 {
 	if (name != mName) {
 		mName = name;
+		mIsDirty = true;
 		emit nameChanged(name);
 	}
 }
@@ -244,6 +264,7 @@ void SessionTrack::setColor(QString color)
 {
 	if (color != mColor) {
 		mColor = color;
+		mIsDirty = true;
 		emit colorChanged(color);
 	}
 }
@@ -258,6 +279,7 @@ void SessionTrack::setInAssets(bool inAssets)
 {
 	if (inAssets != mInAssets) {
 		mInAssets = inAssets;
+		mIsDirty = true;
 		emit inAssetsChanged(inAssets);
 	}
 }
@@ -297,6 +319,7 @@ QVariantList SessionTrack::sessionsAsForeignQVariantList()
 void SessionTrack::addToSessions(Session* session)
 {
     mSessions.append(session);
+    mIsDirty = true;
     emit addedToSessions(session);
     emit sessionsPropertyListChanged();
 }
@@ -309,6 +332,7 @@ bool SessionTrack::removeFromSessions(Session* session)
     	qDebug() << "Session* not found in sessions";
     	return false;
     }
+    mIsDirty = true;
     emit sessionsPropertyListChanged();
     // sessions are independent - DON'T delete them
     return true;
@@ -319,6 +343,7 @@ void SessionTrack::clearSessions()
         removeFromSessions(mSessions.last());
     }
     mSessionsKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -351,9 +376,12 @@ void SessionTrack::resolveSessionsKeys(QList<Session*> sessions)
         return;
     }
     // don't clear mSessions (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < sessions.size(); ++i) {
         addToSessions(sessions.at(i));
     }
+    mIsDirty = wasDirty;
     mSessionsKeysResolved = true;
 }
 
@@ -369,6 +397,7 @@ void SessionTrack::setSessions(QList<Session*> sessions)
 {
 	if (sessions != mSessions) {
 		mSessions = sessions;
+		mIsDirty = true;
 		emit sessionsChanged(sessions);
 		emit sessionsPropertyListChanged();
 	}
@@ -396,6 +425,7 @@ void SessionTrack::appendToSessionsProperty(QQmlListProperty<Session> *sessionsL
     SessionTrack *sessionTrackObject = qobject_cast<SessionTrack *>(sessionsList->object);
     if (sessionTrackObject) {
         sessionTrackObject->mSessions.append(session);
+        sessionTrackObject->mIsDirty = true;
         emit sessionTrackObject->addedToSessions(session);
     } else {
         qWarning() << "cannot append Session* to sessions " << "Object is not of type SessionTrack*";
@@ -431,6 +461,7 @@ void SessionTrack::clearSessionsProperty(QQmlListProperty<Session> *sessionsList
     if (sessionTrack) {
         // sessions are independent - DON'T delete them
         sessionTrack->mSessions.clear();
+        sessionTrack->mIsDirty = true;
     } else {
         qWarning() << "cannot clear sessions " << "Object is not of type SessionTrack*";
     }
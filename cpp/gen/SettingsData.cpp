@@ -16,6 +16,7 @@ static const QString defaultMarkerColorsKey = "defaultMarkerColors";
 static const QString markerColorsKey = "markerColors";
 static const QString hasPublicCacheKey = "hasPublicCache";
 static const QString useCompactJsonFormatKey = "useCompactJsonFormat";
+static const QString useCborCacheKey = "useCborCache";
 static const QString lastUsedNumberKey = "lastUsedNumber";
 static const QString publicRoot4DevKey = "publicRoot4Dev";
 static const QString autoUpdateKey = "autoUpdate";
@@ -39,6 +40,7 @@ static const QString defaultMarkerColorsForeignKey = "defaultMarkerColors";
 static const QString markerColorsForeignKey = "markerColors";
 static const QString hasPublicCacheForeignKey = "hasPublicCache";
 static const QString useCompactJsonFormatForeignKey = "useCompactJsonFormat";
+static const QString useCborCacheForeignKey = "useCborCache";
 static const QString lastUsedNumberForeignKey = "lastUsedNumber";
 static const QString publicRoot4DevForeignKey = "publicRoot4Dev";
 static const QString autoUpdateForeignKey = "autoUpdate";
@@ -52,7 +54,7 @@ static const QString classicStackNavigationForeignKey = "classicStackNavigation"
  * Default Constructor if SettingsData not initialized from QVariantMap
  */
 SettingsData::SettingsData(QObject *parent) :
-        QObject(parent), mId(-1), mVersion(0), mApiVersion(""), mIsProductionEnvironment(false), mPrimaryColor(0), mAccentColor(0), mDarkTheme(false), mUseMarkerColors(false), mDefaultMarkerColors(false), mMarkerColors(""), mHasPublicCache(false), mUseCompactJsonFormat(false), mLastUsedNumber(0), mPublicRoot4Dev(""), mAutoUpdate(false), mAutoUpdateEveryHours(0), mNavigationStyle(0), mOneMenuButton(false), mClassicStackNavigation(false)
+        QObject(parent), mIsDirty(false), mId(-1), mVersion(0), mApiVersion(""), mIsProductionEnvironment(false), mPrimaryColor(0), mAccentColor(0), mDarkTheme(false), mUseMarkerColors(false), mDefaultMarkerColors(false), mMarkerColors(""), mHasPublicCache(false), mUseCompactJsonFormat(false), mUseCborCache(false), mLastUsedNumber(0), mPublicRoot4Dev(""), mAutoUpdate(false), mAutoUpdateEveryHours(0), mNavigationStyle(0), mOneMenuButton(false), mClassicStackNavigation(false)
 {
 	// Date, Time or Timestamp ? construct null value
 	mLastUpdate = QDateTime();
@@ -89,6 +91,7 @@ void SettingsData::fillFromMap(const QVariantMap& settingsDataMap)
 	mMarkerColors = settingsDataMap.value(markerColorsKey).toString();
 	mHasPublicCache = settingsDataMap.value(hasPublicCacheKey).toBool();
 	mUseCompactJsonFormat = settingsDataMap.value(useCompactJsonFormatKey).toBool();
+	mUseCborCache = settingsDataMap.value(useCborCacheKey).toBool();
 	mLastUsedNumber = settingsDataMap.value(lastUsedNumberKey).toInt();
 	mPublicRoot4Dev = settingsDataMap.value(publicRoot4DevKey).toString();
 	mAutoUpdate = settingsDataMap.value(autoUpdateKey).toBool();
@@ -105,6 +108,8 @@ void SettingsData::fillFromMap(const QVariantMap& settingsDataMap)
 	mNavigationStyle = settingsDataMap.value(navigationStyleKey).toInt();
 	mOneMenuButton = settingsDataMap.value(oneMenuButtonKey).toBool();
 	mClassicStackNavigation = settingsDataMap.value(classicStackNavigationKey).toBool();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -136,6 +141,7 @@ void SettingsData::fillFromForeignMap(const QVariantMap& settingsDataMap)
 	mMarkerColors = settingsDataMap.value(markerColorsForeignKey).toString();
 	mHasPublicCache = settingsDataMap.value(hasPublicCacheForeignKey).toBool();
 	mUseCompactJsonFormat = settingsDataMap.value(useCompactJsonFormatForeignKey).toBool();
+	mUseCborCache = settingsDataMap.value(useCborCacheForeignKey).toBool();
 	mLastUsedNumber = settingsDataMap.value(lastUsedNumberForeignKey).toInt();
 	mPublicRoot4Dev = settingsDataMap.value(publicRoot4DevForeignKey).toString();
 	mAutoUpdate = settingsDataMap.value(autoUpdateForeignKey).toBool();
@@ -152,6 +158,8 @@ void SettingsData::fillFromForeignMap(const QVariantMap& settingsDataMap)
 	mNavigationStyle = settingsDataMap.value(navigationStyleForeignKey).toInt();
 	mOneMenuButton = settingsDataMap.value(oneMenuButtonForeignKey).toBool();
 	mClassicStackNavigation = settingsDataMap.value(classicStackNavigationForeignKey).toBool();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -183,6 +191,7 @@ void SettingsData::fillFromCacheMap(const QVariantMap& settingsDataMap)
 	mMarkerColors = settingsDataMap.value(markerColorsKey).toString();
 	mHasPublicCache = settingsDataMap.value(hasPublicCacheKey).toBool();
 	mUseCompactJsonFormat = settingsDataMap.value(useCompactJsonFormatKey).toBool();
+	mUseCborCache = settingsDataMap.value(useCborCacheKey).toBool();
 	mLastUsedNumber = settingsDataMap.value(lastUsedNumberKey).toInt();
 	mPublicRoot4Dev = settingsDataMap.value(publicRoot4DevKey).toString();
 	mAutoUpdate = settingsDataMap.value(autoUpdateKey).toBool();
@@ -199,6 +208,7 @@ void SettingsData::fillFromCacheMap(const QVariantMap& settingsDataMap)
 	mNavigationStyle = settingsDataMap.value(navigationStyleKey).toInt();
 	mOneMenuButton = settingsDataMap.value(oneMenuButtonKey).toBool();
 	mClassicStackNavigation = settingsDataMap.value(classicStackNavigationKey).toBool();
+	mIsDirty = false;
 }
 
 void SettingsData::prepareNew()
@@ -239,6 +249,7 @@ QVariantMap SettingsData::toMap()
 	settingsDataMap.insert(markerColorsKey, mMarkerColors);
 	settingsDataMap.insert(hasPublicCacheKey, mHasPublicCache);
 	settingsDataMap.insert(useCompactJsonFormatKey, mUseCompactJsonFormat);
+	settingsDataMap.insert(useCborCacheKey, mUseCborCache);
 	settingsDataMap.insert(lastUsedNumberKey, mLastUsedNumber);
 	settingsDataMap.insert(publicRoot4DevKey, mPublicRoot4Dev);
 	settingsDataMap.insert(autoUpdateKey, mAutoUpdate);
@@ -275,6 +286,7 @@ QVariantMap SettingsData::toForeignMap()
 	settingsDataMap.insert(markerColorsForeignKey, mMarkerColors);
 	settingsDataMap.insert(hasPublicCacheForeignKey, mHasPublicCache);
 	settingsDataMap.insert(useCompactJsonFormatForeignKey, mUseCompactJsonFormat);
+	settingsDataMap.insert(useCborCacheForeignKey, mUseCborCache);
 	settingsDataMap.insert(lastUsedNumberForeignKey, mLastUsedNumber);
 	settingsDataMap.insert(publicRoot4DevForeignKey, mPublicRoot4Dev);
 	settingsDataMap.insert(autoUpdateForeignKey, mAutoUpdate);
@@ -300,6 +312,16 @@ QVariantMap SettingsData::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool SettingsData::isDirty() const
+{
+	return mIsDirty;
+}
+
+void SettingsData::markAsClean()
+{
+	mIsDirty = false;
+}
 // ATT 
 // Mandatory: id
 // Domain KEY: id
@@ -312,6 +334,7 @@ void SettingsData::setId(int id)
 {
 	if (id != mId) {
 		mId = id;
+		mIsDirty = true;
 		emit idChanged(id);
 	}
 }
@@ -326,6 +349,7 @@ void SettingsData::setVersion(int version)
 {
 	if (version != mVersion) {
 		mVersion = version;
+		mIsDirty = true;
 		emit versionChanged(version);
 	}
 }
@@ -340,6 +364,7 @@ void SettingsData::setApiVersion(QString apiVersion)
 {
 	if (apiVersion != mApiVersion) {
 		mApiVersion = apiVersion;
+		mIsDirty = true;
 		emit apiVersionChanged(apiVersion);
 	}
 }
@@ -354,6 +379,7 @@ void SettingsData::setLastUpdate(QDateTime lastUpdate)
 {
 	if (lastUpdate != mLastUpdate) {
 		mLastUpdate = lastUpdate;
+		mIsDirty = true;
 		emit lastUpdateChanged(lastUpdate);
 	}
 }
@@ -372,6 +398,7 @@ void SettingsData::setIsProductionEnvironment(bool isProductionEnvironment)
 {
 	if (isProductionEnvironment != mIsProductionEnvironment) {
 		mIsProductionEnvironment = isProductionEnvironment;
+		mIsDirty = true;
 		emit isProductionEnvironmentChanged(isProductionEnvironment);
 	}
 }
@@ -386,6 +413,7 @@ void SettingsData::setPrimaryColor(int primaryColor)
 {
 	if (primaryColor != mPrimaryColor) {
 		mPrimaryColor = primaryColor;
+		mIsDirty = true;
 		emit primaryColorChanged(primaryColor);
 	}
 }
@@ -400,6 +428,7 @@ void SettingsData::setAccentColor(int accentColor)
 {
 	if (accentColor != mAccentColor) {
 		mAccentColor = accentColor;
+		mIsDirty = true;
 		emit accentColorChanged(accentColor);
 	}
 }
@@ -414,6 +443,7 @@ void SettingsData::setDarkTheme(bool darkTheme)
 {
 	if (darkTheme != mDarkTheme) {
 		mDarkTheme = darkTheme;
+		mIsDirty = true;
 		emit darkThemeChanged(darkTheme);
 	}
 }
@@ -428,6 +458,7 @@ void SettingsData::setUseMarkerColors(bool useMarkerColors)
 {
 	if (useMarkerColors != mUseMarkerColors) {
 		mUseMarkerColors = useMarkerColors;
+		mIsDirty = true;
 		emit useMarkerColorsChanged(useMarkerColors);
 	}
 }
@@ -442,6 +473,7 @@ void SettingsData::setDefaultMarkerColors(bool defaultMarkerColors)
 {
 	if (defaultMarkerColors != mDefaultMarkerColors) {
 		mDefaultMarkerColors = defaultMarkerColors;
+		mIsDirty = true;
 		emit defaultMarkerColorsChanged(defaultMarkerColors);
 	}
 }
@@ -456,6 +488,7 @@ void SettingsData::setMarkerColors(QString markerColors)
 {
 	if (markerColors != mMarkerColors) {
 		mMarkerColors = markerColors;
+		mIsDirty = true;
 		emit markerColorsChanged(markerColors);
 	}
 }
@@ -470,6 +503,7 @@ void SettingsData::setHasPublicCache(bool hasPublicCache)
 {
 	if (hasPublicCache != mHasPublicCache) {
 		mHasPublicCache = hasPublicCache;
+		mIsDirty = true;
 		emit hasPublicCacheChanged(hasPublicCache);
 	}
 }
@@ -484,10 +518,26 @@ void SettingsData::setUseCompactJsonFormat(bool useCompactJsonFormat)
 {
 	if (useCompactJsonFormat != mUseCompactJsonFormat) {
 		mUseCompactJsonFormat = useCompactJsonFormat;
+		mIsDirty = true;
 		emit useCompactJsonFormatChanged(useCompactJsonFormat);
 	}
 }
 // ATT 
+// Optional: useCborCache
+bool SettingsData::useCborCache() const
+{
+	return mUseCborCache;
+}
+
+void SettingsData::setUseCborCache(bool useCborCache)
+{
+	if (useCborCache != mUseCborCache) {
+		mUseCborCache = useCborCache;
+		mIsDirty = true;
+		emit useCborCacheChanged(useCborCache);
+	}
+}
+// ATT 
 // Optional: lastUsedNumber
 int SettingsData::lastUsedNumber() const
 {
@@ -498,6 +548,7 @@ void SettingsData::setLastUsedNumber(int lastUsedNumber)
 {
 	if (lastUsedNumber != mLastUsedNumber) {
 		mLastUsedNumber = lastUsedNumber;
+		mIsDirty = true;
 		emit lastUsedNumberChanged(lastUsedNumber);
 	}
 }
@@ -512,6 +563,7 @@ void SettingsData::setPublicRoot4Dev(QString publicRoot4Dev)
 {
 	if (publicRoot4Dev != mPublicRoot4Dev) {
 		mPublicRoot4Dev = publicRoot4Dev;
+		mIsDirty = true;
 		emit publicRoot4DevChanged(publicRoot4Dev);
 	}
 }
@@ -526,6 +578,7 @@ void SettingsData::setAutoUpdate(bool autoUpdate)
 {
 	if (autoUpdate != mAutoUpdate) {
 		mAutoUpdate = autoUpdate;
+		mIsDirty = true;
 		emit autoUpdateChanged(autoUpdate);
 	}
 }
@@ -540,6 +593,7 @@ void SettingsData::setAutoUpdateEveryHours(int autoUpdateEveryHours)
 {
 	if (autoUpdateEveryHours != mAutoUpdateEveryHours) {
 		mAutoUpdateEveryHours = autoUpdateEveryHours;
+		mIsDirty = true;
 		emit autoUpdateEveryHoursChanged(autoUpdateEveryHours);
 	}
 }
@@ -554,6 +608,7 @@ void SettingsData::setLastUpdateStamp(QDateTime lastUpdateStamp)
 {
 	if (lastUpdateStamp != mLastUpdateStamp) {
 		mLastUpdateStamp = lastUpdateStamp;
+		mIsDirty = true;
 		emit lastUpdateStampChanged(lastUpdateStamp);
 	}
 }
@@ -572,6 +627,7 @@ void SettingsData::setNavigationStyle(int navigationStyle)
 {
 	if (navigationStyle != mNavigationStyle) {
 		mNavigationStyle = navigationStyle;
+		mIsDirty = true;
 		emit navigationStyleChanged(navigationStyle);
 	}
 }
@@ -586,6 +642,7 @@ void SettingsData::setOneMenuButton(bool oneMenuButton)
 {
 	if (oneMenuButton != mOneMenuButton) {
 		mOneMenuButton = oneMenuButton;
+		mIsDirty = true;
 		emit oneMenuButtonChanged(oneMenuButton);
 	}
 }
@@ -600,6 +657,7 @@ void SettingsData::setClassicStackNavigation(bool classicStackNavigation)
 {
 	if (classicStackNavigation != mClassicStackNavigation) {
 		mClassicStackNavigation = classicStackNavigation;
+		mIsDirty = true;
 		emit classicStackNavigationChanged(classicStackNavigation);
 	}
 }
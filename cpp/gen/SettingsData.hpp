@@ -25,6 +25,7 @@ class SettingsData: public QObject
 	Q_PROPERTY(QString markerColors READ markerColors WRITE setMarkerColors NOTIFY markerColorsChanged FINAL)
 	Q_PROPERTY(bool hasPublicCache READ hasPublicCache WRITE setHasPublicCache NOTIFY hasPublicCacheChanged FINAL)
 	Q_PROPERTY(bool useCompactJsonFormat READ useCompactJsonFormat WRITE setUseCompactJsonFormat NOTIFY useCompactJsonFormatChanged FINAL)
+	Q_PROPERTY(bool useCborCache READ useCborCache WRITE setUseCborCache NOTIFY useCborCacheChanged FINAL)
 	Q_PROPERTY(int lastUsedNumber READ lastUsedNumber WRITE setLastUsedNumber NOTIFY lastUsedNumberChanged FINAL)
 	Q_PROPERTY(QString publicRoot4Dev READ publicRoot4Dev WRITE setPublicRoot4Dev NOTIFY publicRoot4DevChanged FINAL)
 	Q_PROPERTY(bool autoUpdate READ autoUpdate WRITE setAutoUpdate NOTIFY autoUpdateChanged FINAL)
@@ -52,6 +53,11 @@ public:
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
 
+	// dirty: a persisted property was changed since read from or written to cache
+	// not generated: hand-maintained hooks, see gen-model/README.md
+	bool isDirty() const;
+	void markAsClean();
+
 	int id() const;
 	void setId(int id);
 	int version() const;
@@ -81,6 +87,8 @@ public:
 	void setHasPublicCache(bool hasPublicCache);
 	bool useCompactJsonFormat() const;
 	void setUseCompactJsonFormat(bool useCompactJsonFormat);
+	bool useCborCache() const;
+	void setUseCborCache(bool useCborCache);
 	int lastUsedNumber() const;
 	void setLastUsedNumber(int lastUsedNumber);
 	QString publicRoot4Dev() const;
@@ -120,6 +128,7 @@ public:
 	void markerColorsChanged(QString markerColors);
 	void hasPublicCacheChanged(bool hasPublicCache);
 	void useCompactJsonFormatChanged(bool useCompactJsonFormat);
+	void useCborCacheChanged(bool useCborCache);
 	void lastUsedNumberChanged(int lastUsedNumber);
 	void publicRoot4DevChanged(QString publicRoot4Dev);
 	void autoUpdateChanged(bool autoUpdate);
@@ -132,6 +141,7 @@ public:
 
 private:
 
+	bool mIsDirty;
 	int mId;
 	int mVersion;
 	QString mApiVersion;
@@ -145,6 +155,7 @@ private:
 	QString mMarkerColors;
 	bool mHasPublicCache;
 	bool mUseCompactJsonFormat;
+	bool mUseCborCache;
 	int mLastUsedNumber;
 	QString mPublicRoot4Dev;
 	bool mAutoUpdate;
@@ -1,4 +1,5 @@
 #include "Speaker.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 // target also references to this
@@ -34,7 +35,7 @@ static const QString conferencesForeignKey = "conferences";
  * Default Constructor if Speaker not initialized from QVariantMap
  */
 Speaker::Speaker(QObject *parent) :
-        QObject(parent), mSpeakerId(-1), mIsDeprecated(false), mSortKey(""), mSortGroup(""), mName(""), mPublicName(""), mTitle(""), mBio("")
+        QObject(parent), mIsDirty(false), mSpeakerId(-1), mIsDeprecated(false), mSortKey(""), mSortGroup(""), mName(""), mPublicName(""), mTitle(""), mBio("")
 {
 	// lazy references:
 	mSpeakerImage = -1;
@@ -93,6 +94,8 @@ void Speaker::fillFromMap(const QVariantMap& speakerMap)
 	// mConferences must be resolved later if there are keys
 	mConferencesKeysResolved = (mConferencesKeys.size() == 0);
 	mConferences.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -128,6 +131,8 @@ void Speaker::fillFromForeignMap(const QVariantMap& speakerMap)
 	// mConferences must be resolved later if there are keys
 	mConferencesKeysResolved = (mConferencesKeys.size() == 0);
 	mConferences.clear();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -163,6 +168,7 @@ void Speaker::fillFromCacheMap(const QVariantMap& speakerMap)
 	// mConferences must be resolved later if there are keys
 	mConferencesKeysResolved = (mConferencesKeys.size() == 0);
 	mConferences.clear();
+	mIsDirty = false;
 }
 
 void Speaker::prepareNew()
@@ -302,6 +308,17 @@ QVariantMap Speaker::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool Speaker::isDirty() const
+{
+	return mIsDirty;
+}
+
+void Speaker::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // REF
 // Lazy: speakerImage
 // Optional: speakerImage
@@ -325,6 +342,7 @@ void Speaker::setSpeakerImage(int speakerImage)
         // set the new lazy reference
         mSpeakerImage = speakerImage;
         mSpeakerImageInvalid = false;
+        mIsDirty = true;
         emit speakerImageChanged(speakerImage);
         if (speakerImage != -1) {
             // resolve the corresponding Data Object on demand from DataManager
@@ -381,6 +399,7 @@ void Speaker::setSpeakerId(int speakerId)
 {
 	if (speakerId != mSpeakerId) {
 		mSpeakerId = speakerId;
+		mIsDirty = true;
 		emit speakerIdChanged(speakerId);
 	}
 }
@@ -395,6 +414,7 @@ void Speaker::setIsDeprecated(bool isDeprecated)
 {
 	if (isDeprecated != mIsDeprecated) {
 		mIsDeprecated = isDeprecated;
+		mIsDirty = true;
 		emit isDeprecatedChanged(isDeprecated);
 	}
 }
@@ -409,6 +429,7 @@ void Speaker::setSortKey(QString sortKey)
 {
 	if (sortKey != mSortKey) {
 		mSortKey = sortKey;
+		mIsDirty = true;
 		emit sortKeyChanged(sortKey);
 	}
 }
@@ -423,6 +444,7 @@ void Speaker::setSortGroup(QString sortGroup)
 {
 	if (sortGroup != mSortGroup) {
 		mSortGroup = sortGroup;
+		mIsDirty = true;
 		emit sortGroupChanged(sortGroup);
 	}
 }
@@ -437,6 +459,7 @@ void Speaker::setName(QString name)
 {
 	if (name != mName) {
 		mName = name;
+		mIsDirty = true;
 		emit nameChanged(name);
 	}
 }
@@ -451,6 +474,7 @@ void Speaker::setPublicName(QString publicName)
 {
 	if (publicName != mPublicName) {
 		mPublicName = publicName;
+		mIsDirty = true;
 		emit publicNameChanged(publicName);
 	}
 }
@@ -465,6 +489,7 @@ void Speaker::setTitle(QString title)
 {
 	if (title != mTitle) {
 		mTitle = title;
+		mIsDirty = true;
 		emit titleChanged(title);
 	}
 }
@@ -479,6 +504,7 @@ void Speaker::setBio(QString bio)
 {
 	if (bio != mBio) {
 		mBio = bio;
+		mIsDirty = true;
 		emit bioChanged(bio);
 	}
 }
@@ -518,6 +544,7 @@ QVariantList Speaker::sessionsAsForeignQVariantList()
 void Speaker::addToSessions(Session* session)
 {
     mSessions.append(session);
+    mIsDirty = true;
     emit addedToSessions(session);
     emit sessionsPropertyListChanged();
 }
@@ -530,6 +557,7 @@ bool Speaker::removeFromSessions(Session* session)
     	qDebug() << "Session* not found in sessions";
     	return false;
     }
+    mIsDirty = true;
     emit sessionsPropertyListChanged();
     // sessions are independent - DON'T delete them
     return true;
@@ -540,6 +568,7 @@ void Speaker::clearSessions()
         removeFromSessions(mSessions.last());
     }
     mSessionsKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -572,12 +601,36 @@ void Speaker::resolveSessionsKeys(QList<Session*> sessions)
         return;
     }
     // don't clear mSessions (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < sessions.size(); ++i) {
         addToSessions(sessions.at(i));
     }
+    mIsDirty = wasDirty;
     mSessionsKeysResolved = true;
 }
 
+/**
+ * Sessions are cached per Conference and loaded lazily (DataManager)
+ * so resolved sessions can be incomplete:
+ * keep the keys (including sessions added after resolving)
+ * and resolve again after loading more Sessions
+ */
+void Speaker::markSessionsKeysUnresolved()
+{
+    if(!mSessionsKeysResolved){
+        return;
+    }
+    for (int i = 0; i < mSessions.size(); ++i) {
+        const QString sessionKey = QString::number(mSessions.at(i)->sessionId());
+        if(!mSessionsKeys.contains(sessionKey)) {
+            mSessionsKeys << sessionKey;
+        }
+    }
+    mSessions.clear();
+    mSessionsKeysResolved = false;
+}
+
 int Speaker::sessionsCount()
 {
     return mSessions.size();
@@ -590,6 +643,7 @@ void Speaker::setSessions(QList<Session*> sessions)
 {
 	if (sessions != mSessions) {
 		mSessions = sessions;
+		mIsDirty = true;
 		emit sessionsChanged(sessions);
 		emit sessionsPropertyListChanged();
 	}
@@ -617,6 +671,7 @@ void Speaker::appendToSessionsProperty(QQmlListProperty<Session> *sessionsList,
     Speaker *speakerObject = qobject_cast<Speaker *>(sessionsList->object);
     if (speakerObject) {
         speakerObject->mSessions.append(session);
+        speakerObject->mIsDirty = true;
         emit speakerObject->addedToSessions(session);
     } else {
         qWarning() << "cannot append Session* to sessions " << "Object is not of type Speaker*";
@@ -652,6 +707,7 @@ void Speaker::clearSessionsProperty(QQmlListProperty<Session> *sessionsList)
     if (speaker) {
         // sessions are independent - DON'T delete them
         speaker->mSessions.clear();
+        speaker->mIsDirty = true;
     } else {
         qWarning() << "cannot clear sessions " << "Object is not of type Speaker*";
     }
@@ -693,6 +749,7 @@ QVariantList Speaker::conferencesAsForeignQVariantList()
 void Speaker::addToConferences(Conference* conference)
 {
     mConferences.append(conference);
+    mIsDirty = true;
     emit addedToConferences(conference);
     emit conferencesPropertyListChanged();
 }
@@ -705,6 +762,7 @@ bool Speaker::removeFromConferences(Conference* conference)
     	qDebug() << "Conference* not found in conferences";
     	return false;
     }
+    mIsDirty = true;
     emit conferencesPropertyListChanged();
     // conferences are independent - DON'T delete them
     return true;
@@ -715,6 +773,7 @@ void Speaker::clearConferences()
         removeFromConferences(mConferences.last());
     }
     mConferencesKeys.clear();
+    mIsDirty = true;
 }
 
 /**
@@ -747,9 +806,12 @@ void Speaker::resolveConferencesKeys(QList<Conference*> conferences)
         return;
     }
     // don't clear mConferences (see above)
+    // resolving doesn't change the persisted keys
+    bool wasDirty = mIsDirty;
     for (int i = 0; i < conferences.size(); ++i) {
         addToConferences(conferences.at(i));
     }
+    mIsDirty = wasDirty;
     mConferencesKeysResolved = true;
 }
 
@@ -765,6 +827,7 @@ void Speaker::setConferences(QList<Conference*> conferences)
 {
 	if (conferences != mConferences) {
 		mConferences = conferences;
+		mIsDirty = true;
 		emit conferencesChanged(conferences);
 		emit conferencesPropertyListChanged();
 	}
@@ -792,6 +855,7 @@ void Speaker::appendToConferencesProperty(QQmlListProperty<Conference> *conferen
     Speaker *speakerObject = qobject_cast<Speaker *>(conferencesList->object);
     if (speakerObject) {
         speakerObject->mConferences.append(conference);
+        speakerObject->mIsDirty = true;
         emit speakerObject->addedToConferences(conference);
     } else {
         qWarning() << "cannot append Conference* to conferences " << "Object is not of type Speaker*";
@@ -827,6 +891,7 @@ void Speaker::clearConferencesProperty(QQmlListProperty<Conference> *conferences
     if (speaker) {
         // conferences are independent - DON'T delete them
         speaker->mConferences.clear();
+        speaker->mIsDirty = true;
     } else {
         qWarning() << "cannot clear conferences " << "Object is not of type Speaker*";
     }
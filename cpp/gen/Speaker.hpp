@@ -2,7 +2,11 @@
 #define SPEAKER_HPP_
 
 #include <QObject>
+#include <QJsonObject>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
 #include <qvariant.h>
+#include <QDataStream>
 #include <QQmlListProperty>
 #include <QStringList>
 
@@ -53,6 +57,24 @@ public:
 	QVariantMap toForeignMap();
 	QVariantMap toCacheMap();
 
+	// binary cache snapshot
+	// not generated: implemented in cpp/cachedatastream.cpp
+	void fillFromSnapshot(QDataStream& in);
+	void toSnapshot(QDataStream& out);
+	// typed JSON cache without QVariantMap
+	// not generated: implemented in cpp/cachejson.cpp
+	void fillFromCacheJson(const QJsonObject& speakerObject);
+	QJsonObject toCacheJson();
+	// CBOR cache streamed into / from the typed fields
+	// not generated: implemented in cpp/cachecbor.cpp
+	void fillFromCacheCbor(QCborStreamReader& reader);
+	void toCacheCbor(QCborStreamWriter& writer);
+
+	// dirty: a persisted property was changed since read from or written to cache
+	// not generated: hand-maintained hooks, see gen-model/README.md
+	bool isDirty() const;
+	void markAsClean();
+
 	int speakerId() const;
 	void setSpeakerId(int speakerId);
 	bool isDeprecated() const;
@@ -119,6 +141,9 @@ public:
 
 	Q_INVOKABLE
 	void resolveSessionsKeys(QList<Session*> sessions);
+
+	// Sessions are loaded per Conference: resolve again if more were loaded
+	void markSessionsKeysUnresolved();
 	
 	Q_INVOKABLE
 	int sessionsCount();
@@ -195,6 +220,7 @@ public:
 
 private:
 
+	bool mIsDirty;
 	int mSpeakerId;
 	bool mIsDeprecated;
 	QString mSortKey;
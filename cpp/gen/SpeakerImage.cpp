@@ -1,4 +1,5 @@
 #include "SpeakerImage.hpp"
+#include <QJsonArray>
 #include <QDebug>
 #include <quuid.h>
 
@@ -26,7 +27,7 @@ static const QString maxScaleFactorForeignKey = "maxScaleFactor";
  * Default Constructor if SpeakerImage not initialized from QVariantMap
  */
 SpeakerImage::SpeakerImage(QObject *parent) :
-        QObject(parent), mSpeakerId(-1), mOriginImageUrl(""), mDownloadSuccess(false), mDownloadFailed(false), mInAssets(false), mInData(false), mSuffix(""), mMaxScaleFactor(0)
+        QObject(parent), mIsDirty(false), mSpeakerId(-1), mOriginImageUrl(""), mDownloadSuccess(false), mDownloadFailed(false), mInAssets(false), mInData(false), mSuffix(""), mMaxScaleFactor(0)
 {
 }
 
@@ -47,6 +48,8 @@ void SpeakerImage::fillFromMap(const QVariantMap& speakerImageMap)
 	mInData = speakerImageMap.value(inDataKey).toBool();
 	mSuffix = speakerImageMap.value(suffixKey).toString();
 	mMaxScaleFactor = speakerImageMap.value(maxScaleFactorKey).toInt();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -65,6 +68,8 @@ void SpeakerImage::fillFromForeignMap(const QVariantMap& speakerImageMap)
 	mInData = speakerImageMap.value(inDataForeignKey).toBool();
 	mSuffix = speakerImageMap.value(suffixForeignKey).toString();
 	mMaxScaleFactor = speakerImageMap.value(maxScaleFactorForeignKey).toInt();
+	// not read from cache: must be written
+	mIsDirty = true;
 }
 /*
  * initialize OrderData from QVariantMap
@@ -83,6 +88,7 @@ void SpeakerImage::fillFromCacheMap(const QVariantMap& speakerImageMap)
 	mInData = speakerImageMap.value(inDataKey).toBool();
 	mSuffix = speakerImageMap.value(suffixKey).toString();
 	mMaxScaleFactor = speakerImageMap.value(maxScaleFactorKey).toInt();
+	mIsDirty = false;
 }
 
 void SpeakerImage::prepareNew()
@@ -150,6 +156,17 @@ QVariantMap SpeakerImage::toCacheMap()
 	// use default toMao()
 	return toMap();
 }
+
+bool SpeakerImage::isDirty() const
+{
+	return mIsDirty;
+}
+
+void SpeakerImage::markAsClean()
+{
+	mIsDirty = false;
+}
+
 // ATT 
 // Mandatory: speakerId
 // Domain KEY: speakerId
@@ -162,6 +179,7 @@ void SpeakerImage::setSpeakerId(int speakerId)
 {
 	if (speakerId != mSpeakerId) {
 		mSpeakerId = speakerId;
+		mIsDirty = true;
 		emit speakerIdChanged(speakerId);
 	}
 }
@@ -176,6 +194,7 @@ void SpeakerImage::setOriginImageUrl(QString originImageUrl)
 {
 	if (originImageUrl != mOriginImageUrl) {
 		mOriginImageUrl = originImageUrl;
+		mIsDirty = true;
 		emit originImageUrlChanged(originImageUrl);
 	}
 }
@@ -190,6 +209,7 @@ void SpeakerImage::setDownloadSuccess(bool downloadSuccess)
 {
 	if (downloadSuccess != mDownloadSuccess) {
 		mDownloadSuccess = downloadSuccess;
+		mIsDirty = true;
 		emit downloadSuccessChanged(downloadSuccess);
 	}
 }
@@ -204,6 +224,7 @@ void SpeakerImage::setDownloadFailed(bool downloadFailed)
 {
 	if (downloadFailed != mDownloadFailed) {
 		mDownloadFailed = downloadFailed;
+		mIsDirty = true;
 		emit downloadFailedChanged(downloadFailed);
 	}
 }
@@ -218,6 +239,7 @@ void SpeakerImage::setInAssets(bool inAssets)
 {
 	if (inAssets != mInAssets) {
 		mInAssets = inAssets;
+		mIsDirty = true;
 		emit inAssetsChanged(inAssets);
 	}
 }
@@ -232,6 +254,7 @@ void SpeakerImage::setInData(bool inData)
 {
 	if (inData != mInData) {
 		mInData = inData;
+		mIsDirty = true;
 		emit inDataChanged(inData);
 	}
 }
@@ -246,6 +269,7 @@ void SpeakerImage::setSuffix(QString suffix)
 {
 	if (suffix != mSuffix) {
 		mSuffix = suffix;
+		mIsDirty = true;
 		emit suffixChanged(suffix);
 	}
 }
@@ -260,6 +284,7 @@ void SpeakerImage::setMaxScaleFactor(int maxScaleFactor)
 {
 	if (maxScaleFactor != mMaxScaleFactor) {
 		mMaxScaleFactor = maxScaleFactor;
+		mIsDirty = true;
 		emit maxScaleFactorChanged(maxScaleFactor);
 	}
 }
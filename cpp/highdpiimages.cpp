@@ -0,0 +1,54 @@
+#include "highdpiimages.hpp"
+
+#include <QDebug>
+
+/**
+ * stores the origin and for images of at least 96 px
+ * scaled images for 1x (stored as origin file name), 2x, 3x, 4x
+ * the longer side is scaled
+ */
+HighDpiImageResult HighDpiImages::prepare(const HighDpiImageJob job)
+{
+    HighDpiImageResult result;
+    result.dataObject = job.dataObject;
+    result.maxScaleFactor = 0;
+    result.success = false;
+
+    const QString originFileName = job.fileName + "." + job.suffix;
+    const int width = job.originImage.width();
+    const int height = job.originImage.height();
+    const int longerSide = qMax(width, height);
+    const int size1 = 96;
+
+    if(longerSide < size1) {
+        result.success = job.originImage.save(originFileName);
+        if(!result.success) {
+            qWarning() << "Cannot save SpeakerImage " << originFileName;
+        }
+        return result;
+    }
+    result.success = job.originImage.save(job.fileName+"_origin."+job.suffix);
+    if(!result.success) {
+        qWarning() << "Cannot save SpeakerImage " << job.fileName+"_origin."+job.suffix;
+        return result;
+    }
+    for (int scaleFactor = 1; scaleFactor <= 4; ++scaleFactor) {
+        const int size = size1 * scaleFactor;
+        if(longerSide < size) {
+            break;
+        }
+        QImage scaledImage;
+        if(width >= height) {
+            scaledImage = job.originImage.scaledToWidth(size);
+        } else {
+            scaledImage = job.originImage.scaledToHeight(size);
+        }
+        if(scaleFactor == 1) {
+            scaledImage.save(originFileName);
+        } else {
+            scaledImage.save(job.fileName+"@"+QString::number(scaleFactor)+"x."+job.suffix);
+        }
+        result.maxScaleFactor = scaleFactor;
+    }
+    return result;
+}
@@ -0,0 +1,38 @@
+#ifndef HIGHDPIIMAGES_HPP
+#define HIGHDPIIMAGES_HPP
+
+#include <QObject>
+#include <QImage>
+#include <QString>
+
+/*
+ * derive the 1x .. 4x variants of a downloaded speaker image
+ * runs on a worker thread (QtConcurrent): only QImage and files are touched here
+ */
+struct HighDpiImageJob
+{
+    // the SpeakerImage - only handed back, never accessed from worker
+    QObject* dataObject;
+    // decoded by ImageLoader
+    QImage originImage;
+    // full path without suffix, per ex. .../speakerImages/speaker_42
+    QString fileName;
+    QString suffix;
+};
+
+struct HighDpiImageResult
+{
+    QObject* dataObject;
+    // 0: image too small, only the origin was stored
+    int maxScaleFactor;
+    // false if the origin image couldn't be stored
+    bool success;
+};
+
+class HighDpiImages
+{
+public:
+    static HighDpiImageResult prepare(const HighDpiImageJob job);
+};
+
+#endif // HIGHDPIIMAGES_HPP
@@ -0,0 +1,81 @@
+#include "imagedownloadscheduler.hpp"
+
+#include "imageloader.hpp"
+#include "networkservice.hpp"
+
+#include <QDebug>
+
+ImageDownloadScheduler::ImageDownloadScheduler(NetworkService* networkService, const int maxInFlight, QObject* parent) :
+    QObject(parent), mNetworkService(networkService), mInFlight(0), mMaxInFlight(qMax(1, maxInFlight))
+{
+}
+
+void ImageDownloadScheduler::setMaxInFlight(const int maxInFlight)
+{
+    mMaxInFlight = qMax(1, maxInFlight);
+    startNext();
+}
+
+int ImageDownloadScheduler::maxInFlight() const
+{
+    return mMaxInFlight;
+}
+
+void ImageDownloadScheduler::enqueue(QObject* dataObject, const QString& imageUrl, const QString& filename)
+{
+    PendingImage pendingImage;
+    pendingImage.dataObject = dataObject;
+    pendingImage.imageUrl = imageUrl;
+    pendingImage.filename = filename;
+    mQueue.enqueue(pendingImage);
+    startNext();
+}
+
+bool ImageDownloadScheduler::isIdle() const
+{
+    return mQueue.isEmpty() && mInFlight == 0;
+}
+
+void ImageDownloadScheduler::startNext()
+{
+    while(mInFlight < mMaxInFlight && !mQueue.isEmpty()) {
+        PendingImage pendingImage = mQueue.dequeue();
+        ImageLoader* imageLoader = new ImageLoader(pendingImage.imageUrl, pendingImage.filename, this);
+        bool res = connect(imageLoader, SIGNAL(loaded(QObject*, QImage)), this,
+                           SLOT(onLoaded(QObject*, QImage)));
+        if (!res) {
+            Q_ASSERT(res);
+        }
+        res = connect(imageLoader, SIGNAL(loadingFailed(QObject*, QString)), this,
+                      SLOT(onLoadingFailed(QObject*, QString)));
+        if (!res) {
+            Q_ASSERT(res);
+        }
+        mInFlight++;
+        imageLoader->loadSpeaker(pendingImage.dataObject, mNetworkService);
+    }
+}
+
+// the loader has done its job: free the slot and start the next one from queue
+// before reporting, so the network is kept busy while the result is processed
+void ImageDownloadScheduler::finishLoader()
+{
+    ImageLoader* imageLoader = qobject_cast<ImageLoader*>(sender());
+    if(imageLoader) {
+        imageLoader->deleteLater();
+    }
+    mInFlight--;
+    startNext();
+}
+
+void ImageDownloadScheduler::onLoaded(QObject* dataObject, QImage image)
+{
+    finishLoader();
+    emit loaded(dataObject, image);
+}
+
+void ImageDownloadScheduler::onLoadingFailed(QObject* dataObject, QString message)
+{
+    finishLoader();
+    emit loadingFailed(dataObject, message);
+}
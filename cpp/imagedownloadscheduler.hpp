@@ -0,0 +1,67 @@
+#ifndef IMAGEDOWNLOADSCHEDULER_HPP
+#define IMAGEDOWNLOADSCHEDULER_HPP
+
+#include <QObject>
+#include <QQueue>
+#include <QString>
+#include <QImage>
+
+class NetworkService;
+
+/*
+ * Downloads images in parallel using ImageLoader
+ * all requests share the NetworkService (connection reuse)
+ * max number of requests in flight is configurable,
+ * all other requests are queued.
+ * each image reports success or failure on its own -
+ * a failed image never stops the others
+ */
+class ImageDownloadScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    ImageDownloadScheduler(NetworkService* networkService, const int maxInFlight, QObject* parent = nullptr);
+
+    void setMaxInFlight(const int maxInFlight);
+    int maxInFlight() const;
+
+    /*
+     * @param dataObject will be sent back with loaded() or loadingFailed()
+     * @param imageUrl The url to load the image from.
+     * @param filename The full path with filename to store the image (optional)
+     */
+    void enqueue(QObject* dataObject, const QString& imageUrl, const QString& filename);
+
+    // nothing queued and nothing in flight
+    bool isIdle() const;
+
+Q_SIGNALS:
+
+    void loaded(QObject* dataObject, QImage image);
+    void loadingFailed(QObject* dataObject, QString message);
+
+private Q_SLOTS:
+
+    void onLoaded(QObject* dataObject, QImage image);
+    void onLoadingFailed(QObject* dataObject, QString message);
+
+private:
+
+    struct PendingImage
+    {
+        QObject* dataObject;
+        QString imageUrl;
+        QString filename;
+    };
+
+    NetworkService* mNetworkService;
+    QQueue<PendingImage> mQueue;
+    int mInFlight;
+    int mMaxInFlight;
+
+    void startNext();
+    void finishLoader();
+};
+
+#endif // IMAGEDOWNLOADSCHEDULER_HPP
@@ -1,10 +1,10 @@
 
 
 #include "imageloader.hpp"
+#include "networkservice.hpp"
 
 #include <QUrl>
 #include <QDebug>
-#include <QtNetwork/qnetworkaccessmanager.h>
 #include <QtNetwork/qnetworkrequest.h>
 #include <QtNetwork/qnetworkreply.h>
 #include <QSslConfiguration>
@@ -29,9 +29,8 @@ ImageLoader::~ImageLoader()
  * QObject* will be stored at request and sent back from response
  *
  */
-void ImageLoader::loadSpeaker(QObject* dataObject)
+void ImageLoader::loadSpeaker(QObject* dataObject, NetworkService* networkService)
 {
-    QNetworkAccessManager* netManager = new QNetworkAccessManager(this);
 
     const QUrl url(m_imageUrl);
     QNetworkRequest request(url);
@@ -44,8 +43,8 @@ void ImageLoader::loadSpeaker(QObject* dataObject)
     conf.setPeerVerifyMode(QSslSocket::VerifyNone);
     request.setSslConfiguration(conf);
 
-    QNetworkReply* reply = netManager->get(request);
-    connect(reply, SIGNAL(finished()), this, SLOT(onReplyFinished()));
+    Q_ASSERT(networkService);
+    networkService->get(request, this, SLOT(onReplyFinished()));
 }
 
 
@@ -63,7 +62,9 @@ void ImageLoader::onReplyFinished()
             const qint64 available = reply->bytesAvailable();
             if (available > 0) {
                 int httpStatusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
-                if(httpStatusCode == 200) {
+                // file: and qrc: replies have no HTTP status
+                const bool isHttp = reply->url().scheme().startsWith("http");
+                if(!isHttp || httpStatusCode == 200) {
                     QImage originImage = QImage::fromData(reply->readAll());
                     if(originImage.isNull()) {
                         emit loadingFailed(reply->request().originatingObject(), "Cannot construct Image from data: " + m_imageUrl);
@@ -79,13 +80,15 @@ void ImageLoader::onReplyFinished()
                     if(originImage.dotsPerMeterY() > 2835) {
                         originImage.setDotsPerMeterY(2835);
                     }
-                    originImage.save(m_filename);
+                    if(!m_filename.isEmpty()) {
+                        originImage.save(m_filename);
+                    }
     //                // this is normaly used for images without any modifications:
     //                QFile dataFile(m_filename);
     //                dataFile.open(QIODevice::WriteOnly);
     //                dataFile.write(data);
     //                dataFile.close();
-                    emit loaded(reply->request().originatingObject(), originImage.width(), originImage.height());
+                    emit loaded(reply->request().originatingObject(), originImage);
                 } else {
                     QString message;
                     if(httpStatusCode == 301) {
@@ -96,6 +99,9 @@ void ImageLoader::onReplyFinished()
                     }
                     emit loadingFailed(reply->request().originatingObject(), message);
                 }
+            } else {
+                // always report back - otherwise the download scheduler waits forever
+                emit loadingFailed(reply->request().originatingObject(), "No data received: " + m_imageUrl);
             }
         } else {
             qDebug() << "ERROR loading image " << m_filename << " " << reply->error() << reply->errorString();
@@ -3,6 +3,9 @@
 
 #include <QObject>
 #include <QByteArray>
+#include <QImage>
+
+class NetworkService;
 
 
 /*
@@ -19,16 +22,20 @@ public:
      *
      * @param imageUrl The url to load the image from.
      * @param filename The full path with filename to store the image.
+     *                 if empty the image is only decoded and sent with loaded()
      */
     ImageLoader(const QString &imageUrl, const QString &filename, QObject* parent = nullptr);
 
     ~ImageLoader();
 
-    void loadSpeaker(QObject* dataObject);
+    /*
+     * @param networkService shared network layer (connection reuse)
+     */
+    void loadSpeaker(QObject* dataObject, NetworkService* networkService);
 
 Q_SIGNALS:
 
-    void loaded(QObject* dataObject, int width, int height);
+    void loaded(QObject* dataObject, QImage image);
     void loadingFailed(QObject* dataObject, QString message);
 
 private Q_SLOTS:
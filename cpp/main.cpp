@@ -4,14 +4,20 @@
 #include <QDebug>
 #include <QTranslator>
 #include <QQmlContext>
+#include <QQuickWindow>
 
 #include "applicationui.hpp"
+#include "startupprofiler.hpp"
 
 int main(int argc, char *argv[])
 {
+    StartupProfiler* profiler = StartupProfiler::instance();
+    profiler->start();
     QGuiApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
     qputenv("QT_QUICK_CONTROLS_STYLE", "material");
+    profiler->beginPhase(QStringLiteral("QGuiApplication"));
     QGuiApplication app(argc, argv);
+    profiler->endPhase(QStringLiteral("QGuiApplication"));
 
     QTranslator translator;
     if (translator.load(QLocale(), QLatin1String("c2gQtWS_x"), QLatin1String("_"), QLatin1String(":/translations"))) {
@@ -20,7 +26,10 @@ int main(int argc, char *argv[])
         qDebug() << "cannot load translator " << QLocale::system().name() << " check content of translations.qrc";
     }
 
+    // DataManager reads settings
+    profiler->beginPhase(QStringLiteral("ApplicationUI"));
     ApplicationUI appui;
+    profiler->endPhase(QStringLiteral("ApplicationUI"));
 
     QQmlApplicationEngine engine;
 
@@ -29,12 +38,25 @@ int main(int argc, char *argv[])
     context->setContextProperty("myApp", &appui);
     // some more context properties
     appui.addContextProperty(context);
+    context->setContextProperty("startupProfiler", profiler);
 
     // lifecycle management
     QObject::connect(&app, SIGNAL(aboutToQuit()), &appui, SLOT(onAboutToQuit()));
     QObject::connect(&app, SIGNAL(applicationStateChanged(Qt::ApplicationState)), &appui, SLOT(onApplicationStateChanged(Qt::ApplicationState)));
 
     // Start QML
+    profiler->beginPhase(QStringLiteral("QML engine load"));
     engine.load(QUrl(QStringLiteral("qrc:/qml/main.qml")));
+    profiler->endPhase(QStringLiteral("QML engine load"));
+    if (!engine.rootObjects().isEmpty()) {
+        QQuickWindow* window = qobject_cast<QQuickWindow*>(engine.rootObjects().first());
+        if (window) {
+            // emitted from the render thread: direct for the timestamp, the slot queues the rest
+            bool res = QObject::connect(window, SIGNAL(frameSwapped()), profiler, SLOT(onFrameSwapped()), Qt::DirectConnection);
+            if (!res) {
+                Q_ASSERT(res);
+            }
+        }
+    }
     return app.exec();
 }
@@ -0,0 +1,128 @@
+#include "networkservice.hpp"
+
+#include <QDebug>
+
+NetworkService::NetworkService(QObject *parent) : QObject(parent),
+    mNetworkAccessManager(nullptr), mMaxRequestsPerHost(6)
+{
+
+}
+
+// created lazy: first use or first use after online state changed
+QNetworkAccessManager* NetworkService::networkAccessManager()
+{
+    if(!mNetworkAccessManager) {
+        mNetworkAccessManager = new QNetworkAccessManager(this);
+        mRunningRepliesByManager.insert(mNetworkAccessManager, 0);
+        qDebug() << "NetworkService: new QNetworkAccessManager";
+    }
+    return mNetworkAccessManager;
+}
+
+bool NetworkService::isNetworkAccessible()
+{
+    QNetworkAccessManager::NetworkAccessibility accessibility = networkAccessManager()->networkAccessible();
+    if(accessibility == QNetworkAccessManager::UnknownAccessibility) {
+        qDebug() << "NO ACCESS: The network accessibility cannot be determined.";
+    }
+    return accessibility == QNetworkAccessManager::Accessible;
+}
+
+void NetworkService::setMaxRequestsPerHost(const int maxRequests)
+{
+    mMaxRequestsPerHost = qMax(1, maxRequests);
+}
+
+int NetworkService::maxRequestsPerHost() const
+{
+    return mMaxRequestsPerHost;
+}
+
+// SLOT from DataServer
+// next request will use a new manager (QTBUG-49751)
+void NetworkService::onOnlineChanged(const bool isOnline)
+{
+    Q_UNUSED(isOnline);
+    retireNetworkAccessManager();
+}
+
+void NetworkService::retireNetworkAccessManager()
+{
+    if(!mNetworkAccessManager) {
+        return;
+    }
+    if(mRunningRepliesByManager.value(mNetworkAccessManager) == 0) {
+        mRunningRepliesByManager.remove(mNetworkAccessManager);
+        mNetworkAccessManager->deleteLater();
+    }
+    // otherwise deleted from onReplyFinished()
+    mNetworkAccessManager = nullptr;
+}
+
+void NetworkService::get(const QNetworkRequest& request, QObject* receiver, const char* finishedSlot, const char* readyReadSlot)
+{
+    PendingRequest pendingRequest;
+    pendingRequest.request = request;
+    pendingRequest.receiver = receiver;
+    pendingRequest.finishedSlot = finishedSlot;
+    pendingRequest.readyReadSlot = readyReadSlot;
+    const QString host = request.url().host();
+    if(mRunningRequestsByHost.value(host) >= mMaxRequestsPerHost) {
+        mQueuedRequestsByHost[host].enqueue(pendingRequest);
+        return;
+    }
+    startRequest(pendingRequest);
+}
+
+void NetworkService::startRequest(const PendingRequest& pendingRequest)
+{
+    if(!pendingRequest.receiver) {
+        qDebug() << "NetworkService: receiver deleted - request skipped " << pendingRequest.request.url();
+        return;
+    }
+    QNetworkRequest request = pendingRequest.request;
+    request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+    QNetworkAccessManager* manager = networkAccessManager();
+    QNetworkReply* reply = manager->get(request);
+    bool res = false;
+    if(pendingRequest.readyReadSlot) {
+        res = connect(reply, SIGNAL(readyRead()), pendingRequest.receiver, pendingRequest.readyReadSlot);
+        if (!res) {
+            Q_ASSERT(res);
+        }
+    }
+    // receiver first: reply is deleted later by onReplyFinished()
+    res = connect(reply, SIGNAL(finished()), pendingRequest.receiver, pendingRequest.finishedSlot);
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(reply, SIGNAL(finished()), this, SLOT(onReplyFinished()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    mRunningRepliesByManager[manager]++;
+    mRunningRequestsByHost[request.url().host()]++;
+}
+
+void NetworkService::onReplyFinished()
+{
+    QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
+    if(!reply) {
+        return;
+    }
+    reply->deleteLater();
+    QNetworkAccessManager* manager = reply->manager();
+    int runningReplies = --mRunningRepliesByManager[manager];
+    if(runningReplies == 0 && manager != mNetworkAccessManager) {
+        // retired manager: last reply finished
+        mRunningRepliesByManager.remove(manager);
+        manager->deleteLater();
+    }
+    const QString host = reply->request().url().host();
+    mRunningRequestsByHost[host]--;
+    // start next queued request for this host
+    while(mRunningRequestsByHost.value(host) < mMaxRequestsPerHost
+          && !mQueuedRequestsByHost.value(host).isEmpty()) {
+        startRequest(mQueuedRequestsByHost[host].dequeue());
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef NETWORKSERVICE_HPP
+#define NETWORKSERVICE_HPP
+
+#include <QObject>
+#include <QHash>
+#include <QQueue>
+#include <QPointer>
+#include <QtNetwork/qnetworkaccessmanager.h>
+#include <QtNetwork/qnetworkrequest.h>
+#include <QtNetwork/qnetworkreply.h>
+
+/*
+ * One QNetworkAccessManager shared by all requests (DataServer, ImageLoader)
+ * so TCP/TLS connections are reused (and HTTP/2 multiplexed if server supports)
+ *
+ * workaround bug iOS - cannot reuse QNetworkAccessManager QTBUG-49751
+ * otherwise accessibility not detected if switch off and on again:
+ * the manager is replaced each time the online state changes,
+ * the old one is deleted after its last reply was finished
+ *
+ * requests per host are limited, all other requests are queued
+ * replies are deleted after finished() was delivered to receiver
+ */
+class NetworkService : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NetworkService(QObject *parent = nullptr);
+
+    bool isNetworkAccessible();
+
+    // HTTP/1 uses max 6 connections per host
+    void setMaxRequestsPerHost(const int maxRequests);
+    int maxRequestsPerHost() const;
+
+    /*
+     * GET request, started immediately or queued if too many requests to this host
+     * finished() of the reply is connected to finishedSlot of receiver
+     * receiver gets the reply from sender() - don't delete the reply
+     * optional readyReadSlot to consume data while receiving
+     */
+    void get(const QNetworkRequest& request, QObject* receiver, const char* finishedSlot, const char* readyReadSlot = nullptr);
+
+public slots:
+    void onOnlineChanged(const bool isOnline);
+
+private slots:
+    void onReplyFinished();
+
+private:
+
+    struct PendingRequest
+    {
+        QNetworkRequest request;
+        QPointer<QObject> receiver;
+        const char* finishedSlot;
+        const char* readyReadSlot;
+    };
+
+    QNetworkAccessManager* mNetworkAccessManager;
+    // running replies per manager - retired managers are deleted if no more replies
+    QHash<QNetworkAccessManager*, int> mRunningRepliesByManager;
+    int mMaxRequestsPerHost;
+    QHash<QString, int> mRunningRequestsByHost;
+    QHash<QString, QQueue<PendingRequest> > mQueuedRequestsByHost;
+
+    QNetworkAccessManager* networkAccessManager();
+    void startRequest(const PendingRequest& pendingRequest);
+    void retireNetworkAccessManager();
+};
+
+#endif // NETWORKSERVICE_HPP
@@ -0,0 +1,317 @@
+#include "scheduleimporter.hpp"
+
+#include <QDebug>
+#include <QJsonArray>
+#include <QFile>
+
+#include "gen/Session.hpp"
+
+const QString DEFAULT_SPEAKER_IMAGE_URL = "https://s3-eu-west-1.amazonaws.com/qt-worldsummit/ws2016/uploads/2016/07/man-silhouette-black-gray.jpg";
+//"http://conf.qtcon.org/person_original.png";
+
+ScheduleImporter::ScheduleImporter(QObject *parent) : QObject(parent)
+{
+
+}
+
+/**
+ * runs on a worker thread:
+ * only reads files and creates plain values - never access DataManager from here
+ */
+ScheduleImport ScheduleImporter::importAll(const QString conferenceDataPath, const QList<ScheduleSource> sources)
+{
+    ScheduleImport result;
+    emit importProgress(tr("Parse Speaker"));
+    if(!importSpeaker(conferenceDataPath + "speaker.json", result)) {
+        return result;
+    }
+    for (int i = 0; i < sources.size(); ++i) {
+        const ScheduleSource& source = sources.at(i);
+        emit importProgress(tr("Parse Sessions ")+source.city);
+        const QString schedulePath = conferenceDataPath + "schedule_"+QString::number(source.conferenceId)+".json";
+        if(!importSchedule(schedulePath, source, result)) {
+            return result;
+        }
+    }
+    qDebug() << "IMPORT done. Speaker #" << result.speakers.size() << " Schedules #" << result.schedules.size();
+    return result;
+}
+
+// JSON values converted the same way as QVariant did before:
+// numbers can be delivered as strings and vice versa
+static QString jsonString(const QJsonValue& value)
+{
+    switch (value.type()) {
+    case QJsonValue::String:
+        return value.toString();
+    case QJsonValue::Double:
+        return value.toVariant().toString();
+    case QJsonValue::Bool:
+        return value.toBool() ? QStringLiteral("true") : QStringLiteral("false");
+    default:
+        return QString();
+    }
+}
+
+static int jsonInt(const QJsonValue& value)
+{
+    if(value.isString()) {
+        return value.toString().toInt();
+    }
+    return static_cast<int>(value.toDouble());
+}
+
+bool ScheduleImporter::importSpeaker(const QString speakerPath, ScheduleImport& result)
+{
+    QJsonDocument jda = readJsonFile(speakerPath);
+    if(!jda.isArray()) {
+        qWarning() << "Couldn't create JSON Array from file: " << speakerPath;
+    }
+    const QJsonArray speakerArray = jda.array();
+    if(speakerArray.isEmpty()) {
+        qWarning() << "Speaker List empty";
+        result.errorMessage = tr("Update failed. No Speaker received.\nReloading current Data");
+        return false;
+    }
+    qDebug() << "we got speakers from server API #" << speakerArray.size();
+    result.speakers.reserve(speakerArray.size());
+    for (int i = 0; i < speakerArray.size(); ++i) {
+        const QJsonObject speakerObject = speakerArray.at(i).toObject();
+        ImportedSpeaker speaker;
+        speaker.id = jsonInt(speakerObject.value(QLatin1String("id")));
+        speaker.firstName = jsonString(speakerObject.value(QLatin1String("first_name")));
+        speaker.lastName = jsonString(speakerObject.value(QLatin1String("last_name")));
+        speaker.bio = jsonString(speakerObject.value(QLatin1String("abstract")));
+        speaker.title = jsonString(speakerObject.value(QLatin1String("title")));
+        const QString serverAvatar = jsonString(speakerObject.value(QLatin1String("avatar")));
+        if(serverAvatar.length() > 0 && serverAvatar != DEFAULT_SPEAKER_IMAGE_URL && serverAvatar != "false") {
+            QString avatar = serverAvatar;
+            QStringList sl = avatar.split("?");
+            if(sl.size() > 1) {
+                sl.removeLast();
+                avatar = sl.join("?");
+            }
+            sl = avatar.split(".");
+            if(sl.size() < 2) {
+                qWarning() << "AVATAR wrong "+serverAvatar;
+            } else {
+                speaker.avatar = avatar;
+                speaker.avatarSuffix = sl.last();
+            }
+        } // end check avatar if URL && not default
+        result.speakers.append(speaker);
+    } // for speaker from server
+    return true;
+}
+
+bool ScheduleImporter::importSchedule(const QString schedulePath, const ScheduleSource& source, ScheduleImport& result)
+{
+    const QString& city = source.city;
+    QJsonDocument jda = readJsonFile(schedulePath);
+    if(!jda.isObject() || jda.object().isEmpty()) {
+        qWarning() << "Schedule is no Map for " << city;
+        result.errorMessage = tr("Error: Received Map is empty.")+" "+city;
+        return false;
+    }
+    const QJsonObject conferenceObject = jda.object().value(QLatin1String("conference")).toObject();
+    if(conferenceObject.isEmpty()) {
+        qWarning() << "No 'conference' found in server response for " << city;
+        result.errorMessage = tr("Error: Received Map missed 'conference'.")+" "+city;
+        return false;
+    }
+    const QJsonObject allDaysObject = conferenceObject.value(QLatin1String("days")).toObject();
+    ImportedSchedule schedule;
+    schedule.conferenceId = source.conferenceId;
+    schedule.city = city;
+    for (int d = 0; d < source.dayDates.size(); ++d) {
+        const QString& myDay = source.dayDates.at(d);
+        if(!allDaysObject.contains(myDay)) {
+            qDebug() << "Day missed in conference-days from server API " << myDay;
+            continue;
+        }
+        const QJsonObject dayObject = allDaysObject.value(myDay).toObject();
+        if(dayObject.isEmpty()) {
+            qWarning() << "No 'DAY' found " << myDay << " " << city;
+            continue;
+        }
+        ImportedDay day;
+        day.dayDate = jsonString(dayObject.value(QLatin1String("date")));
+        // the keys are the room names (sorted as before from QVariantMap)
+        const QJsonObject roomObject = dayObject.value(QLatin1String("rooms")).toObject();
+        if(roomObject.isEmpty()) {
+            qWarning() << "No 'ROOMS' found for DAY " << myDay << " " << city;
+            // the Day is counted, but has no sessions
+        }
+        for (QJsonObject::const_iterator roomIterator = roomObject.constBegin(); roomIterator != roomObject.constEnd(); ++roomIterator) {
+            const QJsonArray sessionArray = roomIterator.value().toArray();
+            if(sessionArray.isEmpty()) {
+                qWarning() << "DAY: " << myDay << " ROOM: " << roomIterator.key() << " ignored - No Sessions available " << city;
+                continue;
+            }
+            ImportedRoom room;
+            room.roomName = roomIterator.key();
+            room.sessions.reserve(sessionArray.size());
+            for (int sl = 0; sl < sessionArray.size(); ++sl) {
+                const QJsonObject sessionObject = sessionArray.at(sl).toObject();
+                if(sessionObject.isEmpty()) {
+                    qWarning() << "No 'SESSION' Map DAY: " << myDay << " ROOM: " << room.roomName << " for " << city;
+                    continue;
+                }
+                ImportedSession session;
+                importSession(sessionObject, session);
+                // ignore unwanted Sessions
+                if (checkIfIgnored(session, room.roomName)) {
+                    continue;
+                }
+                room.sessions.append(session);
+            } // end for sessions of a room of a day
+            day.rooms.append(room);
+        } // end for rooms of a day
+        schedule.days.append(day);
+    } // end for days we're interested in
+
+    if(schedule.days.isEmpty()) {
+        qWarning() << "No 'days' found for" << city;
+        result.errorMessage = tr("Error: Received Map missed 'days'.")+" "+city;
+        return false;
+    }
+    result.schedules.append(schedule);
+    return true;
+}
+
+// mapping rules of SessionAPI::fillFromForeignMap()
+void ScheduleImporter::importSession(const QJsonObject& sessionObject, ImportedSession& session)
+{
+    session.sessionId = jsonInt(sessionObject.value(QLatin1String("id")));
+    session.title = jsonString(sessionObject.value(QLatin1String("title")));
+    session.description = jsonString(sessionObject.value(QLatin1String("description")));
+    if (sessionObject.contains(QLatin1String("start"))) {
+        const QString startTimeAsString = jsonString(sessionObject.value(QLatin1String("start")));
+        session.startTime = QTime::fromString(startTimeAsString, "HH:mm");
+        if (!session.startTime.isValid()) {
+            session.startTime = QTime();
+            qDebug() << "startTime is not valid for String: " << startTimeAsString;
+        }
+    }
+    session.minutes = durationMinutes(jsonString(sessionObject.value(QLatin1String("duration"))), session.sessionId);
+    session.presenterKeys = presenterKeys(sessionObject.value(QLatin1String("persons")));
+    const QJsonArray trackArray = sessionObject.value(QLatin1String("tracks")).toArray();
+    session.tracks.reserve(trackArray.size());
+    for (int i = 0; i < trackArray.size(); ++i) {
+        const QJsonObject trackObject = trackArray.at(i).toObject();
+        ImportedTrack track;
+        track.name = jsonString(trackObject.value(QLatin1String("name")));
+        track.color = jsonString(trackObject.value(QLatin1String("color")));
+        session.tracks.append(track);
+    }
+}
+
+// persons from server: [{"id": 42, ...}] --> speaker ids
+QStringList ScheduleImporter::presenterKeys(const QJsonValue& persons) {
+    QStringList personKeys;
+    const QJsonArray personsArray = persons.toArray();
+    for (int pvl = 0; pvl < personsArray.size(); ++pvl) {
+        const QJsonObject personObject = personsArray.at(pvl).toObject();
+        if(personObject.contains(QLatin1String("id"))) {
+            personKeys.append(jsonString(personObject.value(QLatin1String("id"))));
+        }
+    }
+    return personKeys;
+}
+
+bool ScheduleImporter::checkIfIgnored(const ImportedSession& session, const QString& roomName) {
+    Q_UNUSED(session);
+    Q_UNUSED(roomName);
+    return false;
+    //    if(session.title == "Registration and Coffee" && roomName != "B02") {
+    //        qDebug() << "unwanted session: " << session.sessionId << " " << session.title << " " << roomName;
+    //        return true;
+    //    }
+    //    if(session.title == "Lunch" && roomName != "B02") {
+    //        qDebug() << "unwanted session: " << session.sessionId << " " << session.title << " " << roomName;
+    //        return true;
+    //    }
+    //    if(session.title == "Coffee break" && roomName != "B02") {
+    //        qDebug() << "unwanted session: " << session.sessionId << " " << session.title << " " << roomName;
+    //        return true;
+    //    }
+    //    if(session.title == "Evening event" && roomName != "B02") {
+    //        qDebug() << "unwanted session: " << session.sessionId << " " << session.title << " " << roomName;
+    //        return true;
+    //    }
+    //    if(session.title == "Welcome" && roomName != "C01") {
+    //        qDebug() << "unwanted session: " << session.sessionId << " " << session.title << " " << roomName;
+    //        return true;
+    //    }
+    //    return false;
+}
+
+/**
+ * same result as Session::fillFromMap(SessionAPI::toMap()) before:
+ * type flags, type and abstract are not delivered by server and reset
+ * (setType() sets them again)
+ * startTime only changed if valid
+ */
+void ScheduleImporter::fillSession(Session* session, const ImportedSession& importedSession)
+{
+    session->setSessionId(importedSession.sessionId);
+    session->setIsDeprecated(false);
+    session->setIsTraining(false);
+    session->setIsLightning(false);
+    session->setIsKeynote(false);
+    session->setIsSession(false);
+    session->setIsCommunity(false);
+    session->setIsUnconference(false);
+    session->setIsMeeting(false);
+    session->setIsGenericScheduleSession(false);
+    session->setIsBreak(false);
+    session->setIsLunch(false);
+    session->setIsEvent(false);
+    session->setIsRegistration(false);
+    session->setSessionType(QString());
+    session->setAbstractText(QString());
+    session->setTitle(importedSession.title);
+    session->setDescription(importedSession.description);
+    if(importedSession.startTime.isValid()) {
+        session->setStartTime(importedSession.startTime);
+    }
+    session->setPresenterKeys(importedSession.presenterKeys);
+}
+
+// duration from server: "hh:mm"
+int ScheduleImporter::durationMinutes(const QString& duration, const int sessionId) {
+    QStringList durationList;
+    durationList = duration.split(":");
+    int minutes = 0;
+    if(durationList.length() == 2) {
+        minutes = durationList.last().toInt();
+        minutes += durationList.first().toInt()*60;
+    } else {
+        qWarning() << "Duration wrong: " << duration << " session ID: " << sessionId;
+    }
+    return minutes;
+}
+
+// the file is memory mapped: JSON is parsed without reading the file into a buffer
+QJsonDocument ScheduleImporter::readJsonFile(const QString path) {
+    QFile readFile(path);
+    if(!readFile.exists()) {
+        qWarning() << "Path not found " << path;
+        return QJsonDocument();
+    }
+    if (!readFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "Couldn't open file: " << path;
+        return QJsonDocument();
+    }
+    QJsonDocument jda;
+    const qint64 fileSize = readFile.size();
+    uchar* mappedData = fileSize > 0 ? readFile.map(0, fileSize) : nullptr;
+    if(mappedData) {
+        jda = QJsonDocument::fromJson(QByteArray::fromRawData(reinterpret_cast<const char*>(mappedData), static_cast<int>(fileSize)));
+        readFile.unmap(mappedData);
+    } else {
+        jda = QJsonDocument::fromJson(readFile.readAll());
+    }
+    readFile.close();
+    return jda;
+}
@@ -0,0 +1,137 @@
+#ifndef SCHEDULEIMPORTER_HPP
+#define SCHEDULEIMPORTER_HPP
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QTime>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+class Session;
+
+/*
+ * plain values parsed from server data (speaker.json, schedule_<id>.json)
+ * no QObjects: created on a worker thread, consumed on the GUI thread
+ */
+struct ImportedSpeaker
+{
+    int id;
+    QString firstName;
+    QString lastName;
+    QString bio;
+    QString title;
+    // without query, empty if no avatar or the default one
+    QString avatar;
+    QString avatarSuffix;
+};
+
+// tracks from server: name and color
+// resolved against the Conference (GUI thread)
+struct ImportedTrack
+{
+    QString name;
+    QString color;
+};
+
+struct ImportedSession
+{
+    int sessionId;
+    QString title;
+    QString description;
+    // null if not delivered or invalid
+    QTime startTime;
+    int minutes;
+    // speaker ids
+    QStringList presenterKeys;
+    QList<ImportedTrack> tracks;
+};
+
+struct ImportedRoom
+{
+    QString roomName;
+    QList<ImportedSession> sessions;
+};
+
+struct ImportedDay
+{
+    QString dayDate;
+    QList<ImportedRoom> rooms;
+};
+
+struct ImportedSchedule
+{
+    int conferenceId;
+    QString city;
+    QList<ImportedDay> days;
+};
+
+/*
+ * which schedule to request and import and which days we're interested in
+ */
+struct ScheduleSource
+{
+    int conferenceId;
+    QString city;
+    // location parameter of server API
+    QString location;
+    QStringList dayDates;
+};
+
+struct ScheduleImport
+{
+    QList<ImportedSpeaker> speakers;
+    QList<ImportedSchedule> schedules;
+    // empty if all was parsed
+    QString errorMessage;
+
+    bool isValid() const {
+        return errorMessage.isEmpty();
+    }
+    const ImportedSchedule* scheduleForConference(const int conferenceId) const {
+        for (int i = 0; i < schedules.size(); ++i) {
+            if(schedules.at(i).conferenceId == conferenceId) {
+                return &schedules.at(i);
+            }
+        }
+        return nullptr;
+    }
+};
+
+/*
+ * Parses data received from server without touching DataManager
+ * importAll() runs on a worker thread (QtConcurrent),
+ * progress is reported by signal (queued to GUI thread)
+ * DataUtil applies the result to the conference data
+ * JSON values are read directly into the plain values above,
+ * using the same mapping rules as SessionAPI / SpeakerAPI fillFromForeignMap()
+ */
+class ScheduleImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ScheduleImporter(QObject *parent = nullptr);
+
+    ScheduleImport importAll(const QString conferenceDataPath, const QList<ScheduleSource> sources);
+
+    // GUI thread: values from server into the Session
+    // (without tracks: must be resolved against the Conference)
+    static void fillSession(Session* session, const ImportedSession& importedSession);
+
+signals:
+    void importProgress(const QString progressInfo);
+
+private:
+    QJsonDocument readJsonFile(const QString path);
+    bool importSpeaker(const QString speakerPath, ScheduleImport& result);
+    bool importSchedule(const QString schedulePath, const ScheduleSource& source, ScheduleImport& result);
+    void importSession(const QJsonObject& sessionObject, ImportedSession& session);
+    QStringList presenterKeys(const QJsonValue& persons);
+    bool checkIfIgnored(const ImportedSession& session, const QString& roomName);
+    int durationMinutes(const QString& duration, const int sessionId);
+};
+
+#endif // SCHEDULEIMPORTER_HPP
@@ -0,0 +1,266 @@
+#include "searchindex.hpp"
+
+#include <algorithm>
+
+#include <QtAlgorithms>
+#include <QDebug>
+
+// removed records are compacted if at least so many
+static const int MIN_REMOVED_TO_COMPACT = 256;
+
+SearchIndex::SearchIndex() : mRemovedRecords(0), mSortedTermsDirty(false)
+{
+}
+
+void SearchIndex::clear()
+{
+    mRecords.clear();
+    mSlotByKey.clear();
+    mRemovedRecords = 0;
+    mTerms.clear();
+    mPostings.clear();
+    mTermIds.clear();
+    mSortedTermIds.clear();
+    mSortedTermsDirty = false;
+}
+
+bool SearchIndex::isEmpty() const
+{
+    return mSlotByKey.isEmpty();
+}
+
+int SearchIndex::size() const
+{
+    return mSlotByKey.size();
+}
+
+quint64 SearchIndex::keyOf(const Kind kind, const int id)
+{
+    return (static_cast<quint64>(kind) << 32) | static_cast<quint32>(id);
+}
+
+bool SearchIndex::contains(const Kind kind, const int id) const
+{
+    return mSlotByKey.contains(keyOf(kind, id));
+}
+
+/*
+ * NFKD splits characters with diacritics into base character and combining marks
+ * marks are dropped, the rest case folded
+ */
+QString SearchIndex::fold(const QString& text)
+{
+    const QString decomposed = text.normalized(QString::NormalizationForm_KD);
+    QString folded;
+    folded.reserve(decomposed.size());
+    for (int i = 0; i < decomposed.size(); ++i) {
+        const QChar c = decomposed.at(i);
+        if (c.category() == QChar::Mark_NonSpacing) {
+            continue;
+        }
+        // no decomposition for German sharp s
+        if (c == QChar(0x00DF)) {
+            folded.append(QLatin1String("ss"));
+            continue;
+        }
+        folded.append(c);
+    }
+    return folded.toCaseFolded();
+}
+
+QStringList SearchIndex::terms(const QString& text)
+{
+    QStringList termList;
+    const QString folded = fold(text);
+    int termStart = -1;
+    for (int i = 0; i <= folded.size(); ++i) {
+        const bool isTermChar = i < folded.size() && folded.at(i).isLetterOrNumber();
+        if (isTermChar) {
+            if (termStart < 0) {
+                termStart = i;
+            }
+            continue;
+        }
+        if (termStart >= 0) {
+            const QString term = folded.mid(termStart, i - termStart);
+            if (!termList.contains(term)) {
+                termList.append(term);
+            }
+            termStart = -1;
+        }
+    }
+    return termList;
+}
+
+int SearchIndex::termId(const QString& term)
+{
+    QHash<QString, int>::const_iterator it = mTermIds.constFind(term);
+    if (it != mTermIds.constEnd()) {
+        return it.value();
+    }
+    const int id = mTerms.size();
+    mTerms.append(term);
+    mPostings.append(QVector<int>());
+    mTermIds.insert(term, id);
+    mSortedTermsDirty = true;
+    return id;
+}
+
+void SearchIndex::insert(const Kind kind, const int id, const QStringList& texts)
+{
+    remove(kind, id);
+    Record record;
+    record.kind = kind;
+    record.id = id;
+    record.removed = false;
+    const int slot = mRecords.size();
+    for (int t = 0; t < texts.size(); ++t) {
+        const QStringList textTerms = terms(texts.at(t));
+        for (int i = 0; i < textTerms.size(); ++i) {
+            const int termIndex = termId(textTerms.at(i));
+            QVector<int>& postings = mPostings[termIndex];
+            // same term in more than one text
+            if (!postings.isEmpty() && postings.last() == slot) {
+                continue;
+            }
+            // new slot is the highest one: postings stay sorted
+            postings.append(slot);
+            record.termIds.append(termIndex);
+        }
+    }
+    mRecords.append(record);
+    mSlotByKey.insert(keyOf(kind, id), slot);
+}
+
+void SearchIndex::remove(const Kind kind, const int id)
+{
+    const int slot = mSlotByKey.take(keyOf(kind, id), -1);
+    if (slot < 0) {
+        return;
+    }
+    Record& record = mRecords[slot];
+    for (int i = 0; i < record.termIds.size(); ++i) {
+        QVector<int>& postings = mPostings[record.termIds.at(i)];
+        QVector<int>::iterator it = std::lower_bound(postings.begin(), postings.end(), slot);
+        if (it != postings.end() && *it == slot) {
+            postings.erase(it);
+        }
+    }
+    record.termIds.clear();
+    record.removed = true;
+    mRemovedRecords++;
+    if (mRemovedRecords >= MIN_REMOVED_TO_COMPACT && mRemovedRecords > mSlotByKey.size()) {
+        compact();
+    }
+}
+
+// new slots without gaps, same order
+void SearchIndex::compact()
+{
+    QVector<int> newSlots(mRecords.size(), -1);
+    QVector<Record> records;
+    records.reserve(mSlotByKey.size());
+    for (int i = 0; i < mRecords.size(); ++i) {
+        if (mRecords.at(i).removed) {
+            continue;
+        }
+        newSlots[i] = records.size();
+        records.append(mRecords.at(i));
+    }
+    for (int t = 0; t < mPostings.size(); ++t) {
+        QVector<int>& postings = mPostings[t];
+        for (int i = 0; i < postings.size(); ++i) {
+            postings[i] = newSlots.at(postings.at(i));
+        }
+    }
+    mRecords = records;
+    QMutableHashIterator<quint64, int> slotIterator(mSlotByKey);
+    while (slotIterator.hasNext()) {
+        slotIterator.next();
+        slotIterator.setValue(newSlots.at(slotIterator.value()));
+    }
+    mRemovedRecords = 0;
+    qDebug() << "SearchIndex compacted - records #" << mRecords.size();
+}
+
+void SearchIndex::sortTerms() const
+{
+    if (!mSortedTermsDirty && mSortedTermIds.size() == mTerms.size()) {
+        return;
+    }
+    mSortedTermIds.resize(mTerms.size());
+    for (int i = 0; i < mSortedTermIds.size(); ++i) {
+        mSortedTermIds[i] = i;
+    }
+    const QVector<QString>& allTerms = mTerms;
+    std::sort(mSortedTermIds.begin(), mSortedTermIds.end(), [&allTerms](const int a, const int b) {
+        return allTerms.at(a) < allTerms.at(b);
+    });
+    mSortedTermsDirty = false;
+}
+
+// sets the bits of all records with a term starting with prefix
+void SearchIndex::collectPrefix(const QString& prefix, QVector<quint64>& bits) const
+{
+    const QVector<QString>& allTerms = mTerms;
+    QVector<int>::const_iterator it = std::lower_bound(mSortedTermIds.constBegin(), mSortedTermIds.constEnd(), prefix,
+                                                       [&allTerms](const int termIndex, const QString& value) {
+        return allTerms.at(termIndex) < value;
+    });
+    for (; it != mSortedTermIds.constEnd() && allTerms.at(*it).startsWith(prefix); ++it) {
+        const QVector<int>& postings = mPostings.at(*it);
+        for (int i = 0; i < postings.size(); ++i) {
+            const int slot = postings.at(i);
+            bits[slot >> 6] |= Q_UINT64_C(1) << (slot & 63);
+        }
+    }
+}
+
+QList<SearchIndex::Hit> SearchIndex::search(const QString& query, const int maxHits, int* totalHits) const
+{
+    QList<Hit> hits;
+    if (totalHits) {
+        *totalHits = 0;
+    }
+    const QStringList queryTerms = terms(query);
+    if (queryTerms.isEmpty() || mSlotByKey.isEmpty()) {
+        return hits;
+    }
+    sortTerms();
+    const int words = (mRecords.size() + 63) / 64;
+    QVector<quint64> matching;
+    for (int q = 0; q < queryTerms.size(); ++q) {
+        QVector<quint64> termBits(words, 0);
+        collectPrefix(queryTerms.at(q), termBits);
+        if (q == 0) {
+            matching = termBits;
+            continue;
+        }
+        bool any = false;
+        for (int w = 0; w < words; ++w) {
+            matching[w] &= termBits.at(w);
+            any = any || matching.at(w);
+        }
+        if (!any) {
+            return hits;
+        }
+    }
+    int total = 0;
+    for (int w = 0; w < words; ++w) {
+        quint64 word = matching.at(w);
+        total += qPopulationCount(word);
+        while (word && hits.size() < maxHits) {
+            const Record& record = mRecords.at(w * 64 + static_cast<int>(qCountTrailingZeroBits(word)));
+            Hit hit;
+            hit.kind = record.kind;
+            hit.id = record.id;
+            hits.append(hit);
+            // clear lowest set bit
+            word &= word - 1;
+        }
+    }
+    if (totalHits) {
+        *totalHits = total;
+    }
+    return hits;
+}
@@ -0,0 +1,89 @@
+#ifndef SEARCHINDEX_HPP
+#define SEARCHINDEX_HPP
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QVector>
+#include <QHash>
+
+/*
+ * Inverted full-text index over Sessions, Speaker, Tracks and Rooms
+ * records are identified by kind and id, the texts of a record are folded
+ * (case, diacritics: "Müller" -> "muller") and split into terms
+ *
+ * search() matches every query term as prefix of an indexed term,
+ * all query terms must match (AND)
+ * prefix lookup: binary search in the sorted terms,
+ * union / intersection of posting lists: bitsets over record slots
+ *
+ * records keep their slot (insert order) - results are returned in slot order
+ * insert() of an existing record replaces it (new slot at the end)
+ * removed slots are compacted if there are more removed than live records
+ *
+ * not thread-safe: GUI thread only
+ */
+class SearchIndex
+{
+public:
+    enum Kind {
+        SessionRecord,
+        SpeakerRecord,
+        TrackRecord,
+        RoomRecord
+    };
+
+    struct Hit
+    {
+        Kind kind;
+        int id;
+    };
+
+    SearchIndex();
+
+    void clear();
+    bool isEmpty() const;
+    // live records
+    int size() const;
+    bool contains(const Kind kind, const int id) const;
+
+    void insert(const Kind kind, const int id, const QStringList& texts);
+    void remove(const Kind kind, const int id);
+
+    // max maxHits in slot order, totalHits: all matching records
+    QList<Hit> search(const QString& query, const int maxHits, int* totalHits = nullptr) const;
+
+    // lower case without diacritics
+    static QString fold(const QString& text);
+    // folded, unique terms
+    static QStringList terms(const QString& text);
+
+private:
+    struct Record
+    {
+        Kind kind;
+        int id;
+        QVector<int> termIds;
+        bool removed;
+    };
+
+    QVector<Record> mRecords;
+    QHash<quint64, int> mSlotByKey;
+    int mRemovedRecords;
+
+    QVector<QString> mTerms;
+    // sorted record slots for each term
+    QVector<QVector<int> > mPostings;
+    QHash<QString, int> mTermIds;
+    // term ids sorted by term - rebuilt lazily after new terms were added
+    mutable QVector<int> mSortedTermIds;
+    mutable bool mSortedTermsDirty;
+
+    static quint64 keyOf(const Kind kind, const int id);
+    int termId(const QString& term);
+    void sortTerms() const;
+    void compact();
+    void collectPrefix(const QString& prefix, QVector<quint64>& bits) const;
+};
+
+#endif // SEARCHINDEX_HPP
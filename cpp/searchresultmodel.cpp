@@ -0,0 +1,155 @@
+#include "searchresultmodel.hpp"
+
+#include <QElapsedTimer>
+#include <QDebug>
+
+static const int DEFAULT_MAX_HITS = 100;
+
+SearchResultModel::SearchResultModel(QObject *parent) : QAbstractListModel(parent), mSearchIndex(nullptr), mDataManager(nullptr),
+    mTotalHits(0), mMaxHits(DEFAULT_MAX_HITS)
+{
+}
+
+void SearchResultModel::init(SearchIndex* searchIndex, DataManager* dataManager)
+{
+    mSearchIndex = searchIndex;
+    mDataManager = dataManager;
+}
+
+int SearchResultModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return mHits.size();
+}
+
+QHash<int, QByteArray> SearchResultModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[KindRole] = "kind";
+    roles[IdRole] = "id";
+    roles[TitleRole] = "title";
+    roles[SubtitleRole] = "subtitle";
+    roles[DataObjectRole] = "dataObject";
+    return roles;
+}
+
+QObject* SearchResultModel::dataObject(const SearchIndex::Hit& hit) const
+{
+    switch (hit.kind) {
+    case SearchIndex::SessionRecord:
+        return mDataManager->findSessionBySessionId(hit.id);
+    case SearchIndex::SpeakerRecord:
+        return mDataManager->findSpeakerBySpeakerId(hit.id);
+    case SearchIndex::TrackRecord:
+        return mDataManager->findSessionTrackByTrackId(hit.id);
+    default:
+        return mDataManager->findRoomByRoomId(hit.id);
+    }
+}
+
+QVariant SearchResultModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= mHits.size()) {
+        return QVariant();
+    }
+    const SearchIndex::Hit& hit = mHits.at(index.row());
+    switch (role) {
+    case KindRole:
+        switch (hit.kind) {
+        case SearchIndex::SessionRecord:
+            return QStringLiteral("session");
+        case SearchIndex::SpeakerRecord:
+            return QStringLiteral("speaker");
+        case SearchIndex::TrackRecord:
+            return QStringLiteral("track");
+        default:
+            return QStringLiteral("room");
+        }
+    case IdRole:
+        return hit.id;
+    case DataObjectRole:
+        return QVariant::fromValue(dataObject(hit));
+    default:
+        break;
+    }
+    QObject* object = dataObject(hit);
+    if (!object) {
+        return QVariant();
+    }
+    const bool isTitle = role == TitleRole || role == Qt::DisplayRole;
+    switch (hit.kind) {
+    case SearchIndex::SessionRecord: {
+        Session* session = static_cast<Session*>(object);
+        if (isTitle) {
+            return session->title();
+        }
+        Room* room = mDataManager->findRoomByRoomId(session->room());
+        return room ? room->roomName() : QString();
+    }
+    case SearchIndex::SpeakerRecord: {
+        Speaker* speaker = static_cast<Speaker*>(object);
+        return isTitle ? speaker->name() : speaker->title();
+    }
+    case SearchIndex::TrackRecord:
+        return isTitle ? static_cast<SessionTrack*>(object)->name() : QString();
+    default:
+        return isTitle ? static_cast<Room*>(object)->roomName() : QString();
+    }
+}
+
+QString SearchResultModel::query() const
+{
+    return mQuery;
+}
+
+void SearchResultModel::setQuery(const QString& query)
+{
+    if (query == mQuery) {
+        return;
+    }
+    mQuery = query;
+    emit queryChanged();
+    refresh();
+}
+
+int SearchResultModel::count() const
+{
+    return mHits.size();
+}
+
+int SearchResultModel::totalHits() const
+{
+    return mTotalHits;
+}
+
+int SearchResultModel::maxHits() const
+{
+    return mMaxHits;
+}
+
+void SearchResultModel::setMaxHits(const int maxHits)
+{
+    if (maxHits == mMaxHits || maxHits < 1) {
+        return;
+    }
+    mMaxHits = maxHits;
+    emit maxHitsChanged();
+    refresh();
+}
+
+void SearchResultModel::refresh()
+{
+    beginResetModel();
+    mHits.clear();
+    mTotalHits = 0;
+    if (mSearchIndex) {
+        QElapsedTimer timer;
+        timer.start();
+        mHits = mSearchIndex->search(mQuery, mMaxHits, &mTotalHits);
+        qDebug() << "search" << mQuery << "hits #" << mTotalHits << "in" << timer.nsecsElapsed() / 1000 << "us";
+    }
+    endResetModel();
+    emit countChanged();
+}
@@ -0,0 +1,72 @@
+#ifndef SEARCHRESULTMODEL_HPP
+#define SEARCHRESULTMODEL_HPP
+
+#include <QAbstractListModel>
+
+#include "searchindex.hpp"
+#include "gen/DataManager.hpp"
+
+/*
+ * search-as-you-type results from SearchIndex
+ * set query (per ex. from SearchTextPane currentSearchText)
+ * rows: kind ("session", "speaker", "track", "room"), id, title, subtitle
+ * and the DataObject (Session*, Speaker*, SessionTrack*, Room*)
+ * DataObjects are looked up by id when displayed
+ */
+class SearchResultModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged)
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    // all matching records, count is limited by maxHits
+    Q_PROPERTY(int totalHits READ totalHits NOTIFY countChanged)
+    Q_PROPERTY(int maxHits READ maxHits WRITE setMaxHits NOTIFY maxHitsChanged)
+
+public:
+    enum SearchResultRoles {
+        KindRole = Qt::UserRole + 1,
+        IdRole,
+        TitleRole,
+        SubtitleRole,
+        DataObjectRole
+    };
+
+    explicit SearchResultModel(QObject *parent = nullptr);
+
+    void init(SearchIndex* searchIndex, DataManager* dataManager);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    QString query() const;
+    void setQuery(const QString& query);
+
+    int count() const;
+    int totalHits() const;
+
+    int maxHits() const;
+    void setMaxHits(const int maxHits);
+
+    // search again: index was changed
+    Q_INVOKABLE
+    void refresh();
+
+signals:
+    void queryChanged();
+    void countChanged();
+    void maxHitsChanged();
+
+private:
+    SearchIndex* mSearchIndex;
+    DataManager* mDataManager;
+    QString mQuery;
+    QList<SearchIndex::Hit> mHits;
+    int mTotalHits;
+    int mMaxHits;
+
+    QObject* dataObject(const SearchIndex::Hit& hit) const;
+};
+
+#endif // SEARCHRESULTMODEL_HPP
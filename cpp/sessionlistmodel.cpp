@@ -0,0 +1,344 @@
+#include "sessionlistmodel.hpp"
+
+#include "datautil.hpp"
+#include "gen/Day.hpp"
+#include "gen/Room.hpp"
+#include "gen/SessionTrack.hpp"
+#include "gen/Speaker.hpp"
+#include "gen/SessionLists.hpp"
+
+#include <QDebug>
+
+SessionListModel::SessionListModel(QObject* container, DataUtil* dataUtil) : QAbstractListModel(container),
+    mContainer(container), mDataUtil(dataUtil), mSyncPending(false)
+{
+    mSessions = containerSessions();
+    for (int i = 0; i < mSessions.size(); ++i) {
+        connectSession(mSessions.at(i));
+    }
+    bool res = false;
+    if (qobject_cast<SessionLists*>(mContainer)) {
+        res = connect(mContainer, SIGNAL(scheduledSessionsPropertyListChanged()), this, SLOT(onSessionsChanged()));
+    } else {
+        res = connect(mContainer, SIGNAL(sessionsPropertyListChanged()), this, SLOT(onSessionsChanged()));
+    }
+    if (!res) {
+        Q_ASSERT(res);
+    }
+}
+
+QList<Session*> SessionListModel::containerSessions() const
+{
+    if (Day* day = qobject_cast<Day*>(mContainer)) {
+        return day->sessions();
+    }
+    if (Room* room = qobject_cast<Room*>(mContainer)) {
+        return room->sessions();
+    }
+    if (SessionTrack* sessionTrack = qobject_cast<SessionTrack*>(mContainer)) {
+        return sessionTrack->sessions();
+    }
+    if (Speaker* speaker = qobject_cast<Speaker*>(mContainer)) {
+        return speaker->sessions();
+    }
+    if (SessionLists* sessionLists = qobject_cast<SessionLists*>(mContainer)) {
+        return sessionLists->scheduledSessions();
+    }
+    qWarning() << "SessionListModel: no sessions container" << mContainer;
+    return QList<Session*>();
+}
+
+int SessionListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return mSessions.size();
+}
+
+QHash<int, QByteArray> SessionListModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    // same name as for QQmlListProperty models: delegates can use model.modelData
+    roles[ModelDataRole] = "modelData";
+    roles[SessionIdRole] = "sessionId";
+    roles[TitleRole] = "title";
+    roles[SortKeyRole] = "sortKey";
+    roles[IsFavoriteRole] = "isFavorite";
+    roles[IsGenericScheduleSessionRole] = "isGenericScheduleSession";
+    roles[ScheduleItemImageRole] = "scheduleItemImage";
+    roles[StartToEndRole] = "startToEnd";
+    roles[RoomNameRole] = "roomName";
+    roles[SpeakerNamesRole] = "speakerNames";
+    roles[TrackColorRole] = "trackColor";
+    return roles;
+}
+
+QVariant SessionListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= mSessions.size()) {
+        return QVariant();
+    }
+    Session* session = mSessions.at(index.row());
+    switch (role) {
+    case ModelDataRole:
+        return QVariant::fromValue(session);
+    case SessionIdRole:
+        return session->sessionId();
+    case Qt::DisplayRole:
+    case TitleRole:
+        return session->title();
+    case SortKeyRole:
+        return session->sortKey();
+    case IsFavoriteRole:
+        return session->isFavorite();
+    case IsGenericScheduleSessionRole:
+        return session->isGenericScheduleSession();
+    case ScheduleItemImageRole:
+        return mDataUtil->scheduleItemImageForSession(session);
+    case StartToEndRole:
+        return mDataUtil->displayStartToEnd(session);
+    case RoomNameRole:
+        return session->roomAsDataObject() ? session->roomAsDataObject()->roomName() : QString();
+    case SpeakerNamesRole:
+        return mDataUtil->speakerNamesForSession(session);
+    case TrackColorRole:
+        return mDataUtil->trackColorFirstTrack(session);
+    default:
+        return QVariant();
+    }
+}
+
+int SessionListModel::count() const
+{
+    return mSessions.size();
+}
+
+Session* SessionListModel::sessionAt(const int row) const
+{
+    if (row < 0 || row >= mSessions.size()) {
+        return nullptr;
+    }
+    return mSessions.at(row);
+}
+
+int SessionListModel::indexOf(Session* session) const
+{
+    return mSessions.indexOf(session);
+}
+
+// clearSessions() + addToSessions() while sorting sessions into containers
+// emit sessionsPropertyListChanged() for each Session: only sync once
+void SessionListModel::onSessionsChanged()
+{
+    if (mSyncPending) {
+        return;
+    }
+    mSyncPending = true;
+    QMetaObject::invokeMethod(this, "onQueuedSync", Qt::QueuedConnection);
+}
+
+void SessionListModel::onQueuedSync()
+{
+    if (mSyncPending) {
+        sync();
+    }
+}
+
+/*
+ * walk old rows and new sessions in parallel (both sorted by sortKey):
+ * equal: row stays
+ * old row not in new list or new session comes from a later row: remove row
+ * new session not in remaining old rows: insert
+ * a Session moved to another position is removed and inserted again
+ */
+void SessionListModel::sync()
+{
+    mSyncPending = false;
+    const QList<Session*> sessions = containerSessions();
+    if (sessions == mSessions) {
+        return;
+    }
+    const int oldCount = mSessions.size();
+    const QSet<Session*> target = sessions.toSet();
+    QSet<Session*> remaining = mSessions.toSet();
+    int row = 0;
+    int j = 0;
+    while (j < sessions.size()) {
+        Session* session = sessions.at(j);
+        if (row < mSessions.size() && mSessions.at(row) == session) {
+            remaining.remove(session);
+            row++;
+            j++;
+            continue;
+        }
+        int last = row;
+        while (last < mSessions.size() && mSessions.at(last) != session
+               && (!target.contains(mSessions.at(last)) || remaining.contains(session))) {
+            remaining.remove(mSessions.at(last));
+            last++;
+        }
+        if (last > row) {
+            removeSessions(row, last - row);
+            continue;
+        }
+        int end = j;
+        while (end < sessions.size() && !remaining.contains(sessions.at(end))) {
+            end++;
+        }
+        insertSessions(row, sessions.mid(j, end - j));
+        row += end - j;
+        j = end;
+    }
+    if (row < mSessions.size()) {
+        removeSessions(row, mSessions.size() - row);
+    }
+    if (mSessions.size() != oldCount) {
+        emit countChanged();
+    }
+}
+
+void SessionListModel::insertSessions(const int row, const QList<Session*>& sessions)
+{
+    beginInsertRows(QModelIndex(), row, row + sessions.size() - 1);
+    for (int i = 0; i < sessions.size(); ++i) {
+        mSessions.insert(row + i, sessions.at(i));
+        connectSession(sessions.at(i));
+    }
+    endInsertRows();
+}
+
+void SessionListModel::removeSessions(const int row, const int count)
+{
+    beginRemoveRows(QModelIndex(), row, row + count - 1);
+    for (int i = 0; i < count; ++i) {
+        disconnectSession(mSessions.takeAt(row));
+    }
+    endRemoveRows();
+}
+
+// Session deleted without being removed from the container before
+// connections are already gone
+void SessionListModel::onSessionDestroyed(QObject* object)
+{
+    const int row = mSessions.indexOf(static_cast<Session*>(object));
+    if (row < 0) {
+        return;
+    }
+    beginRemoveRows(QModelIndex(), row, row);
+    mSessions.removeAt(row);
+    endRemoveRows();
+    emit countChanged();
+}
+
+void SessionListModel::connectSession(Session* session)
+{
+    bool res = connect(session, SIGNAL(destroyed(QObject*)), this, SLOT(onSessionDestroyed(QObject*)));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(titleChanged(QString)), this, SLOT(onTitleChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(sortKeyChanged(QString)), this, SLOT(onSortKeyChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(isFavoriteChanged(bool)), this, SLOT(onIsFavoriteChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(isGenericScheduleSessionChanged(bool)), this, SLOT(onScheduleItemChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(isRegistrationChanged(bool)), this, SLOT(onScheduleItemChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(isLunchChanged(bool)), this, SLOT(onScheduleItemChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(isEventChanged(bool)), this, SLOT(onScheduleItemChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(startTimeChanged(QTime)), this, SLOT(onTimeChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(endTimeChanged(QTime)), this, SLOT(onTimeChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(roomAsDataObjectChanged(Room*)), this, SLOT(onRoomChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(presenterPropertyListChanged()), this, SLOT(onPresenterChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+    res = connect(session, SIGNAL(sessionTracksPropertyListChanged()), this, SLOT(onSessionTracksChanged()));
+    if (!res) {
+        Q_ASSERT(res);
+    }
+}
+
+void SessionListModel::disconnectSession(Session* session)
+{
+    // a Session is only once in the list
+    session->disconnect(this);
+}
+
+void SessionListModel::sessionChanged(const QVector<int>& roles)
+{
+    const int row = mSessions.indexOf(qobject_cast<Session*>(sender()));
+    if (row < 0) {
+        return;
+    }
+    const QModelIndex changedIndex = index(row);
+    emit dataChanged(changedIndex, changedIndex, roles);
+}
+
+void SessionListModel::onTitleChanged()
+{
+    sessionChanged(QVector<int>() << TitleRole << Qt::DisplayRole);
+}
+
+void SessionListModel::onSortKeyChanged()
+{
+    sessionChanged(QVector<int>() << SortKeyRole);
+}
+
+void SessionListModel::onIsFavoriteChanged()
+{
+    sessionChanged(QVector<int>() << IsFavoriteRole);
+}
+
+void SessionListModel::onScheduleItemChanged()
+{
+    sessionChanged(QVector<int>() << IsGenericScheduleSessionRole << ScheduleItemImageRole);
+}
+
+void SessionListModel::onTimeChanged()
+{
+    sessionChanged(QVector<int>() << StartToEndRole);
+}
+
+void SessionListModel::onRoomChanged()
+{
+    sessionChanged(QVector<int>() << RoomNameRole);
+}
+
+void SessionListModel::onPresenterChanged()
+{
+    sessionChanged(QVector<int>() << SpeakerNamesRole);
+}
+
+void SessionListModel::onSessionTracksChanged()
+{
+    sessionChanged(QVector<int>() << TrackColorRole);
+}
@@ -0,0 +1,92 @@
+#ifndef SESSIONLISTMODEL_HPP
+#define SESSIONLISTMODEL_HPP
+
+#include <QAbstractListModel>
+#include <QSet>
+
+#include "gen/Session.hpp"
+
+class DataUtil;
+
+/*
+ * sessions of a Day, Room, SessionTrack or Speaker as ListView model
+ * (or the scheduled sessions of SessionLists: My Schedule)
+ * the container is the parent: model is deleted together with the container
+ * get the model from dataUtil.sessionListModel(container)
+ *
+ * rows follow container->sessions():
+ * changes of the list are collected and synced once (queued or sync())
+ * only inserted / removed rows are signaled, unchanged rows keep their delegates
+ * changed properties of a Session (per ex. isFavorite) only emit dataChanged for its row
+ */
+class SessionListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    enum SessionRoles {
+        ModelDataRole = Qt::UserRole + 1,
+        SessionIdRole,
+        TitleRole,
+        SortKeyRole,
+        IsFavoriteRole,
+        IsGenericScheduleSessionRole,
+        ScheduleItemImageRole,
+        StartToEndRole,
+        RoomNameRole,
+        SpeakerNamesRole,
+        TrackColorRole
+    };
+
+    // container: Day*, Room*, SessionTrack*, Speaker* or SessionLists*
+    SessionListModel(QObject* container, DataUtil* dataUtil);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    int count() const;
+
+    Q_INVOKABLE
+    Session* sessionAt(const int row) const;
+
+    Q_INVOKABLE
+    int indexOf(Session* session) const;
+
+    // rows = current sessions of the container
+    void sync();
+
+signals:
+    void countChanged();
+
+private slots:
+    void onSessionsChanged();
+    void onQueuedSync();
+    void onSessionDestroyed(QObject* object);
+
+    void onTitleChanged();
+    void onSortKeyChanged();
+    void onIsFavoriteChanged();
+    void onScheduleItemChanged();
+    void onTimeChanged();
+    void onRoomChanged();
+    void onPresenterChanged();
+    void onSessionTracksChanged();
+
+private:
+    QObject* mContainer;
+    DataUtil* mDataUtil;
+    QList<Session*> mSessions;
+    bool mSyncPending;
+
+    QList<Session*> containerSessions() const;
+    void connectSession(Session* session);
+    void disconnectSession(Session* session);
+    void insertSessions(const int row, const QList<Session*>& sessions);
+    void removeSessions(const int row, const int count);
+    void sessionChanged(const QVector<int>& roles);
+};
+
+#endif // SESSIONLISTMODEL_HPP
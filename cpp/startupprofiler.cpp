@@ -0,0 +1,169 @@
+#include "startupprofiler.hpp"
+
+#include <QStandardPaths>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+#include <QDateTime>
+#include <QDebug>
+
+static const QString startupProfileFile = "startupProfile.txt";
+
+StartupProfiler* StartupProfiler::instance()
+{
+    // lives until the app exits
+    static StartupProfiler* profiler = new StartupProfiler();
+    return profiler;
+}
+
+StartupProfiler::StartupProfiler(QObject *parent) : QObject(parent), mRecording(false), mFirstFrameSeen(0), mFirstFrameNs(0)
+{
+}
+
+void StartupProfiler::start()
+{
+    mPhases.clear();
+    mOpenPhases.clear();
+    mFirstFrameSeen.storeRelease(0);
+    mTimer.start();
+    mRecording = true;
+    emit recordingChanged();
+}
+
+bool StartupProfiler::isRecording() const
+{
+    return mRecording;
+}
+
+int StartupProfiler::addPhase(const QString& name, const bool isMark, const qint64 startNs)
+{
+    Phase phase;
+    phase.name = name;
+    phase.startNs = startNs;
+    phase.endNs = -1;
+    phase.depth = mOpenPhases.size();
+    phase.isMark = isMark;
+    mPhases.append(phase);
+    return mPhases.size() - 1;
+}
+
+void StartupProfiler::beginPhase(const QString& name)
+{
+    if (!mRecording) {
+        return;
+    }
+    mOpenPhases.append(addPhase(name, false, mTimer.nsecsElapsed()));
+}
+
+void StartupProfiler::endPhase(const QString& name)
+{
+    if (!mRecording) {
+        return;
+    }
+    // inner phases not ended explicitly are closed together with the outer one
+    for (int i = mOpenPhases.size() - 1; i >= 0; --i) {
+        if (mPhases.at(mOpenPhases.at(i)).name == name) {
+            const qint64 now = mTimer.nsecsElapsed();
+            while (mOpenPhases.size() > i) {
+                mPhases[mOpenPhases.takeLast()].endNs = now;
+            }
+            return;
+        }
+    }
+    qWarning() << "StartupProfiler: phase not started:" << name;
+}
+
+void StartupProfiler::mark(const QString& name)
+{
+    if (!mRecording) {
+        return;
+    }
+    addPhase(name, true, mTimer.nsecsElapsed());
+}
+
+// threaded render loop: render thread, mPhases must not be touched here
+void StartupProfiler::onFrameSwapped()
+{
+    if (mFirstFrameSeen.loadAcquire()) {
+        return;
+    }
+    const qint64 now = mTimer.nsecsElapsed();
+    if (!mFirstFrameSeen.testAndSetOrdered(0, 1)) {
+        return;
+    }
+    mFirstFrameNs = now;
+    QMetaObject::invokeMethod(this, "addFirstFrameMark", Qt::QueuedConnection);
+}
+
+// GUI thread
+void StartupProfiler::addFirstFrameMark()
+{
+    if (!mRecording) {
+        return;
+    }
+    addPhase(QStringLiteral("first frame"), true, mFirstFrameNs);
+}
+
+void StartupProfiler::finishStartup()
+{
+    if (!mRecording) {
+        return;
+    }
+    mark(QStringLiteral("startup done"));
+    mRecording = false;
+    emit recordingChanged();
+    qDebug().noquote() << report();
+    dumpReport();
+}
+
+/*
+ * start and duration in ms since start() (main)
+ *    start  duration  phase
+ *     12.4      85.0  QML engine load
+ *     52.1       9.3    initSpeakerFromCache
+ */
+QString StartupProfiler::report() const
+{
+    QString text;
+    QTextStream out(&text);
+    out << "Startup Profile " << QDateTime::currentDateTime().toString(Qt::ISODate) << "\n";
+    out << qSetFieldWidth(10) << right << "start" << "duration" << qSetFieldWidth(0) << "  phase\n";
+    for (int i = 0; i < mPhases.size(); ++i) {
+        const Phase& phase = mPhases.at(i);
+        out << qSetFieldWidth(10) << right << qSetRealNumberPrecision(1) << fixed;
+        out << phase.startNs / 1000000.0;
+        if (phase.isMark) {
+            out << "-";
+        } else if (phase.endNs < 0) {
+            out << "open";
+        } else {
+            out << (phase.endNs - phase.startNs) / 1000000.0;
+        }
+        out << qSetFieldWidth(0) << "  " << QString(phase.depth * 2, ' ') << phase.name << "\n";
+    }
+    if (mRecording) {
+        out << "(still recording)\n";
+    }
+    out.flush();
+    return text;
+}
+
+QString StartupProfiler::dumpReport(const QString& filePath) const
+{
+    QString path = filePath;
+    if (path.isEmpty()) {
+        const QString dataRoot = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+        // iOS: the dir must be created first
+        QDir().mkpath(dataRoot);
+        path = dataRoot + "/" + startupProfileFile;
+    }
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "StartupProfiler: cannot write" << path;
+        return QString();
+    }
+    file.write(report().toUtf8());
+    file.close();
+    qDebug() << "Startup Profile written to" << path;
+    return path;
+}
@@ -0,0 +1,111 @@
+#ifndef STARTUPPROFILER_HPP
+#define STARTUPPROFILER_HPP
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+#include <QAtomicInt>
+
+/*
+ * Monotonic timestamps of startup phases
+ * main() -> ApplicationUI -> QML engine load -> first frame
+ * -> dataManager.init() (all init*FromCache) -> resolve passes -> startup done
+ *
+ * phases can be nested (per ex. initSessionFromCache inside init)
+ * recording stops with finishStartup(): the report is logged and written
+ * to <AppDataLocation>/startupProfile.txt, so it can be compared
+ * release over release. Visible in debug builds at the About page.
+ *
+ * GUI thread only - except onFrameSwapped(), see there
+ */
+class StartupProfiler : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool recording READ isRecording NOTIFY recordingChanged)
+
+public:
+    static StartupProfiler* instance();
+
+    // call first thing in main()
+    void start();
+
+    Q_INVOKABLE
+    void beginPhase(const QString& name);
+
+    Q_INVOKABLE
+    void endPhase(const QString& name);
+
+    // a point in time without duration (per ex. first frame)
+    Q_INVOKABLE
+    void mark(const QString& name);
+
+    Q_INVOKABLE
+    void finishStartup();
+
+    Q_INVOKABLE
+    QString report() const;
+
+    // returns the path of the written file, empty if not written
+    Q_INVOKABLE
+    QString dumpReport(const QString& filePath = QString()) const;
+
+    bool isRecording() const;
+
+signals:
+    void recordingChanged();
+
+public slots:
+    // connected direct to QQuickWindow::frameSwapped(): called from the render thread
+    // only takes the timestamp, the mark is added on the GUI thread
+    void onFrameSwapped();
+
+private slots:
+    void addFirstFrameMark();
+
+private:
+    explicit StartupProfiler(QObject *parent = nullptr);
+
+    struct Phase
+    {
+        QString name;
+        qint64 startNs;
+        // -1: not finished or a mark
+        qint64 endNs;
+        int depth;
+        bool isMark;
+    };
+
+    QElapsedTimer mTimer;
+    QList<Phase> mPhases;
+    // indexes into mPhases of currently open phases
+    QList<int> mOpenPhases;
+    bool mRecording;
+    // set once from the render thread, mFirstFrameNs is written before
+    QAtomicInt mFirstFrameSeen;
+    qint64 mFirstFrameNs;
+
+    int addPhase(const QString& name, const bool isMark, const qint64 startNs);
+};
+
+/*
+ * measures the enclosing scope
+ * StartupPhase phase(QStringLiteral("initSpeakerFromCache"));
+ */
+class StartupPhase
+{
+public:
+    explicit StartupPhase(const QString& name) : mName(name) {
+        StartupProfiler::instance()->beginPhase(mName);
+    }
+    ~StartupPhase() {
+        StartupProfiler::instance()->endPhase(mName);
+    }
+
+private:
+    Q_DISABLE_COPY(StartupPhase)
+    QString mName;
+};
+
+#endif // STARTUPPROFILER_HPP
@@ -0,0 +1,288 @@
+#ifndef UPDATECHANGESET_HPP
+#define UPDATECHANGESET_HPP
+
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTime>
+
+#include "gen/Session.hpp"
+#include "gen/Speaker.hpp"
+#include "gen/SessionTrack.hpp"
+
+/*
+ * ids of added, changed and removed DataObjects of one kind
+ */
+class EntityChanges
+{
+public:
+    QSet<int> added;
+    QSet<int> changed;
+    QSet<int> removed;
+
+    bool isEmpty() const {
+        return added.isEmpty() && changed.isEmpty() && removed.isEmpty();
+    }
+    bool hasAddedOrRemoved() const {
+        return !added.isEmpty() || !removed.isEmpty();
+    }
+    void clear() {
+        added.clear();
+        changed.clear();
+        removed.clear();
+    }
+    // per ex. "+3 ~12 -1"
+    QString summary() const {
+        return QString("+%1 ~%2 -%3").arg(added.size()).arg(changed.size()).arg(removed.size());
+    }
+};
+
+/*
+ * persisted values of a Session (same as cached, without transient isFavorite)
+ * taken before and after filling from server to detect changes
+ * and to know the containers (day, room, tracks, presenter) a session was moved from
+ */
+class SessionState
+{
+public:
+    int conference;
+    bool isDeprecated;
+    QString sortKey;
+    bool isTraining;
+    bool isLightning;
+    bool isKeynote;
+    bool isSession;
+    bool isCommunity;
+    bool isUnconference;
+    bool isMeeting;
+    bool isGenericScheduleSession;
+    bool isBreak;
+    bool isLunch;
+    bool isEvent;
+    bool isRegistration;
+    QString title;
+    QString description;
+    QString sessionType;
+    QTime startTime;
+    QTime endTime;
+    int minutes;
+    QString abstractText;
+    int sessionDay;
+    int room;
+    QStringList sessionTracksKeys;
+    QStringList presenterKeys;
+
+    SessionState() : conference(0), isDeprecated(false), isTraining(false), isLightning(false),
+        isKeynote(false), isSession(false), isCommunity(false), isUnconference(false), isMeeting(false),
+        isGenericScheduleSession(false), isBreak(false), isLunch(false), isEvent(false),
+        isRegistration(false), minutes(0), sessionDay(-1), room(-1) {
+    }
+
+    static SessionState of(Session* session) {
+        SessionState state;
+        state.conference = session->conference();
+        state.isDeprecated = session->isDeprecated();
+        state.sortKey = session->sortKey();
+        state.isTraining = session->isTraining();
+        state.isLightning = session->isLightning();
+        state.isKeynote = session->isKeynote();
+        state.isSession = session->isSession();
+        state.isCommunity = session->isCommunity();
+        state.isUnconference = session->isUnconference();
+        state.isMeeting = session->isMeeting();
+        state.isGenericScheduleSession = session->isGenericScheduleSession();
+        state.isBreak = session->isBreak();
+        state.isLunch = session->isLunch();
+        state.isEvent = session->isEvent();
+        state.isRegistration = session->isRegistration();
+        state.title = session->title();
+        state.description = session->description();
+        state.sessionType = session->sessionType();
+        state.startTime = session->startTime();
+        state.endTime = session->endTime();
+        state.minutes = session->minutes();
+        state.abstractText = session->abstractText();
+        state.sessionDay = session->sessionDay();
+        state.room = session->room();
+        // resolved: the objects are the truth (removeFromPresenter() clears the keys)
+        if(session->areSessionTracksKeysResolved()) {
+            const QList<SessionTrack*> sessionTracks = session->sessionTracks();
+            for (int i = 0; i < sessionTracks.size(); ++i) {
+                state.sessionTracksKeys << QString::number(sessionTracks.at(i)->trackId());
+            }
+        } else {
+            state.sessionTracksKeys = session->sessionTracksKeys();
+        }
+        if(session->arePresenterKeysResolved()) {
+            const QList<Speaker*> presenter = session->presenter();
+            for (int i = 0; i < presenter.size(); ++i) {
+                state.presenterKeys << QString::number(presenter.at(i)->speakerId());
+            }
+        } else {
+            state.presenterKeys = session->presenterKeys();
+        }
+        return state;
+    }
+
+    // isFavorite isn't touched: stays as it is
+    void applyTo(Session* session) const {
+        session->setConference(conference);
+        session->setIsDeprecated(isDeprecated);
+        session->setSortKey(sortKey);
+        session->setIsTraining(isTraining);
+        session->setIsLightning(isLightning);
+        session->setIsKeynote(isKeynote);
+        session->setIsSession(isSession);
+        session->setIsCommunity(isCommunity);
+        session->setIsUnconference(isUnconference);
+        session->setIsMeeting(isMeeting);
+        session->setIsGenericScheduleSession(isGenericScheduleSession);
+        session->setIsBreak(isBreak);
+        session->setIsLunch(isLunch);
+        session->setIsEvent(isEvent);
+        session->setIsRegistration(isRegistration);
+        session->setTitle(title);
+        session->setDescription(description);
+        session->setSessionType(sessionType);
+        session->setStartTime(startTime);
+        session->setEndTime(endTime);
+        session->setMinutes(minutes);
+        session->setAbstractText(abstractText);
+        session->setSessionDay(sessionDay);
+        session->setRoom(room);
+        session->setSessionTracksKeys(sessionTracksKeys);
+        session->setPresenterKeys(presenterKeys);
+    }
+
+    bool operator==(const SessionState& other) const {
+        return conference == other.conference
+                && isDeprecated == other.isDeprecated
+                && sortKey == other.sortKey
+                && isTraining == other.isTraining
+                && isLightning == other.isLightning
+                && isKeynote == other.isKeynote
+                && isSession == other.isSession
+                && isCommunity == other.isCommunity
+                && isUnconference == other.isUnconference
+                && isMeeting == other.isMeeting
+                && isGenericScheduleSession == other.isGenericScheduleSession
+                && isBreak == other.isBreak
+                && isLunch == other.isLunch
+                && isEvent == other.isEvent
+                && isRegistration == other.isRegistration
+                && title == other.title
+                && description == other.description
+                && sessionType == other.sessionType
+                && startTime == other.startTime
+                && endTime == other.endTime
+                && minutes == other.minutes
+                && abstractText == other.abstractText
+                && sessionDay == other.sessionDay
+                && room == other.room
+                && sessionTracksKeys == other.sessionTracksKeys
+                && presenterKeys == other.presenterKeys;
+    }
+    bool operator!=(const SessionState& other) const {
+        return !(*this == other);
+    }
+};
+
+/*
+ * persisted values of a Speaker set from server data
+ * taken before and after filling from server to detect changes
+ * sessions and conferences aren't compared: rebuilt from Sessions (touchedSpeakers)
+ */
+class SpeakerState
+{
+public:
+    bool isDeprecated;
+    QString sortKey;
+    QString sortGroup;
+    QString name;
+    QString publicName;
+    QString title;
+    QString bio;
+    int speakerImage;
+
+    SpeakerState() : isDeprecated(false), speakerImage(-1) {
+    }
+
+    static SpeakerState of(Speaker* speaker) {
+        SpeakerState state;
+        state.isDeprecated = speaker->isDeprecated();
+        state.sortKey = speaker->sortKey();
+        state.sortGroup = speaker->sortGroup();
+        state.name = speaker->name();
+        state.publicName = speaker->publicName();
+        state.title = speaker->title();
+        state.bio = speaker->bio();
+        state.speakerImage = speaker->speakerImage();
+        return state;
+    }
+
+    bool operator==(const SpeakerState& other) const {
+        return isDeprecated == other.isDeprecated
+                && sortKey == other.sortKey
+                && sortGroup == other.sortGroup
+                && name == other.name
+                && publicName == other.publicName
+                && title == other.title
+                && bio == other.bio
+                && speakerImage == other.speakerImage;
+    }
+    bool operator!=(const SpeakerState& other) const {
+        return !(*this == other);
+    }
+};
+
+/*
+ * Change Set of a schedule update
+ * collected while comparing data from server with current conference data
+ * (see DataUtil continueUpdate, updateSessions, addGenericSession)
+ * and consumed by DataUtil::finishUpdate(), saveUpdatedCaches(), completeUpdate():
+ * only touched containers are rebuilt, only changed caches are written
+ */
+class UpdateChangeSet
+{
+public:
+    EntityChanges sessions;
+    EntityChanges speakers;
+    EntityChanges rooms;
+    EntityChanges tracks;
+
+    // all ids found in this update - everything else is removed
+    QSet<int> receivedSessions;
+    QSet<int> receivedSpeakers;
+
+    // containers where the list of sessions must be rebuilt
+    QSet<int> touchedDays;
+    QSet<int> touchedRooms;
+    QSet<int> touchedTracks;
+    QSet<int> touchedSpeakers;
+
+    // new or changed speaker images (downloaded)
+    bool speakerImagesChanged;
+
+    UpdateChangeSet() : speakerImagesChanged(false) {
+    }
+
+    bool isEmpty() const {
+        return sessions.isEmpty() && speakers.isEmpty() && rooms.isEmpty() && tracks.isEmpty()
+                && !speakerImagesChanged;
+    }
+    void clear() {
+        sessions.clear();
+        speakers.clear();
+        rooms.clear();
+        tracks.clear();
+        receivedSessions.clear();
+        receivedSpeakers.clear();
+        touchedDays.clear();
+        touchedRooms.clear();
+        touchedTracks.clear();
+        touchedSpeakers.clear();
+        speakerImagesChanged = false;
+    }
+};
+
+#endif // UPDATECHANGESET_HPP
@@ -38,6 +38,10 @@ Pane {
             Layout.leftMargin: 6
             placeholderText: qsTr("Search")
             // Keys.onReturnPressed: not used here
+            // search-as-you-type: results from searchModel (SearchResultModel)
+            onDisplayTextChanged: {
+                searchModel.query = displayText
+            }
         }
 
     } // row
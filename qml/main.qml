@@ -505,6 +505,7 @@ ApplicationWindow {
             repeat: false
             onTriggered: {
                 console.log("startupDelayedTimer START")
+                startupProfiler.beginPhase("startupDelayedTimer")
 
                 if(Qt.platform.os === "android") {
                     var screenWidthPixel = Screen.width * Screen.devicePixelRatio
@@ -518,6 +519,7 @@ ApplicationWindow {
                 }
 
                 initialPlaceholder.item.showInfo("Initialize Data ...")
+                startupProfiler.beginPhase("initialize Data")
                 if(!initialPlaceholder.isUpdate) {
                     dataManager.init()
                 }
@@ -526,11 +528,13 @@ ApplicationWindow {
                 dataManager.resolveReferencesForAllSession()
                 dataUtil.resolveSessionsForSchedule()
                 currentConference = dataUtil.currentConference()
+                dataUtil.buildSearchIndex()
                 if(currentConference) {
                     console.log("QML Current Conference: "+currentConference.conferenceCity)
                 } else {
                     console.log("No Conference ! - do the first Update now")
                 }
+                startupProfiler.endPhase("initialize Data")
                 initialPlaceholder.item.showInfo("Create Navigation Controls ...")
                 // inject model into Destinations Repeater
                 console.log("now inject navigation model")
@@ -541,6 +545,8 @@ ApplicationWindow {
                 // show first destination (should always be IMMEDIATELY)
                 rootPane.activateDestination(firstActiveDestination)
                 console.log("startupDelayedTimer DONE")
+                startupProfiler.endPhase("startupDelayedTimer")
+                startupProfiler.finishStartup()
                 if(dataUtil.isNoConference()) {
                     console.log("startupDelayedTimer: isNoConference")
                     appWindow.oldConference()
@@ -9,6 +9,24 @@ ToolBar {
     id: myTitleBar
     topPadding: unsafeArea.unsafeTopMargin? unsafeArea.unsafeTopMargin : undefined
 
+    // dataUtil.todayDayIndex() has no NOTIFY: re-evaluated if conference or date changes
+    property int todayDayIndex: -1
+    function updateTodayDayIndex() {
+        todayDayIndex = dataUtil.todayDayIndex()
+    }
+    Connections {
+        target: dataUtil
+        onCurrentConferenceChanged: myTitleBar.updateTodayDayIndex()
+    }
+    // date changes at midnight or while app was suspended
+    Timer {
+        interval: 60000
+        repeat: true
+        running: Qt.application.state === Qt.ApplicationActive
+        triggeredOnStart: true
+        onTriggered: myTitleBar.updateTodayDayIndex()
+    }
+
     RowLayout {
         focus: false
         spacing: 6
@@ -105,6 +123,18 @@ ToolBar {
                 destinations.itemAt(scheduleNavigationIndex).item.pickTime()
             }
         } // scheduleGoToButton
+        ToolButton {
+            id: scheduleNowButton
+            visible: scheduleGoToButton.visible && myTitleBar.todayDayIndex !== -1
+            focusPolicy: Qt.NoFocus
+            Image {
+                anchors.centerIn: parent
+                source: "qrc:/images/"+iconOnPrimaryFolder+"/time.png"
+            }
+            onClicked: {
+                destinations.itemAt(scheduleNavigationIndex).item.goToNow()
+            }
+        } // scheduleNowButton
         ToolButton {
             id: speakerGoToButton
             visible: navigationIndex == speakerNavigationIndex && destinations.itemAt(speakerNavigationIndex).item.depth === 1
@@ -289,6 +289,18 @@ Page {
         onClosed: timePickerClosed()
     }
 
+    // executed from Now Button at TitleBar
+    function goToNow() {
+        var dayIndex = dataUtil.todayDayIndex()
+        if(dayIndex === -1) {
+            appWindow.showToast(qsTr("No Sessions today"))
+            return
+        }
+        // initialItemLoader.item == DaySwiper
+        initialItemLoader.item.currentIndex = dayIndex
+        initialItemLoader.item.goToIndex(dataUtil.findCurrentSessionItem(dayIndex))
+    }
+
     // executed from GoTo Button at TitleBar
     function pickTime() {
         if(timePickerLoader.active) {
@@ -15,6 +15,7 @@ Flickable {
     // StackView manages this, so please no anchors here
     // anchors.fill: parent
     property string name: "About"
+    property bool isDebugBuild: myApp.isDebugBuild()
 
     Pane {
         id: root
@@ -155,6 +156,38 @@ Flickable {
                 }
             }
             HorizontalDivider {}
+            // DEBUG: startup timings (StartupProfiler)
+            RowLayout {
+                visible: isDebugBuild
+                LabelTitle {
+                    leftPadding: 10
+                    rightPadding: 10
+                    text: qsTr("Startup Profile")
+                    color: primaryColor
+                }
+            }
+            RowLayout {
+                visible: isDebugBuild
+                LabelBodySecondary {
+                    id: startupProfileLabel
+                    leftPadding: 10
+                    rightPadding: 10
+                    font.family: "Courier"
+                    wrapMode: Text.NoWrap
+                    text: isDebugBuild? startupProfiler.report() : ""
+                }
+            }
+            RowLayout {
+                visible: isDebugBuild
+                ButtonFlat {
+                    text: qsTr("Save Report")
+                    onClicked: {
+                        startupProfileLabel.text = startupProfiler.report()
+                        var path = startupProfiler.dumpReport()
+                        appWindow.showToast(path.length? qsTr("Saved to ")+path : qsTr("Cannot save Report"))
+                    }
+                }
+            }
         } // col layout
     } // root
     ScrollIndicator.vertical: ScrollIndicator { }
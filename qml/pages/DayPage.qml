@@ -64,7 +64,7 @@ Page {
             return
         }
         if(theIndex > 0) {
-            if(theIndex === listView.model.length) {
+            if(theIndex === listView.model.count) {
                 appWindow.showToast(qsTr("Too late for a Session"))
             }
 
@@ -84,8 +84,8 @@ Page {
         if(currentConference.daysPropertyList.length > 0) {
             conferenceDay = currentConference.daysPropertyList[dayIndex]
             console.log(conferenceDay.conferenceDay)
-            console.log("Sessions:"+conferenceDay.sessionsPropertyList.length)
-            listView.model = conferenceDay.sessionsPropertyList
+            listView.model = dataUtil.sessionListModel(conferenceDay)
+            console.log("Sessions:"+listView.model.count)
         } else {
             listView.model =  []
         }
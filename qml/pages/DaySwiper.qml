@@ -66,7 +66,7 @@ Page {
             DayPage {
                 dayIndex: index
                 conferenceDay: currentConference.daysPropertyList[index]
-                theModel: conferenceDay.sessionsPropertyList
+                theModel: dataUtil.sessionListModel(conferenceDay)
             }
         } // day repeater
 
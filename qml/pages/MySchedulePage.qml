@@ -93,7 +93,7 @@ Page {
     function myScheduleRefreshed() {
         console.log("myScheduleRefreshed")
         sessionLists = dataUtil.mySchedule()
-        listView.model = sessionLists.scheduledSessionsPropertyList
+        listView.model = dataUtil.sessionListModel(sessionLists)
         if(sessionLists.scheduledSessionsPropertyList.length === 0) {
             popupScheduleEmpty.open()
         }
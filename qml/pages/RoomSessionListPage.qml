@@ -84,8 +84,8 @@ Page {
         console.log("Init from roomSessionListPage")
         room = dataManager.findRoomByRoomId(roomId)
         headerLabel.text = room.roomName
-        listView.model = room.sessionsPropertyList
-        console.log(" Room "+room.roomName+" Sessions:"+room.sessionsPropertyList.length)
+        listView.model = dataUtil.sessionListModel(room)
+        console.log(" Room "+room.roomName+" Sessions:"+listView.model.count)
 
     }
     // called from Component.destruction
@@ -16,8 +16,8 @@ ListView {
     anchors.fill: parent
     // setting the margin to be able to scroll the list above the FAB to use the Switch on last row
     bottomMargin: 40
-    // QList<Session*>
-    // conferenceDay.sessionsPropertyList
+    // SessionListModel
+    // dataUtil.sessionListModel(conferenceDay)
 
     delegate:
 
@@ -43,8 +43,8 @@ ListView {
                         IconActive {
                             //transform: Translate { x: -36 }
                             imageSize: 36
-                            imageName: dataUtil.scheduleItemImageForSession(model.modelData)
-                            // opacity: model.modelData.isFavorite? opacityToggleActive : opacityToggleInactive
+                            imageName: model.scheduleItemImage
+                            // opacity: model.isFavorite? opacityToggleActive : opacityToggleInactive
                         } // scheduleItemImage
                     } // left column
                     ColumnLayout {
@@ -55,7 +55,7 @@ ListView {
                         spacing: 0
                         LabelTitle {
                             rightPadding: 12
-                            text: model.modelData.title
+                            text: model.title
                             color: primaryColor
                             //font.bold: true
                             wrapMode: Label.WordWrap
@@ -67,12 +67,12 @@ ListView {
                             bottomPadding: 6
                             font.italic: true
                             // text: model.modelData.startTime.toLocaleTimeString("HH:mm") + " - " + model.modelData.endTime.toLocaleTimeString("HH:mm")
-                            text: dataUtil.displayStartToEnd(model.modelData)
+                            text: model.startToEnd
                         }
                     } // middle column
 //                    ListRowButton {
 //                        onClicked: {
-//                            navPane.pushSessionDetail(model.modelData.sessionId)
+//                            navPane.pushSessionDetail(model.sessionId)
 //                        }
 //                    }
                 }
@@ -90,10 +90,10 @@ ListView {
                     anchors.top: theItem.top
                     height: sessionRow.height-2
                     width: 8
-                    color: dataUtil.trackColorFirstTrack(model.modelData)
+                    color: model.trackColor
                 }
                 onClicked: {
-                    navPane.pushSessionDetail(model.modelData.sessionId)
+                    navPane.pushSessionDetail(model.sessionId)
                 }
 
                 ColumnLayout {
@@ -119,7 +119,7 @@ ListView {
                             spacing: 0
                             LabelSubheading {
                                 rightPadding: 12
-                                text: model.modelData.title
+                                text: model.title
                                 font.bold: true
                                 wrapMode: Label.WordWrap
                                 maximumLineCount: 2
@@ -129,7 +129,7 @@ ListView {
                                 LabelBody {
                                     Layout.fillWidth: false
                                     // text: model.modelData.startTime.toLocaleTimeString("HH:mm") + " - " + model.modelData.endTime.toLocaleTimeString("HH:mm") + ","
-                                    text: dataUtil.displayStartToEnd(model.modelData) + ","
+                                    text: model.startToEnd + ","
                                 }
                                 IconActive{
                                     imageSize: 18
@@ -137,7 +137,7 @@ ListView {
                                 }
                                 LabelBody {
                                     Layout.fillWidth: false
-                                    text: model.modelData.roomAsDataObject? model.modelData.roomAsDataObject.roomName : ""
+                                    text: model.roomName
                                 }
                             }
                             RowLayout {
@@ -149,7 +149,7 @@ ListView {
                                 LabelBody {
                                     id: speakerNamesLabel
                                     font.italic: true
-                                    text: dataUtil.speakerNamesForSession(model.modelData)
+                                    text: model.speakerNames
                                     wrapMode: Label.WordWrap
                                     maximumLineCount: 3
                                     elide: Label.ElideRight
@@ -162,11 +162,12 @@ ListView {
                                 transform: Translate { x: -6 }
                                 imageSize: 36
                                 imageName: "stars.png"
-                                opacity: model.modelData.isFavorite? opacityToggleActive : opacityToggleInactive
+                                opacity: model.isFavorite? opacityToggleActive : opacityToggleInactive
                                 ListRowButton {
                                     onClicked: {
-                                        model.modelData.isFavorite = !model.modelData.isFavorite
-                                        if(model.modelData.isFavorite) {
+                                        // SessionListModel: dataChanged only for this row
+                                        model.modelData.isFavorite = !model.isFavorite
+                                        if(model.isFavorite) {
                                             appWindow.showToast(qsTr("Added to Personal Schedule"))
                                         } else {
                                             appWindow.showToast(qsTr("Removed from Personal Schedule"))
@@ -122,7 +122,7 @@ Page {
                 // S E S S I O N    Repeater
                 Repeater {
                     id: sessionRepeater
-                    model: speaker.sessionsPropertyList
+                    model: dataUtil.sessionListModel(speaker)
                     property int sessionRepeaterIndex: index
                     Pane {
                         id: speakerSessionPane
@@ -89,8 +89,8 @@ Page {
         } else {
             headerLabel.text = qsTr("* no Track assigned *")
         }
-        listView.model = sessionTrack.sessionsPropertyList
-        console.log(" Track "+sessionTrack.name+" Sessions:"+sessionTrack.sessionsPropertyList.length)
+        listView.model = dataUtil.sessionListModel(sessionTrack)
+        console.log(" Track "+sessionTrack.name+" Sessions:"+listView.model.count)
 
     }
     // called from Component.destruction
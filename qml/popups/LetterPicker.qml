@@ -44,7 +44,7 @@ Popup {
                 LabelTitle {
                     anchors.verticalCenter: parent.verticalCenter
                     leftPadding: 24
-                    text: model.letter
+                    text: modelData
                     font.bold: true
                     color: primaryColor
                 }
@@ -52,41 +52,21 @@ Popup {
             MouseArea {
                 anchors.fill: parent
                 onClicked: {
-                    popup.selectedLetter = model.letter
+                    popup.selectedLetter = modelData
                     popup.isOK = true
                     popup.close()
                 }
             } // mouse
         } // end delegateItem
 
-        model: ListModel {
-            ListElement { letter: "A" }
-            ListElement { letter: "B" }
-            ListElement { letter: "C" }
-            ListElement { letter: "D" }
-            ListElement { letter: "E" }
-            ListElement { letter: "F" }
-            ListElement { letter: "G" }
-            ListElement { letter: "H" }
-            ListElement { letter: "I" }
-            ListElement { letter: "J" }
-            ListElement { letter: "K" }
-            ListElement { letter: "L" }
-            ListElement { letter: "M" }
-            ListElement { letter: "N" }
-            ListElement { letter: "O" }
-            ListElement { letter: "P" }
-            ListElement { letter: "Q" }
-            ListElement { letter: "R" }
-            ListElement { letter: "S" }
-            ListElement { letter: "T" }
-            ListElement { letter: "U" }
-            ListElement { letter: "V" }
-            ListElement { letter: "W" }
-            ListElement { letter: "X" }
-            ListElement { letter: "Y" }
-            ListElement { letter: "Z" }
-        }
+        // only letters with Speakers
+        model: dataUtil.speakerLetters()
         ScrollIndicator.vertical: ScrollIndicator { }
     } // end listView
+
+    // sorted Speakers were updated
+    Connections {
+        target: dataUtil
+        onSpeakerSectionsChanged: listView.model = dataUtil.speakerLetters()
+    }
 } // end popup